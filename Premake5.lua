@@ -92,6 +92,9 @@ ProjIncludes = {
 	"dependencies/tinyGLTF",
 	"dependencies/json",
 	"dependencies/bullet3/include",
+	-- Other modules share pieces of the toolkit. Some are header only (ex TTK/VertexLayout.h), but NOU also uses
+	-- compiled parts (ex TTK/AsyncTextureLoader.h and Logging.h), which projects get since they link every module
+	"modules/toolkit/include",
 }
 
 -- These are all the default dependencies that require linking
@@ -53,6 +53,13 @@ namespace nou
 		Material* m_mat;
 		std::unique_ptr<VertexArray> m_vao;
 
+		//The bounding sphere of our mesh, used to work out how big we are on screen.
+		glm::vec3 m_boundsCenter;
+		float m_boundsRadius;
+
+		//Works out how many pixels tall our mesh is on screen, roughly.
+		float GetScreenSize(const glm::mat4& model);
+
 		//Having a default constructor makes it easier for us to inherit from
 		//this class later on (e.g., for a mesh renderer with skeletal animation).
 		//However, it does not make sense to instantiate this class on its own
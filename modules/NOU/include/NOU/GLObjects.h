@@ -15,6 +15,8 @@ You'll be learning a LOT more about this in your graphics class.
 #include <string>
 
 #include "glad/glad.h"
+#include "TTK/VertexLayout.h"
+#include "TTK/GLState.h"
 
 namespace nou
 {
@@ -30,8 +32,20 @@ namespace nou
 
 		template<typename T>
 		VertexBuffer(GLint elementLen, const std::vector<T>& data, bool dynamic = false)
+			: VertexBuffer(TTK::VertexLayout().Float(0, elementLen), data, dynamic)
 		{
-			m_elementLen = elementLen;
+		}
+
+		//This version lets you describe exactly how the data is laid out,
+		//so that you can use packed formats (e.g., RGBA8 colours or half floats)
+		//or store several attributes interleaved in one buffer.
+		//Attribute locations in the layout are relative to the location
+		//the buffer gets bound to in VertexArray::BindAttrib.
+		template<typename T>
+		VertexBuffer(const TTK::VertexLayout& layout, const std::vector<T>& data, bool dynamic = false)
+		{
+			m_layout = layout;
+			m_elementLen = layout.GetAttributes().empty() ? 0 : layout.GetAttributes()[0].Components;
 			m_startIndex = 0;
 			m_len = 0;
 			m_dynamic = dynamic;
@@ -79,6 +93,8 @@ namespace nou
 
 		GLuint GetID() const { return m_id; }
 
+		const TTK::VertexLayout& Layout() const { return m_layout; }
+
 		//This uploads the data specified into our OpenGL buffer on the GPU.
 		template<typename T>
 		void UpdateData(const std::vector<T>& data)
@@ -97,6 +113,9 @@ namespace nou
 		//The OpenGL ID of our VBO.
 		GLuint m_id;
 
+		//Describes the type, size and location of each attribute in our data.
+		TTK::VertexLayout m_layout;
+
 		//The number of components in a single data point (e.g., Vector3 = 3 components).
 		GLint m_elementLen;
 		//The size of a single data point in bytes.
@@ -140,7 +159,7 @@ namespace nou
 
 		~VertexArray()
 		{
-			glDeleteVertexArrays(1, &m_id);
+			TTK::GLState::DeleteVertexArrays(1, &m_id);
 		}
 
 		/*The functions commented out here would be necessary if you wanted
@@ -231,13 +250,10 @@ namespace nou
 
 			m_len = buf.Length();
 
-			glBindVertexArray(m_id);
-			glEnableVertexAttribArray(attribLoc);
+			TTK::GLState::BindVertexArray(m_id);
 			glBindBuffer(GL_ARRAY_BUFFER, buf.GetID());
-			glVertexAttribPointer(attribLoc, buf.ElementLength(), 
-								  GL_FLOAT, GL_FALSE, 0,
-								 reinterpret_cast<void*>((long long)buf.StartIndex() *
-														 (long long)buf.ElementSize()));
+			buf.Layout().ApplyPointer((GLintptr)buf.StartIndex() * (GLintptr)buf.ElementSize(),
+									  attribLoc);
 		}
 
 		void SetDrawMode(DrawMode drawMode)
@@ -249,7 +265,7 @@ namespace nou
 		{
 			m_len = m_vbos.begin()->second->Length();
 
-			glBindVertexArray(m_id);
+			TTK::GLState::BindVertexArray(m_id);
 			glDrawArrays((int)m_drawMode, 0, m_len);
 		}
 
@@ -258,7 +274,7 @@ namespace nou
 			if (count == 0)
 				return;
 
-			glBindVertexArray(m_id);
+			TTK::GLState::BindVertexArray(m_id);
 			glDrawElements((int)m_drawMode,
 						   static_cast<GLsizei>(count),
 						   GL_UNSIGNED_INT,
@@ -15,6 +15,7 @@ used by a model.
 #include "GLM/glm.hpp"
 
 #include <vector>
+#include <unordered_map>
 
 namespace nou
 {
@@ -24,17 +25,45 @@ namespace nou
 
 		glm::vec3 m_color;
 
+		//The uniform block binding used for bindless material textures.
+		//Shaders opt in by declaring their samplers inside a block like this:
+		//	#extension GL_ARB_bindless_texture : enable
+		//	layout(std140, binding = 1) uniform MaterialTextures { sampler2D albedo; };
+		//To keep working on GPUs without the extension, put the block inside #ifdef GL_ARB_bindless_texture,
+		//and declare the samplers as regular uniforms otherwise. (See texturedlit_bindless.frag.)
+		static const GLuint TEXTURE_BLOCK_BINDING = 1;
+
 		Material(const ShaderProgram& program);
-		~Material() = default;
+		~Material();
+
+		//Materials own GPU resources, so they can't be copied.
+		Material(const Material&) = delete;
+		Material& operator=(const Material&) = delete;
 
 		//Returns true if the texture was added successfully.
-		//This will fail if you try to use more than the maximum number of textures.
-		//(Which we have set at 16 via our specification of MAX_SLOT).
+		//In the regular (bound slot) mode, this will fail if you try to use more than 
+		//the maximum number of textures. (Which we have set at 16 via our specification of MAX_SLOT).
+		//In bindless mode there is no limit, but the shader needs a sampler with this name.
 		bool AddTexture(const std::string& name, const Texture2D& tex);
 
 		//Should be called by the material's user before drawing the object (i.e., mesh).
 		void Use();
 
+		//Lets any streaming textures know how big the object using this material
+		//is on screen (in pixels), so they can load the detail they need.
+		void RequestTextureDetail(float screenPixels) const;
+
+		//Bindless textures let the shader read textures straight from a buffer, instead of us
+		//binding them to slots every time we switch materials. It needs GL_ARB_bindless_texture,
+		//and a shader with a MaterialTextures block - otherwise we use regular texture slots.
+		bool IsBindless() const { return m_bindless; }
+		static bool IsBindlessSupported();
+
+		//Makes a texture's bindless handle non-resident. This has to happen before the
+		//texture is deleted - Texture2D and TextureStreamer do it for you. Materials still
+		//using the texture pick up its replacement the next time they're used.
+		static void ReleaseTexture(GLuint texture);
+
 		protected:
 
 		//Small utility struct for managing how and where OpenGL will deal with our texture(s).
@@ -42,7 +71,27 @@ namespace nou
 		{
 			GLenum slot;
 			GLint loc;
-			GLuint id;
+			//We keep the texture rather than its ID, since a texture that is
+			//still loading in the background will swap its ID once it's ready.
+			const Texture2D* tex;
+		};
+
+		//A texture stored as a bindless handle in our parameter buffer.
+		struct TexHandle
+		{
+			GLint offset;
+			const Texture2D* tex;
+			//The texture's generation when we got the handle. We can't just compare IDs,
+			//since GL can give a new texture the ID of one that was just deleted.
+			uint32_t generation;
+			GLuint64 handle;
+		};
+
+		//How many materials are using a resident handle, and which texture it belongs to.
+		struct Residency
+		{
+			GLuint texture;
+			int count;
 		};
 
 		GLenum m_curSlot;
@@ -50,5 +99,23 @@ namespace nou
 
 		std::vector<TexUniform> m_tex;
 		const ShaderProgram* m_program;
+
+		//Bindless mode state.
+		bool m_bindless;
+		GLuint m_paramBuffer;
+		std::vector<unsigned char> m_params;
+		std::vector<TexHandle> m_handles;
+
+		//Handles are resident for the whole context rather than per-material,
+		//so we count how many materials are using each one.
+		static std::unordered_map<GLuint64, Residency> m_resident;
+		//The resident handle for each texture, so that we can release it when the texture goes away.
+		static std::unordered_map<GLuint, GLuint64> m_textureHandles;
+
+		static GLuint64 AcquireHandle(GLuint texture);
+		static void ReleaseHandle(GLuint64 handle);
+
+		//Updates any handles whose textures have changed (e.g. finished loading in the background).
+		void RefreshHandles();
 	};
 }
\ No newline at end of file
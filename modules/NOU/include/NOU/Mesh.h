@@ -39,24 +39,41 @@ namespace nou
 
 		void SetVerts(const std::vector<glm::vec3>& verts);
 		void SetNormals(const std::vector<glm::vec3>& normals);
-		void SetUVs(const std::vector<glm::vec2>& uvs);
+		//Set halfPrecision to store UVs as half floats, which saves memory but is only
+		//accurate enough for UVs that stay within about [-2, 2] (i.e., not heavily tiled).
+		void SetUVs(const std::vector<glm::vec2>& uvs, bool halfPrecision = false);
 
 		//Fetches a vertex buffer associated with the desired attribute.
 		//Used by mesh rendering components to grab the requisite data
 		//associated with this model in OpenGL.
 		const VertexBuffer* GetVBO(Attrib attrib) const;
 
+		//A sphere (in model space) that contains every vertex of the mesh.
+		const glm::vec3& GetBoundsCenter() const { return m_boundsCenter; }
+		float GetBoundsRadius() const { return m_boundsRadius; }
+
 		protected:
 
 		std::vector<glm::vec3> m_verts;
 		std::vector<glm::vec3> m_normals;
 		std::vector<glm::vec2> m_uvs;
+		bool m_halfUVs = false;
+
+		glm::vec3 m_boundsCenter = glm::vec3(0.0f);
+		float m_boundsRadius = 0.0f;
 
 		std::map<Attrib, std::unique_ptr<VertexBuffer>> m_vbo;
 
 		//Sets up a VertexBuffer for the desired attribute.
 		template<typename T>
 		void SetVBO(Attrib attrib, GLint elementLen, const std::vector<T>& data)
+		{
+			SetVBO(attrib, TTK::VertexLayout().Float(0, elementLen), data);
+		}
+
+		//Same as above, but with a layout describing the format of the data.
+		template<typename T>
+		void SetVBO(Attrib attrib, const TTK::VertexLayout& layout, const std::vector<T>& data)
 		{
 			//We shouldn't be trying to send an empty array!
 			//A VBO with no data would just lead to memory access errors.
@@ -71,7 +88,7 @@ namespace nou
 			//If our VBO does not already exist, make a new one.
 			if (it == m_vbo.end())
 				m_vbo.insert({attrib,
-					std::make_unique<VertexBuffer>(elementLen, data)});
+					std::make_unique<VertexBuffer>(layout, data)});
 			//If our VBO does exist, update it with the new data specified.
 			else
 				it->second->UpdateData(data);
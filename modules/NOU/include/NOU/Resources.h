@@ -0,0 +1,52 @@
+/*
+NOU Framework - Created for INFR 2310 at Ontario Tech.
+(c) Samantha Stahlke 2020
+
+Resources.h
+Shared loading for textures, meshes and shaders, so that each
+file is only loaded once no matter how many objects use it.
+*/
+
+#pragma once
+
+#include "Texture.h"
+#include "Mesh.h"
+#include "Shader.h"
+#include "TTK/ResourceRegistry.h"
+
+#include <memory>
+#include <string>
+
+namespace nou
+{
+	typedef TTK::ResourceRegistry<Texture2D> TextureRegistry;
+	typedef TTK::ResourceRegistry<Mesh> MeshRegistry;
+	typedef TTK::ResourceRegistry<Shader> ShaderRegistry;
+
+	class Resources
+	{
+		public:
+
+		//Each of these returns the already loaded resource if the same file was
+		//loaded before with the same options. Otherwise, it gets loaded and kept
+		//around for the next person who asks for it. If a file can't be loaded,
+		//LoadMesh returns nullptr (and nothing is kept, so you can try again later).
+		static std::shared_ptr<Texture2D> LoadTexture(const std::string& filename, bool useNearest = false,
+													  MipFilter mips = MipFilter::Box, bool sRGB = true);
+		static std::shared_ptr<Mesh> LoadMesh(const std::string& filename, bool flipUVY = true);
+		static std::shared_ptr<Shader> LoadShader(const std::string& filename, GLenum shaderType);
+
+		//Releases every resource that isn't being used by anything else
+		//(e.g., after switching levels). Returns how many were released.
+		static size_t UnloadUnused();
+
+		//Forgets about every resource. This needs to happen before the GL context
+		//goes away - App::Cleanup does it for you.
+		static void Cleanup();
+
+		protected:
+
+		//Like App, everything here is static.
+		Resources() = default;
+	};
+}
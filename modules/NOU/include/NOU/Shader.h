@@ -8,6 +8,7 @@ Utility classes for managing OpenGL shaders and shader programs.
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -33,6 +34,32 @@ namespace nou
 	//compiling shaders and linking shader programs.
 	void PrintGLInfoLog(const std::string& preamble, GLInfoLogType logType, GLuint objID, GLint buflen);
 
+	//Identifies a uniform by a hash of its name, so that we can look it up
+	//without any string work. Declaring one as static constexpr hashes
+	//the name at compile time, e.g.:
+	//	static constexpr UniformID modelID("model");
+	struct UniformID
+	{
+		uint32_t hash;
+
+		constexpr UniformID(const char* name) : hash(Hash(name)) {}
+		UniformID(const std::string& name) : hash(Hash(name.c_str())) {}
+
+		//32-bit FNV-1a.
+		static constexpr uint32_t Hash(const char* name)
+		{
+			uint32_t result = 2166136261u;
+
+			for (; *name != '\0'; ++name)
+			{
+				result ^= static_cast<uint8_t>(*name);
+				result *= 16777619u;
+			}
+
+			return result;
+		}
+	};
+
 	class Shader
 	{
 		public:
@@ -62,24 +89,46 @@ namespace nou
 		//Fetches the shader program currently in use.
 		static const ShaderProgram* Current();
 
+		GLuint GetID() const { return m_id; }
+
 		//Utility functions for managing uniforms - variables
 		//we send to the shader that persist until we change them.
-		GLint GetUniformLoc(const std::string& name) const;
+		//Names can be passed in directly, but pre-resolving a UniformID
+		//(ideally a static constexpr one) avoids hashing on every call.
+		//Uniforms the program doesn't use have a location of -1,
+		//which OpenGL quietly ignores.
+		GLint GetUniformLoc(UniformID id) const;
 
 		template<typename T>
-		void SetUniform(const std::string& name, const T& value) const;
+		void SetUniform(UniformID id, const T& value) const;
 
 		template<typename T>
-		void SetUniformArray(const std::string& name, T* data, int len) const;
+		void SetUniformArray(UniformID id, T* data, int len) const;
 
 		protected:
 
+		//One entry in our uniform table - the hash of a uniform's name and its location.
+		struct UniformSlot
+		{
+			uint32_t hash;
+			GLint loc;
+		};
+
 		//The OpenGL ID of our shader program.
 		GLuint m_id;
 
+		//Every active uniform in the program, found once after linking.
+		//This is an open-addressed hash table (its size is a power of two),
+		//so finding a uniform is usually a single lookup.
+		std::vector<UniformSlot> m_uniforms;
+
 		//The shader program currently in use.
 		static const ShaderProgram* m_current;
 
 		void Link();
+
+		//Asks OpenGL about every uniform in the program and fills in our table.
+		void ReflectUniforms();
+		void AddUniform(uint32_t hash, GLint loc, const std::string& name);
 	};
 }
\ No newline at end of file
@@ -9,24 +9,71 @@ Simple wrapper for STB image loading into 2D textures.
 #pragma once
 
 #include "glad/glad.h"
+#include "TextureData.h"
 
 #include <string>
+#include <memory>
+#include <functional>
 
 namespace nou
 {
+	struct StreamState;
+
 	class Texture2D
 	{
 		public:
 
-		Texture2D(const std::string& filename, bool useNearest = false);
+		//Loads a texture, building a full mip chain (unless mips is MipFilter::None).
+		//Set sRGB to false for textures that aren't colours (normal maps, masks, etc.).
+		//DDS and KTX2 files holding BC1/BC3/BC5/BC7 data are uploaded as-is, along
+		//with whatever mips they contain - in that case mips and sRGB are ignored.
+		Texture2D(const std::string& filename, bool useNearest = false,
+				  MipFilter mips = MipFilter::Box, bool sRGB = true);
 		~Texture2D();
 
+		//Non-copyable, since we own the GL texture.
+		Texture2D(const Texture2D&) = delete;
+		Texture2D& operator=(const Texture2D&) = delete;
+
+		//Starts loading a texture in the background, so that big levels don't freeze the game.
+		//Until the image is ready, the texture shows a placeholder checkerboard.
+		//The mip chain is built in the background too, the same way as the constructor does it.
+		//The callback (if any) runs on the main thread once the real texture is on the GPU
+		//(or the load failed, in which case the bool is false).
+		//Loads only make progress while the loader is pumped - App::SwapBuffers does this for you.
+		//(DDS and KTX2 files are not supported - use the regular constructor for those.)
+		static std::unique_ptr<Texture2D> LoadAsync(const std::string& filename, bool useNearest = false,
+													MipFilter mips = MipFilter::Box, bool sRGB = true,
+													std::function<void(Texture2D&, bool)> onLoaded = nullptr);
+
 		GLuint GetID() const;
 		void GetDimensions(int& width, int& height) const;
 
+		//Returns false while an async load is still in progress.
+		bool IsLoaded() const;
+
+		//Goes up every time the texture's GL ID changes (e.g., when an async load
+		//finishes, or the streamer changes which mips are loaded).
+		uint32_t GetGeneration() const { return m_generation; }
+
 		private:
 
+		//The streamer swaps in new GL textures as mips are loaded and dropped.
+		friend class TextureStreamer;
+
+		Texture2D();
+
+		void UploadCompressed(const CompressedImage& image);
+		void UploadMips(const std::vector<MipLevel>& levels);
+
 		GLuint m_id;
 		int m_width, m_height;
+		uint32_t m_loadHandle;
+		uint32_t m_generation;
+		//True while m_id is the async loader's shared placeholder. We keep track of this ourselves,
+		//since the loader (and its placeholder) may be destroyed before we are.
+		bool m_isPlaceholder;
+		//Only set for textures created by TextureStreamer::Load.
+		StreamState* m_streamState;
 	};
 }
\ No newline at end of file
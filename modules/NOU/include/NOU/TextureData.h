@@ -0,0 +1,67 @@
+/*
+NOU Framework - Created for INFR 2310 at Ontario Tech.
+(c) Samantha Stahlke 2020
+
+TextureData.h
+CPU-side helpers for preparing texture data - building mip chains,
+and reading pre-compressed (BCn) textures from DDS and KTX2 files.
+*/
+
+#pragma once
+
+#include "glad/glad.h"
+
+#include <string>
+#include <vector>
+
+namespace nou
+{
+	//Which filter to use when shrinking an image down to build its mipmaps.
+	//Box is a simple 2x2 average. Kaiser is a windowed sinc, which keeps
+	//smaller mips sharper at the cost of a slower import.
+	enum class MipFilter
+	{
+		None,
+		Box,
+		Kaiser
+	};
+
+	//One level of a texture's mip chain.
+	struct MipLevel
+	{
+		int width, height;
+		std::vector<unsigned char> data;
+	};
+
+	//A texture read from a DDS or KTX2 file, still in its
+	//block-compressed form so that we can send it straight to the GPU.
+	struct CompressedImage
+	{
+		GLenum format;
+		int width, height;
+		std::vector<MipLevel> levels;
+	};
+
+	//Flips an image upside down in place, since OpenGL expects the bottom row first.
+	void FlipRows(unsigned char* data, int width, int height, int pixelSize);
+
+	//Returns the number of levels in a full mip chain for an image of the given size.
+	int GetMipCount(int width, int height);
+
+	//Builds a full mip chain from RGBA8 data. Level 0 is a copy of the source.
+	//If the data is sRGB (i.e., it's a colour texture rather than a normal map
+	//or mask), we filter in linear space so that smaller mips don't darken.
+	std::vector<MipLevel> GenerateMips(const unsigned char* rgba, int width, int height,
+									   MipFilter filter, bool sRGB);
+
+	//Returns true if the file looks like a container we can read with LoadCompressedImage.
+	bool IsCompressedImageFile(const std::string& filename);
+
+	//Reads BC1, BC3, BC5 or BC7 data from a DDS or KTX2 file.
+	//Top-down images are flipped so that the bottom row comes first, like OpenGL expects.
+	//BC7 can't be flipped without re-encoding it, so top-down BC7 files (including
+	//every BC7 DDS file) load upside down with a warning - store them bottom-up
+	//(KTX2 with KTXorientation "ru") to avoid this.
+	//Returns false (and prints why) if the file can't be used.
+	bool LoadCompressedImage(const std::string& filename, CompressedImage& image);
+}
@@ -0,0 +1,98 @@
+/*
+NOU Framework - Created for INFR 2310 at Ontario Tech.
+(c) Samantha Stahlke 2020
+
+TextureStreamer.h
+Keeps only as much of each streaming texture on the GPU as we need.
+Every streaming texture always has its small mips resident. The larger
+mips are loaded on a background thread once something using the texture
+gets big enough on screen, and dropped again when we go over budget.
+*/
+
+#pragma once
+
+#include "Texture.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace nou
+{
+	struct StreamState;
+	struct StreamJob;
+
+	class TextureStreamer
+	{
+		public:
+
+		struct Stats
+		{
+			size_t residentBytes;
+			size_t budgetBytes;
+			size_t cachedBytes;
+			int pendingRequests;
+			int textureCount;
+		};
+
+		//Loads a streaming texture. Until its small mips have been loaded it shows a
+		//placeholder, and larger mips arrive as the texture is needed.
+		//(DDS and KTX2 files are not supported - use the regular constructor for those.)
+		static std::unique_ptr<Texture2D> Load(const std::string& filename, bool useNearest = false,
+											   MipFilter mips = MipFilter::Box, bool sRGB = true);
+
+		//Tells the streamer how big a texture is on screen this frame, in pixels
+		//(across the object using it). Called for you by CMeshRenderer.
+		static void RequestSize(const Texture2D& tex, float screenPixels);
+
+		//Applies finished loads, requests the mips we need and evicts the ones we
+		//can do without. Should be called once per frame - App::SwapBuffers does this for you.
+		static void Update();
+
+		//How much GPU memory streaming textures are allowed to use, in bytes.
+		static void SetBudget(size_t bytes);
+		//How many bytes of new mips we send to the GPU each frame, so that loading
+		//a big texture is spread over a few frames rather than causing a hitch.
+		static void SetUploadBudget(size_t bytesPerFrame);
+		//How much (CPU) memory we can use to keep decoded mip chains around, so that
+		//textures can get more detail without decoding their files again. 0 turns this off.
+		static void SetCacheBudget(size_t bytes);
+		//Textures always keep the mips that are this many pixels (or smaller) resident.
+		static void SetTailSize(int pixels);
+		//The height of the screen in pixels, used to turn on-screen sizes into mip levels.
+		static void SetScreenHeight(int pixels);
+		static int GetScreenHeight();
+
+		//Returns true if there are any streaming textures, so that callers can skip
+		//working out on-screen sizes if nobody needs them.
+		static bool IsActive();
+
+		static Stats GetStats();
+
+		//Stops the background thread and forgets about every texture.
+		//This needs to happen before the GL context goes away - App::Cleanup does it for you.
+		static void Cleanup();
+
+		protected:
+
+		friend class Texture2D;
+
+		//Like App, everything here is static.
+		TextureStreamer() = default;
+
+		//Called when a streaming texture is destroyed.
+		static void Unregister(StreamState* state);
+
+		//Creates the texture a finished load will be uploaded into. Returns false if the load failed.
+		static bool Start(StreamJob& job);
+		//Uploads as much of a load as fits in the budget, swapping in the new texture once it's done.
+		//Returns false if the budget ran out first.
+		static bool Upload(StreamJob& job, size_t& budget);
+		//Works through finished loads, within the per-frame upload budget.
+		static void UploadPending();
+		//Drops the largest resident level of a texture.
+		static void DropLevel(StreamState& state);
+		//Points a texture at a new GL texture holding levels [base, mipCount).
+		static void Replace(StreamState& state, GLuint id, int base);
+	};
+}
@@ -0,0 +1,61 @@
+/*
+NOU Framework - Created for INFR 2310 at Ontario Tech.
+(c) Samantha Stahlke 2020
+
+texturedlit_bindless.frag
+Fragment shader.
+Same as texturedlit.frag, but reads its texture from the material's buffer of
+bindless texture handles (see Material.h), so no texture binding is needed.
+On GPUs without bindless textures, it works like texturedlit.frag instead.
+Uses a fixed directional light grey light with only diffuse and ambient lighting.
+You'll learn a lot about lighting in graphics - this shader just gives us a simple
+way to make sure that everything looks right with our normals, etc.
+*/
+
+#version 420 core
+#extension GL_ARB_bindless_texture : enable
+
+layout(location = 0) in vec4 inPos;
+layout(location = 1) in vec3 inNorm;
+layout(location = 2) in vec2 inUV;
+
+layout(location = 0) out vec4 outColor;
+
+uniform vec3 camPos;
+
+uniform vec3 matColor = vec3(1.0f, 1.0f, 1.0f);
+//Without bindless support, we fall back to a regular sampler, which
+//Material binds to a texture slot like it does for any other shader.
+#ifdef GL_ARB_bindless_texture
+layout(std140, binding = 1) uniform MaterialTextures
+{
+    sampler2D albedo;
+};
+#else
+uniform sampler2D albedo;
+#endif
+
+uniform vec3 lightColor = vec3(0.9f, 0.9f, 0.9f);
+uniform vec3 lightDir = normalize(vec3(-1.0f, -1.0f, -1.0f));
+uniform vec3 ambientColor = vec3(1.0f, 1.0f, 1.0f);
+uniform float ambientPower = 0.2f;
+
+void main()
+{
+    vec3 norm = normalize(inNorm); 
+
+    vec3 eye = normalize(camPos - inPos.xyz);
+    vec3 toLight = -lightDir;
+
+    vec3 avg = normalize(eye + toLight);
+
+    float diffPower = max(dot(norm, toLight), 0.0f);
+    vec3 diff = diffPower * lightColor;
+
+    vec3 ambient = ambientPower * ambientColor;
+
+    vec4 texCol = texture(albedo, inUV);
+    vec3 result = (ambient + diff) * matColor * texCol.rgb;
+
+    outColor = vec4(result, texCol.a);
+}
\ No newline at end of file
@@ -8,6 +8,8 @@ Minimal utility class for GLFW window management.
 
 #include "NOU/App.h"
 #include "NOU/Input.h"
+#include "NOU/Resources.h"
+#include "NOU/TextureStreamer.h"
 
 #define IMGUI_IMPL_OPENGL_LOADER_GLAD
 #include "imgui.h"
@@ -15,6 +17,9 @@ Minimal utility class for GLFW window management.
 #include "imgui_impl_glfw.cpp"
 
 #include "glad/glad.h"
+#include "TTK/GLState.h"
+#include "TTK/AsyncTextureLoader.h"
+#include "Logging.h"
 
 #include <iostream>
 
@@ -28,6 +33,11 @@ namespace nou
 	//Creates our GLFW window.
 	void App::Init(const std::string& name, int width, int height)
 	{
+		//Some of the TTK code we use (like async texture loading) logs through
+		//the TTK logger, so we need to make sure it's been set up. This does
+		//nothing if the app has already set it up itself.
+		Logger::Init();
+
 		if (glfwInit() == GLFW_FALSE)
 		{
 			std::cout << "GLFW init failed!" << std::endl;
@@ -51,6 +61,9 @@ namespace nou
 		
 		m_window = glfwCreateWindow(width, height, name.c_str(), nullptr, nullptr);
 
+		//Streaming textures pick their detail based on how big things are on screen.
+		TextureStreamer::SetScreenHeight(height);
+
 		//This tells OpenGL we want to draw to the window we just created.
 		//If you had multiple windows, you'd be calling this on each one before
 		//making draw calls each frame.
@@ -75,17 +88,17 @@ namespace nou
 		//This one makes it so that we can't draw anything on top of something 
 		//that should be in front of it (e.g., our background doesn't accidentally
 		//get drawn on top of our main character).
-		glEnable(GL_DEPTH_TEST);
+		TTK::GLState::SetDepthTestEnabled(true);
 
 		//This one makes it so that we won't draw the "back faces" of an object.
 		//(In other words, the stuff we wouldn't be able to see for opaque objects anyway.)
-		glEnable(GL_CULL_FACE);
+		TTK::GLState::SetCullEnabled(true);
 
 		//This one controls how semi-transparent objects will be blended.
 		//If you start playing with alpha textures and things don't look right,
 		//or you want a specific behaviour, you'll want to play with these parameters.
-		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		TTK::GLState::SetBlendEnabled(true);
+		TTK::GLState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 		
 		//This initializes the background colour we want to use to clear our window.
 		//This default is black.
@@ -129,6 +142,12 @@ namespace nou
 			ImGui::DestroyContext();
 		}
 
+		//Any textures still loading in the background need the GL context to clean up,
+		//as do any resources we've been sharing.
+		TextureStreamer::Cleanup();
+		TTK::AsyncTextureLoader::DestroyContext();
+		Resources::Cleanup();
+
 		glfwDestroyWindow(m_window);
 		glfwTerminate();
 	}
@@ -157,6 +176,13 @@ namespace nou
 	{
 		//This will post the results of all our draw calls to the window.
 		glfwSwapBuffers(m_window);
+
+		//Give textures loading in the background a slice of this frame to upload.
+		if (TTK::AsyncTextureLoader::IsCreated())
+			TTK::AsyncTextureLoader::Instance().Pump();
+
+		//Stream texture mips in and out, based on what we just drew.
+		TextureStreamer::Update();
 	}
 
 	void App::StartImgui()
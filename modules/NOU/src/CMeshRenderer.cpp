@@ -12,6 +12,7 @@ that we intend the class for use as a component with the ENTT framework.
 
 #include "NOU/CMeshRenderer.h"
 #include "NOU/CCamera.h"
+#include "NOU/TextureStreamer.h"
 
 namespace nou
 {
@@ -20,6 +21,8 @@ namespace nou
 		m_owner = nullptr;
 		m_mat = nullptr;
 		m_vao = nullptr;
+		m_boundsCenter = glm::vec3(0.0f);
+		m_boundsRadius = 0.0f;
 	}
 
 	CMeshRenderer::CMeshRenderer(Entity& owner, 
@@ -40,6 +43,9 @@ namespace nou
 	{
 		const VertexBuffer* vbo;
 
+		m_boundsCenter = mesh.GetBoundsCenter();
+		m_boundsRadius = mesh.GetBoundsRadius();
+
 		if ((vbo = mesh.GetVBO(Mesh::Attrib::POSITION)) != nullptr)
 			m_vao->BindAttrib(*vbo, (GLint)Mesh::Attrib::POSITION);
 
@@ -62,12 +68,43 @@ namespace nou
 		auto& transform = m_owner->transform;
 
 		//We are assuming the names used by uniform shader variables as a convention here.
-		//In a larger project, we would have a more elegant system for registering
-		//or even automatically detecting uniform names.
-		ShaderProgram::Current()->SetUniform("viewproj", CCamera::current->Get<CCamera>().GetVP());
-		ShaderProgram::Current()->SetUniform("model", transform.GetGlobal());
-		ShaderProgram::Current()->SetUniform("normal", transform.GetNormal());
+		//The names are hashed at compile time, so setting them is just a table lookup.
+		static constexpr UniformID viewProjID("viewproj");
+		static constexpr UniformID modelID("model");
+		static constexpr UniformID normalID("normal");
+
+		const ShaderProgram* program = ShaderProgram::Current();
+		program->SetUniform(viewProjID, CCamera::current->Get<CCamera>().GetVP());
+		program->SetUniform(modelID, transform.GetGlobal());
+		program->SetUniform(normalID, transform.GetNormal());
 		
+		//Streaming textures load more detail the bigger they are on screen.
+		if (TextureStreamer::IsActive())
+			m_mat->RequestTextureDetail(GetScreenSize(transform.GetGlobal()));
+
 		m_vao->Draw();
 	}
+
+	float CMeshRenderer::GetScreenSize(const glm::mat4& model)
+	{
+		CCamera& cam = CCamera::current->Get<CCamera>();
+		const glm::mat4& proj = cam.GetProj();
+
+		//Scale our bounding sphere by the largest scale in our transform.
+		glm::vec3 center = glm::vec3(model * glm::vec4(m_boundsCenter, 1.0f));
+		float scale = glm::max(glm::length(glm::vec3(model[0])),
+							   glm::max(glm::length(glm::vec3(model[1])), glm::length(glm::vec3(model[2]))));
+		float radius = m_boundsRadius * scale;
+
+		//proj[1][1] scales view space heights into clip space, where the screen is 2 units tall.
+		//For perspective cameras, things also get smaller the further away they are.
+		float size = 2.0f * radius * proj[1][1];
+		if (proj[2][3] != 0.0f)
+		{
+			float depth = -(cam.GetView() * glm::vec4(center, 1.0f)).z;
+			size /= glm::max(depth, radius);
+		}
+
+		return size * 0.5f * TextureStreamer::GetScreenHeight();
+	}
 }
\ No newline at end of file
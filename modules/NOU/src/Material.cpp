@@ -8,27 +8,101 @@ used by a model.
 */
 
 #include "NOU/Material.h"
+#include "NOU/TextureStreamer.h"
+#include "TTK/GLState.h"
+
+#include <cstring>
 
 namespace nou
 {
+	std::unordered_map<GLuint64, Material::Residency> Material::m_resident;
+	std::unordered_map<GLuint, GLuint64> Material::m_textureHandles;
+
 	Material::Material(const ShaderProgram& program)
 	{
 		m_program = &program;
 		m_curSlot = GL_TEXTURE0;
+		m_bindless = false;
+		m_paramBuffer = 0;
 
 		//Default to white.
 		m_color = glm::vec3(1.0f, 1.0f, 1.0f);
+
+		//If the shader has a block of bindless samplers (and the GPU supports it),
+		//we make a buffer to hold our texture handles, laid out the way the shader expects.
+		GLuint block = glGetProgramResourceIndex(m_program->GetID(), GL_UNIFORM_BLOCK, "MaterialTextures");
+
+		if (IsBindlessSupported() && block != GL_INVALID_INDEX)
+		{
+			GLenum prop = GL_BUFFER_DATA_SIZE;
+			GLint size = 0;
+			glGetProgramResourceiv(m_program->GetID(), GL_UNIFORM_BLOCK, block, 1, &prop, 1, nullptr, &size);
+			glUniformBlockBinding(m_program->GetID(), block, TEXTURE_BLOCK_BINDING);
+
+			m_params.assign(static_cast<size_t>(size), 0);
+			glCreateBuffers(1, &m_paramBuffer);
+			glNamedBufferStorage(m_paramBuffer, size, m_params.data(), GL_DYNAMIC_STORAGE_BIT);
+
+			m_bindless = true;
+		}
+	}
+
+	Material::~Material()
+	{
+		for (auto& h : m_handles)
+			ReleaseHandle(h.handle);
+
+		if (m_paramBuffer != 0)
+		{
+			TTK::GLState::DeleteBuffers(1, &m_paramBuffer);
+		}
+	}
+
+	bool Material::IsBindlessSupported()
+	{
+		return GLAD_GL_ARB_bindless_texture != 0;
 	}
 
 	bool Material::AddTexture(const std::string& name, const Texture2D& tex)
 	{
+		if (m_bindless)
+		{
+			//Find where the shader expects this sampler to be in the block.
+			GLuint index = glGetProgramResourceIndex(m_program->GetID(), GL_UNIFORM, name.c_str());
+			if (index == GL_INVALID_INDEX)
+				return false;
+
+			GLenum props[2] = { GL_OFFSET, GL_BLOCK_INDEX };
+			GLint values[2] = { -1, -1 };
+			glGetProgramResourceiv(m_program->GetID(), GL_UNIFORM, index, 2, props, 2, nullptr, values);
+
+			if (values[1] < 0)
+			{
+				printf("Sampler %s is not in the MaterialTextures block.\n", name.c_str());
+				return false;
+			}
+
+			m_handles.push_back({ values[0], &tex, tex.GetGeneration(), AcquireHandle(tex.GetID()) });
+
+			TexHandle& h = m_handles.back();
+			memcpy(&m_params[h.offset], &h.handle, sizeof(GLuint64));
+			glNamedBufferSubData(m_paramBuffer, h.offset, sizeof(GLuint64), &h.handle);
+
+			return true;
+		}
+
 		if(m_curSlot > MAX_SLOT)
 			return false;
 
 		GLenum slot = m_curSlot;
 		GLint loc = m_program->GetUniformLoc(name);
 
-		m_tex.push_back({ slot, loc, tex.GetID() });
+		m_tex.push_back({ slot, loc, &tex });
+
+		//Samplers take the index of the texture unit (0, 1, 2...),
+		//not the GL_TEXTUREx enum. This only needs to be set once,
+		//so we set it here rather than every time we draw.
+		glProgramUniform1i(m_program->GetID(), loc, (GLint)(slot - GL_TEXTURE0));
 
 		//Keep track of which GL texture slots we've already used for this material.
 		++m_curSlot;
@@ -40,15 +114,96 @@ namespace nou
 	{
 		m_program->Bind();
 
-		m_program->SetUniform("matColor", m_color);
+		static constexpr UniformID colorID("matColor");
+		m_program->SetUniform(colorID, m_color);
+
+		//In bindless mode, all our textures are in one buffer, so switching
+		//materials is a single buffer bind (which we skip if it's already bound).
+		if (m_bindless)
+		{
+			RefreshHandles();
+
+			TTK::GLState::BindUniformBuffer(TEXTURE_BLOCK_BINDING, m_paramBuffer);
+
+			return;
+		}
 
 		//Bind the textures used by this material.
+		//The state cache will skip any that are already bound.
+		for (auto& t : m_tex)
+		{
+			TTK::GLState::BindTexture(t.slot - GL_TEXTURE0, t.tex->GetID());
+		}
+	}
+
+	void Material::RequestTextureDetail(float screenPixels) const
+	{
 		for (auto& t : m_tex)
+			TextureStreamer::RequestSize(*t.tex, screenPixels);
+
+		for (auto& h : m_handles)
+			TextureStreamer::RequestSize(*h.tex, screenPixels);
+	}
+
+	void Material::RefreshHandles()
+	{
+		for (auto& h : m_handles)
+		{
+			if (h.tex->GetGeneration() == h.generation)
+				continue;
+
+			//If the old texture was deleted, its handle has already been released.
+			ReleaseHandle(h.handle);
+			h.generation = h.tex->GetGeneration();
+			h.handle = AcquireHandle(h.tex->GetID());
+
+			memcpy(&m_params[h.offset], &h.handle, sizeof(GLuint64));
+			glNamedBufferSubData(m_paramBuffer, h.offset, sizeof(GLuint64), &h.handle);
+		}
+	}
+
+	GLuint64 Material::AcquireHandle(GLuint texture)
+	{
+		if (texture == 0)
+			return 0;
+
+		//The same texture always gives us the same handle, so materials sharing
+		//a texture share its residency too.
+		GLuint64 handle = glGetTextureHandleARB(texture);
+		Residency& residency = m_resident[handle];
+		if (residency.count++ == 0)
 		{
-			glUniform1i(t.loc, t.slot);
-			glActiveTexture(t.slot - GL_TEXTURE0);
-			glEnable(GL_TEXTURE_2D);
-			glBindTexture(GL_TEXTURE_2D, t.id);
+			glMakeTextureHandleResidentARB(handle);
+			residency.texture = texture;
+			m_textureHandles[texture] = handle;
 		}
+
+		return handle;
+	}
+
+	void Material::ReleaseHandle(GLuint64 handle)
+	{
+		auto it = m_resident.find(handle);
+		if (handle == 0 || it == m_resident.end())
+			return;
+
+		if (--it->second.count == 0)
+		{
+			glMakeTextureHandleNonResidentARB(handle);
+			m_textureHandles.erase(it->second.texture);
+			m_resident.erase(it);
+		}
+	}
+
+	void Material::ReleaseTexture(GLuint texture)
+	{
+		auto it = m_textureHandles.find(texture);
+		if (it == m_textureHandles.end())
+			return;
+
+		//Materials still holding this handle will see it's gone when they release it.
+		glMakeTextureHandleNonResidentARB(it->second);
+		m_resident.erase(it->second);
+		m_textureHandles.erase(it);
 	}
 }
\ No newline at end of file
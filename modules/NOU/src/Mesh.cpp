@@ -14,18 +14,69 @@ namespace nou
 	{
 		m_verts = verts;
 		SetVBO(Attrib::POSITION, 3, m_verts);
+
+		//Our bounding sphere is centred on the middle of the mesh's bounding box.
+		//It isn't the tightest possible sphere, but it's quick to find.
+		if (m_verts.empty())
+		{
+			m_boundsCenter = glm::vec3(0.0f);
+			m_boundsRadius = 0.0f;
+			return;
+		}
+
+		glm::vec3 min = m_verts[0], max = m_verts[0];
+		for (const auto& v : m_verts)
+		{
+			min = glm::min(min, v);
+			max = glm::max(max, v);
+		}
+
+		m_boundsCenter = (min + max) * 0.5f;
+		m_boundsRadius = 0.0f;
+		for (const auto& v : m_verts)
+			m_boundsRadius = glm::max(m_boundsRadius, glm::length(v - m_boundsCenter));
 	}
 
+	//Normals only need to store a direction, so we pack each one into
+	//a single 32-bit value (10 bits per axis) instead of 3 floats.
+	//OpenGL unpacks these for us, so shaders still just see a vec3.
 	void Mesh::SetNormals(const std::vector<glm::vec3>& normals)
 	{
 		m_normals = normals;
-		SetVBO(Attrib::NORMAL, 3, m_normals);			
+
+		std::vector<uint32_t> packed;
+		packed.reserve(m_normals.size());
+		for (const auto& n : m_normals)
+			packed.push_back(TTK::PackSnorm1010102(n));
+
+		SetVBO(Attrib::NORMAL, TTK::VertexLayout().Snorm1010102(0), packed);
 	}
 
-	void Mesh::SetUVs(const std::vector<glm::vec2>& uvs)
+	//UVs are stored as regular floats unless you ask for half floats.
+	//Half floats halve the size of the buffer, but lose precision quickly as
+	//UVs get bigger (e.g., on tiled textures), so they're only worth it for
+	//UVs that stay close to the (0, 1) range.
+	void Mesh::SetUVs(const std::vector<glm::vec2>& uvs, bool halfPrecision)
 	{
 		m_uvs = uvs;
-		SetVBO(Attrib::UV, 2, m_uvs);
+
+		//The buffer's layout can't change once it's made, so switching formats needs a new one.
+		if (halfPrecision != m_halfUVs)
+			m_vbo.erase(Attrib::UV);
+		m_halfUVs = halfPrecision;
+
+		if (!halfPrecision)
+		{
+			SetVBO(Attrib::UV, 2, m_uvs);
+			return;
+		}
+
+		std::vector<uint32_t> packed;
+		packed.reserve(m_uvs.size());
+		for (const auto& uv : m_uvs)
+			packed.push_back(TTK::PackHalf2(uv));
+
+		SetVBO(Attrib::UV, TTK::VertexLayout().Half(0, 2), packed);
 	}
 
 	const VertexBuffer* Mesh::GetVBO(Mesh::Attrib attrib) const
@@ -0,0 +1,68 @@
+/*
+NOU Framework - Created for INFR 2310 at Ontario Tech.
+(c) Samantha Stahlke 2020
+
+Resources.cpp
+Shared loading for textures, meshes and shaders, so that each
+file is only loaded once no matter how many objects use it.
+*/
+
+#include "NOU/Resources.h"
+#include "NOU/GLTFLoader.h"
+
+namespace nou
+{
+	std::shared_ptr<Texture2D> Resources::LoadTexture(const std::string& filename, bool useNearest,
+													  MipFilter mips, bool sRGB)
+	{
+		//The import options are part of the key, since the same file loaded with
+		//different options is a different texture on the GPU.
+		return TextureRegistry::Instance().Load(filename, useNearest, mips, sRGB);
+	}
+
+	std::shared_ptr<Mesh> Resources::LoadMesh(const std::string& filename, bool flipUVY)
+	{
+		//Meshes are filled in by the glTF loader rather than constructed from a path,
+		//so we tell the registry how to load one ourselves.
+		return MeshRegistry::Instance().LoadCustom(filename, MeshRegistry::MakeOptionsKey(flipUVY),
+			[flipUVY](const std::string& file) -> std::shared_ptr<Mesh>
+			{
+				auto mesh = std::make_shared<Mesh>();
+				GLTF::LoadMesh(file, *mesh, flipUVY);
+
+				//The glTF loader leaves the mesh empty if it fails. We don't want to keep
+				//an empty mesh around (a typo shouldn't stick until everything is unloaded),
+				//so we tell the registry it failed instead.
+				if (mesh->GetVBO(Mesh::Attrib::POSITION) == nullptr)
+					return nullptr;
+
+				return mesh;
+			});
+	}
+
+	std::shared_ptr<Shader> Resources::LoadShader(const std::string& filename, GLenum shaderType)
+	{
+		return ShaderRegistry::Instance().Load(filename, shaderType);
+	}
+
+	size_t Resources::UnloadUnused()
+	{
+		size_t count = 0;
+
+		if (TextureRegistry::IsCreated())
+			count += TextureRegistry::Instance().UnloadUnused();
+		if (MeshRegistry::IsCreated())
+			count += MeshRegistry::Instance().UnloadUnused();
+		if (ShaderRegistry::IsCreated())
+			count += ShaderRegistry::Instance().UnloadUnused();
+
+		return count;
+	}
+
+	void Resources::Cleanup()
+	{
+		TextureRegistry::DestroyContext();
+		MeshRegistry::DestroyContext();
+		ShaderRegistry::DestroyContext();
+	}
+}
@@ -9,6 +9,7 @@ Utility classes for managing OpenGL shaders and shader programs.
 #include "NOU/Shader.h"
 
 #include "GLM/glm.hpp"
+#include "TTK/GLState.h"
 
 #include <iostream>
 #include <fstream>
@@ -148,7 +149,10 @@ namespace nou
 
 		//Provide feedback on the program's linking.
 		if (result)
+		{
 			printf("Linked shader program successfully.\n");
+			ReflectUniforms();
+		}
 		else
 		{
 			GLint buflen = 0;
@@ -173,7 +177,8 @@ namespace nou
 
 	void ShaderProgram::Bind() const
 	{
-		glUseProgram(m_id);
+		//The state cache skips the call to OpenGL if we're already bound.
+		TTK::GLState::UseProgram(m_id);
 		m_current = this;
 	}
 
@@ -182,50 +187,132 @@ namespace nou
 		return m_current;
 	}
 
-	GLint ShaderProgram::GetUniformLoc(const std::string& name) const
+	void ShaderProgram::ReflectUniforms()
 	{
-		return glGetUniformLocation(m_id, name.c_str());
+		GLint count = 0;
+		glGetProgramInterfaceiv(m_id, GL_UNIFORM, GL_ACTIVE_RESOURCES, &count);
+
+		std::vector<std::pair<std::string, GLint>> found;
+
+		const GLenum props[] = { GL_NAME_LENGTH, GL_LOCATION, GL_ARRAY_SIZE };
+
+		for (GLint i = 0; i < count; ++i)
+		{
+			GLint values[3];
+			glGetProgramResourceiv(m_id, GL_UNIFORM, i, 3, props, 3, nullptr, values);
+
+			//Uniforms inside of blocks don't have a location - they're set through buffers.
+			if (values[1] < 0)
+				continue;
+
+			//The name length includes the null terminator.
+			std::string name(values[0], '\0');
+			glGetProgramResourceName(m_id, GL_UNIFORM, i, values[0], nullptr, &name[0]);
+			name.resize(values[0] - 1);
+
+			found.push_back({ name, values[1] });
+
+			//Arrays are listed once as "name[0]", but can be set using their
+			//plain name or any element, whose locations follow on from the first.
+			if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+			{
+				std::string base = name.substr(0, name.size() - 3);
+				found.push_back({ base, values[1] });
+
+				for (GLint j = 1; j < values[2]; ++j)
+					found.push_back({ base + "[" + std::to_string(j) + "]", values[1] + j });
+			}
+		}
+
+		//Keeping the table at most half full means lookups almost never have to search.
+		size_t size = 16;
+		while (size < found.size() * 2)
+			size *= 2;
+
+		m_uniforms.assign(size, { 0, -1 });
+
+		for (auto& uniform : found)
+			AddUniform(UniformID::Hash(uniform.first.c_str()), uniform.second, uniform.first);
+	}
+
+	void ShaderProgram::AddUniform(uint32_t hash, GLint loc, const std::string& name)
+	{
+		size_t mask = m_uniforms.size() - 1;
+
+		for (size_t i = hash & mask; ; i = (i + 1) & mask)
+		{
+			UniformSlot& slot = m_uniforms[i];
+
+			if (slot.loc < 0)
+			{
+				slot = { hash, loc };
+				return;
+			}
+
+			if (slot.hash == hash)
+			{
+				printf("Uniform %s has the same name hash as another uniform and can't be used.\n", name.c_str());
+				return;
+			}
+		}
+	}
+
+	GLint ShaderProgram::GetUniformLoc(UniformID id) const
+	{
+		if (m_uniforms.empty())
+			return -1;
+
+		size_t mask = m_uniforms.size() - 1;
+
+		//Empty slots have a location of -1, so if we hit one the uniform isn't in the program.
+		for (size_t i = id.hash & mask; ; i = (i + 1) & mask)
+		{
+			const UniformSlot& slot = m_uniforms[i];
+
+			if (slot.loc < 0 || slot.hash == id.hash)
+				return slot.loc;
+		}
 	}
 
 	template<>
-	void ShaderProgram::SetUniform<int>(const std::string& name, const int& value) const
+	void ShaderProgram::SetUniform<int>(UniformID id, const int& value) const
 	{
-		glUniform1i(GetUniformLoc(name), value);
+		glUniform1i(GetUniformLoc(id), value);
 	}
 
 	template<>
-	void ShaderProgram::SetUniform<float>(const std::string& name, const float& value) const
+	void ShaderProgram::SetUniform<float>(UniformID id, const float& value) const
 	{
-		glUniform1f(GetUniformLoc(name), value);
+		glUniform1f(GetUniformLoc(id), value);
 	}
 
 	template<>
-	void ShaderProgram::SetUniform<glm::mat4>(const std::string& name, const glm::mat4& value) const
+	void ShaderProgram::SetUniform<glm::mat4>(UniformID id, const glm::mat4& value) const
 	{
-		glUniformMatrix4fv(GetUniformLoc(name), 1, GL_FALSE, &value[0][0]);
+		glUniformMatrix4fv(GetUniformLoc(id), 1, GL_FALSE, &value[0][0]);
 	}
 
 	template<>
-	void ShaderProgram::SetUniform<glm::mat3>(const std::string& name, const glm::mat3& value) const
+	void ShaderProgram::SetUniform<glm::mat3>(UniformID id, const glm::mat3& value) const
 	{
-		glUniformMatrix3fv(GetUniformLoc(name), 1, GL_FALSE, &value[0][0]);
+		glUniformMatrix3fv(GetUniformLoc(id), 1, GL_FALSE, &value[0][0]);
 	}
 
 	template<>
-	void ShaderProgram::SetUniform<glm::vec4>(const std::string& name, const glm::vec4& value) const
+	void ShaderProgram::SetUniform<glm::vec4>(UniformID id, const glm::vec4& value) const
 	{
-		glUniform4fv(GetUniformLoc(name), 1, &(value.x));
+		glUniform4fv(GetUniformLoc(id), 1, &(value.x));
 	}
 
 	template<>
-	void ShaderProgram::SetUniform<glm::vec3>(const std::string& name, const glm::vec3& value) const
+	void ShaderProgram::SetUniform<glm::vec3>(UniformID id, const glm::vec3& value) const
 	{
-		glUniform3fv(GetUniformLoc(name), 1, &(value.x));
+		glUniform3fv(GetUniformLoc(id), 1, &(value.x));
 	}
 
 	template<>
-	void ShaderProgram::SetUniformArray<glm::mat4>(const std::string& name, glm::mat4* data, int len) const
+	void ShaderProgram::SetUniformArray<glm::mat4>(UniformID id, glm::mat4* data, int len) const
 	{
-		glUniformMatrix4fv(GetUniformLoc(name), len, GL_FALSE, (GLfloat*)data);
+		glUniformMatrix4fv(GetUniformLoc(id), len, GL_FALSE, (GLfloat*)data);
 	}
-}
+}
\ No newline at end of file
@@ -9,60 +9,213 @@ Simple wrapper for STB image loading into 2D textures.
 #include "NOU/Texture.h"
 
 #include "stb_image.h"
+#include "TTK/GLState.h"
+#include "TTK/AsyncTextureLoader.h"
+#include "NOU/TextureStreamer.h"
+#include "NOU/Material.h"
+
+#include <cstring>
+#include <vector>
 
 namespace nou
 {
-	Texture2D::Texture2D(const std::string& filename, bool useNearest)
+	Texture2D::Texture2D()
 	{
-		int channels;
+		m_id = 0;
 		m_width = 0;
 		m_height = 0;
+		m_loadHandle = 0;
+		m_generation = 0;
+		m_isPlaceholder = false;
+		m_streamState = nullptr;
+	}
 
-		//If your textures are all upside down, you'd want to switch this to false.
-		//The TLDR here is that many image file formats specify textures from the top
-		//down, but OpenGL uses a bottom origin for vertical coordinates.
-		//Yes, this is annoying. And it isn't the only place you can have this problem.
-		//If a texture is mucked up, flipping the Y coordinate might be a good first 
-		//troubleshooting step.
-		stbi_set_flip_vertically_on_load(true);
-
-		unsigned char* data = stbi_load(filename.c_str(),
-										&m_width, &m_height, &channels, STBI_rgb_alpha);
+	Texture2D::Texture2D(const std::string& filename, bool useNearest, MipFilter mips, bool sRGB)
+	{
+		int channels;
+		m_width = 0;
+		m_height = 0;
+		m_loadHandle = 0;
+		m_generation = 0;
+		m_isPlaceholder = false;
+		m_streamState = nullptr;
 
 		//Generate a new OpenGL texture.
-		glGenTextures(1, &m_id);
-		//Bind the texture to specify we want to change its properties/data.
-		glBindTexture(GL_TEXTURE_2D, m_id);
+		//We use the "direct state access" functions here, which let us
+		//change the texture without binding it (so we don't mess with
+		//whatever textures are currently bound for drawing).
+		glCreateTextures(GL_TEXTURE_2D, 1, &m_id);
 
 		//Sets our texture to repeat if accessed outside the (0, 1) texture
 		//coordinate interval.
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		glTextureParameteri(m_id, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTextureParameteri(m_id, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+		int levelCount = 0;
+
+		//Pre-compressed textures go straight to the GPU, and stay compressed there.
+		//(BC1 takes 1/8th the memory of RGBA8, and the others 1/4.)
+		//These get flipped the same way as the images below - see LoadCompressedImage.
+		if (IsCompressedImageFile(filename))
+		{
+			CompressedImage image;
+
+			if (LoadCompressedImage(filename, image))
+			{
+				UploadCompressed(image);
+				levelCount = static_cast<int>(image.levels.size());
+			}
+			else
+				printf("Failed to load texture %s.\n", filename.c_str());
+		}
+		else
+		{
+			//If your textures are all upside down, you'd want to switch this to false.
+			//The TLDR here is that many image file formats specify textures from the top
+			//down, but OpenGL uses a bottom origin for vertical coordinates.
+			//Yes, this is annoying. And it isn't the only place you can have this problem.
+			//If a texture is mucked up, flipping the Y coordinate might be a good first 
+			//troubleshooting step.
+			//We flip the rows ourselves rather than using stbi_set_flip_vertically_on_load,
+			//since that setting is global and would affect images being decoded in the background.
+			unsigned char* data = stbi_load(filename.c_str(),
+											&m_width, &m_height, &channels, STBI_rgb_alpha);
+
+			if (data != nullptr)
+			{
+				FlipRows(data, m_width, m_height, 4);
+
+				//Without mipmaps, far away (minified) textures skip over texels and shimmer,
+				//and they're slower to sample since they thrash the texture cache.
+				std::vector<MipLevel> levels = GenerateMips(data, m_width, m_height, mips, sRGB);
+				UploadMips(levels);
+				levelCount = static_cast<int>(levels.size());
+			}
+			else
+				printf("Failed to load texture %s.\n", filename.c_str());
+
+			//Very important - after we send our data to OpenGL, make sure to free the memory
+			//used by STBI!
+			stbi_image_free(data);
+		}
 
 		//Sets up a linear (smooth) filter for interpolating our texture
 		//when displaying it smaller or larger (e.g., on a faraway or close-up object).
+		//If we have mips, we also blend between the two closest mip levels (trilinear filtering).
 		if (useNearest)
 		{
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			glTextureParameteri(m_id, GL_TEXTURE_MIN_FILTER, levelCount > 1 ? GL_NEAREST_MIPMAP_NEAREST : GL_NEAREST);
+			glTextureParameteri(m_id, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 		}
 		else
 		{
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTextureParameteri(m_id, GL_TEXTURE_MIN_FILTER, levelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+			glTextureParameteri(m_id, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		}
+	}
+
+	//Allocates storage for every level at once, and then fills in each one.
+	void Texture2D::UploadMips(const std::vector<MipLevel>& levels)
+	{
+		glTextureStorage2D(m_id, static_cast<GLsizei>(levels.size()), GL_RGBA8, m_width, m_height);
+
+		for (size_t i = 0; i < levels.size(); ++i)
+		{
+			glTextureSubImage2D(m_id, static_cast<GLint>(i), 0, 0, levels[i].width, levels[i].height,
+								GL_RGBA, GL_UNSIGNED_BYTE, levels[i].data.data());
+		}
+	}
+
+	//Compressed data is uploaded block-for-block - the GPU decompresses it as it samples.
+	void Texture2D::UploadCompressed(const CompressedImage& image)
+	{
+		m_width = image.width;
+		m_height = image.height;
+
+		glTextureStorage2D(m_id, static_cast<GLsizei>(image.levels.size()), image.format, m_width, m_height);
+
+		for (size_t i = 0; i < image.levels.size(); ++i)
+		{
+			const MipLevel& level = image.levels[i];
+			glCompressedTextureSubImage2D(m_id, static_cast<GLint>(i), 0, 0, level.width, level.height,
+										  image.format, static_cast<GLsizei>(level.data.size()), level.data.data());
+		}
+	}
+
+	std::unique_ptr<Texture2D> Texture2D::LoadAsync(const std::string& filename, bool useNearest,
+													MipFilter mips, bool sRGB,
+													std::function<void(Texture2D&, bool)> onLoaded)
+	{
+		std::unique_ptr<Texture2D> tex(new Texture2D());
+		Texture2D* self = tex.get();
+
+		//Until the real texture is ready, we point at the loader's shared placeholder.
+		TTK::AsyncTextureLoader& loader = TTK::AsyncTextureLoader::Instance();
+		tex->m_id = loader.GetPlaceholder();
+		tex->m_isPlaceholder = true;
+
+		GLenum filter = useNearest ? GL_NEAREST : GL_LINEAR;
+
+		//Mips are built on the loader's worker threads, since filtering a big image takes a while.
+		TTK::AsyncTextureLoader::MipGenerator generateMips = nullptr;
+		if (mips != MipFilter::None)
+		{
+			generateMips = [mips, sRGB](const uint8_t* pixels, int width, int height)
+			{
+				std::vector<MipLevel> levels = GenerateMips(pixels, width, height, mips, sRGB);
+
+				//The loader already has level 0 (it's the image itself), so we only hand back the rest.
+				std::vector<TTK::AsyncTextureLoader::MipLevel> result;
+				for (size_t i = 1; i < levels.size(); ++i)
+					result.push_back({ levels[i].width, levels[i].height, std::move(levels[i].data) });
+
+				return result;
+			};
 		}
 
-		//Specifies our image data as the source data for the new texture.
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, m_width, m_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+		//The loader owns decoding and uploading - we just swap in the finished texture.
+		//(The flip is the same one our regular constructor does.)
+		TTK::AsyncTextureLoader::Ticket ticket = loader.Load(filename,
+			[self, filename, onLoaded](const TTK::AsyncTextureLoader::LoadedTexture& result)
+			{
+				self->m_loadHandle = 0;
+
+				if (result.Success)
+				{
+					self->m_id = result.Texture;
+					self->m_isPlaceholder = false;
+					++self->m_generation;
+					self->m_width = result.Width;
+					self->m_height = result.Height;
+				}
+				else
+					printf("Failed to load texture %s.\n", filename.c_str());
 
-		//Very important - after we send our data to OpenGL, make sure to free the memory
-		//used by STBI!
-		stbi_image_free(data);
+				if (onLoaded)
+					onLoaded(*self, result.Success);
+			}, true, filter, GL_REPEAT, generateMips);
+
+		tex->m_loadHandle = ticket.Id;
+
+		return tex;
 	}
 
 	Texture2D::~Texture2D()
 	{
-		glDeleteTextures(1, &m_id);
+		//Streaming textures need to tell the streamer they're gone.
+		if (m_streamState != nullptr)
+			TextureStreamer::Unregister(m_streamState);
+
+		//If we're still loading, make sure the loader doesn't call back into us.
+		if (m_loadHandle != 0 && TTK::AsyncTextureLoader::IsCreated())
+			TTK::AsyncTextureLoader::Instance().Cancel(m_loadHandle);
+
+		//The placeholder is shared, so it isn't ours to delete.
+		if (!m_isPlaceholder)
+		{
+			Material::ReleaseTexture(m_id);
+			TTK::GLState::DeleteTextures(1, &m_id);
+		}
 	}
 
 	GLuint Texture2D::GetID() const
@@ -75,4 +228,9 @@ namespace nou
 		width = m_width;
 		height = m_height;
 	}
+
+	bool Texture2D::IsLoaded() const
+	{
+		return m_loadHandle == 0;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,589 @@
+/*
+NOU Framework - Created for INFR 2310 at Ontario Tech.
+(c) Samantha Stahlke 2020
+
+TextureData.cpp
+CPU-side helpers for preparing texture data - building mip chains,
+and reading pre-compressed (BCn) textures from DDS and KTX2 files.
+*/
+
+#include "NOU/TextureData.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+//The S3TC (BC1-3) formats are an extension rather than core GL,
+//so our GL loader doesn't define them for us.
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+namespace nou
+{
+	//--- Mip generation ---
+
+	//The Kaiser filter looks at 6 texels of the larger level for each texel of the smaller one.
+	static const int KAISER_TAPS = 6;
+	static const float KAISER_ALPHA = 4.0f;
+	static const float KAISER_HALF_WIDTH = 1.5f;
+
+	//Modified Bessel function of the first kind, which shapes the Kaiser window.
+	static float BesselI0(float x)
+	{
+		float sum = 1.0f, term = 1.0f;
+		for (int k = 1; k < 32; ++k)
+		{
+			term *= (x * 0.5f / k) * (x * 0.5f / k);
+			sum += term;
+			if (term < sum * 1e-7f)
+				break;
+		}
+		return sum;
+	}
+
+	//Since we always halve the size, the filter weights are the same for every texel.
+	static std::array<float, KAISER_TAPS> ComputeKaiserWeights()
+	{
+		const float pi = 3.14159265f;
+		std::array<float, KAISER_TAPS> weights;
+		float total = 0.0f;
+
+		for (int k = 0; k < KAISER_TAPS; ++k)
+		{
+			//Distance from the centre of the smaller texel, measured in smaller texels.
+			float t = (k - 2.5f) * 0.5f;
+			float sinc = std::sin(pi * t) / (pi * t);
+			float r = t / KAISER_HALF_WIDTH;
+			float window = BesselI0(KAISER_ALPHA * std::sqrt(std::max(0.0f, 1.0f - r * r))) / BesselI0(KAISER_ALPHA);
+			weights[k] = sinc * window;
+			total += weights[k];
+		}
+
+		for (int k = 0; k < KAISER_TAPS; ++k)
+			weights[k] /= total;
+
+		return weights;
+	}
+
+	//Mips are built on worker threads, so the weights are worked out in a (thread-safe) static initializer.
+	static const float* GetKaiserWeights()
+	{
+		static const std::array<float, KAISER_TAPS> weights = ComputeKaiserWeights();
+		return weights.data();
+	}
+
+	static float SRGBToLinear(float c)
+	{
+		return (c <= 0.04045f) ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+	}
+
+	static unsigned char LinearToByte(float c, bool sRGB)
+	{
+		c = std::min(std::max(c, 0.0f), 1.0f);
+		if (sRGB)
+			c = (c <= 0.0031308f) ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+		return static_cast<unsigned char>(c * 255.0f + 0.5f);
+	}
+
+	//Shrinks an RGBA float image to half size along one axis.
+	static void Downsample1D(const std::vector<float>& src, std::vector<float>& dst,
+							 int width, int height, bool horizontal, MipFilter filter)
+	{
+		int newWidth = horizontal ? std::max(1, width / 2) : width;
+		int newHeight = horizontal ? height : std::max(1, height / 2);
+		int srcLength = horizontal ? width : height;
+
+		dst.assign(static_cast<size_t>(newWidth) * newHeight * 4, 0.0f);
+
+		const float* weights = filter == MipFilter::Kaiser ? GetKaiserWeights() : nullptr;
+
+		for (int y = 0; y < newHeight; ++y)
+		{
+			for (int x = 0; x < newWidth; ++x)
+			{
+				float* out = &dst[(static_cast<size_t>(y) * newWidth + x) * 4];
+				int i = horizontal ? x : y;
+
+				//Helper for reading from the source, clamping at the edges.
+				auto sample = [&](int s, float weight)
+				{
+					s = std::min(std::max(s, 0), srcLength - 1);
+					int sx = horizontal ? s : x;
+					int sy = horizontal ? y : s;
+					const float* in = &src[(static_cast<size_t>(sy) * width + sx) * 4];
+					for (int c = 0; c < 4; ++c)
+						out[c] += in[c] * weight;
+				};
+
+				if (srcLength == 1)
+					sample(0, 1.0f);
+				else if (filter == MipFilter::Kaiser)
+				{
+					for (int k = 0; k < KAISER_TAPS; ++k)
+						sample(2 * i - 2 + k, weights[k]);
+				}
+				else
+				{
+					sample(2 * i, 0.5f);
+					sample(2 * i + 1, 0.5f);
+				}
+			}
+		}
+	}
+
+	void FlipRows(unsigned char* data, int width, int height, int pixelSize)
+	{
+		size_t rowSize = static_cast<size_t>(width) * pixelSize;
+		std::vector<unsigned char> row(rowSize);
+
+		for (int y = 0; y < height / 2; ++y)
+		{
+			unsigned char* top = data + y * rowSize;
+			unsigned char* bottom = data + (height - 1 - y) * rowSize;
+			memcpy(row.data(), top, rowSize);
+			memcpy(top, bottom, rowSize);
+			memcpy(bottom, row.data(), rowSize);
+		}
+	}
+
+	int GetMipCount(int width, int height)
+	{
+		int levels = 1;
+		int size = std::max(width, height);
+
+		while (size > 1)
+		{
+			size /= 2;
+			++levels;
+		}
+
+		return levels;
+	}
+
+	std::vector<MipLevel> GenerateMips(const unsigned char* rgba, int width, int height,
+									   MipFilter filter, bool sRGB)
+	{
+		std::vector<MipLevel> levels;
+
+		//Level 0 is just the original image.
+		levels.push_back({ width, height, std::vector<unsigned char>(rgba, rgba + static_cast<size_t>(width) * height * 4) });
+
+		if (filter == MipFilter::None)
+			return levels;
+
+		//We filter in floating point so that rounding errors don't build up as we go down the chain.
+		//Colour channels are converted to linear space first, but alpha is always linear.
+		float toLinear[256];
+		for (int i = 0; i < 256; ++i)
+			toLinear[i] = sRGB ? SRGBToLinear(i / 255.0f) : i / 255.0f;
+
+		std::vector<float> current(static_cast<size_t>(width) * height * 4);
+		for (size_t i = 0; i < current.size(); ++i)
+			current[i] = ((i & 3) == 3) ? rgba[i] / 255.0f : toLinear[rgba[i]];
+
+		std::vector<float> temp;
+		int levelCount = GetMipCount(width, height);
+
+		for (int level = 1; level < levelCount; ++level)
+		{
+			//Both filters are separable, so we shrink horizontally and then vertically.
+			Downsample1D(current, temp, width, height, true, filter);
+			width = std::max(1, width / 2);
+			Downsample1D(temp, current, width, height, false, filter);
+			height = std::max(1, height / 2);
+
+			MipLevel mip = { width, height, std::vector<unsigned char>(current.size()) };
+			for (size_t i = 0; i < current.size(); ++i)
+				mip.data[i] = LinearToByte(current[i], sRGB && (i & 3) != 3);
+
+			levels.push_back(std::move(mip));
+		}
+
+		return levels;
+	}
+
+	//--- Compressed containers ---
+
+	//DDS and KTX2 files store the top row first, but OpenGL wants the bottom row first
+	//(just like the PNGs we flip in Texture2D). For most formats, we can flip a block
+	//without decoding it, by reversing the rows of indices inside it.
+
+	//BC1 colour blocks have two endpoint colours, then one byte of 2-bit indices per row.
+	static void FlipColorBlock(unsigned char* block, int rows)
+	{
+		for (int i = 0; i < rows / 2; ++i)
+			std::swap(block[4 + i], block[4 + rows - 1 - i]);
+	}
+
+	//BC3 alpha blocks (and each BC5 channel) have two endpoints, then 48 bits of
+	//3-bit indices - 12 bits per row.
+	static void FlipAlphaBlock(unsigned char* block, int rows)
+	{
+		uint64_t bits = 0;
+		for (int i = 0; i < 6; ++i)
+			bits |= static_cast<uint64_t>(block[2 + i]) << (8 * i);
+
+		uint64_t flipped = bits;
+		for (int i = 0; i < rows; ++i)
+		{
+			uint64_t row = (bits >> (12 * (rows - 1 - i))) & 0xFFF;
+			flipped &= ~(static_cast<uint64_t>(0xFFF) << (12 * i));
+			flipped |= row << (12 * i);
+		}
+
+		for (int i = 0; i < 6; ++i)
+			block[2 + i] = static_cast<unsigned char>(flipped >> (8 * i));
+	}
+
+	static void FlipBC1(unsigned char* block, int rows)
+	{
+		FlipColorBlock(block, rows);
+	}
+
+	static void FlipBC3(unsigned char* block, int rows)
+	{
+		FlipAlphaBlock(block, rows);
+		FlipColorBlock(block + 8, rows);
+	}
+
+	static void FlipBC5(unsigned char* block, int rows)
+	{
+		FlipAlphaBlock(block, rows);
+		FlipAlphaBlock(block + 8, rows);
+	}
+
+	//How GL names a block-compressed format, how many bytes each 4x4 block takes,
+	//and how to flip a block upside down.
+	struct BlockFormat
+	{
+		GLenum format;
+		int blockSize;
+		//BC7 blocks can be split up in too many ways to flip them without re-encoding.
+		void (*flipBlock)(unsigned char* block, int rows);
+	};
+
+	static const BlockFormat BC1 = { GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 8, FlipBC1 };
+	static const BlockFormat BC3 = { GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 16, FlipBC3 };
+	static const BlockFormat BC5 = { GL_COMPRESSED_RG_RGTC2, 16, FlipBC5 };
+	static const BlockFormat BC5_SNORM = { GL_COMPRESSED_SIGNED_RG_RGTC2, 16, FlipBC5 };
+	static const BlockFormat BC7 = { GL_COMPRESSED_RGBA_BPTC_UNORM, 16, nullptr };
+
+	//Note that for the sRGB variants of each format, we still use the plain (UNORM) GL format.
+	//NOU doesn't render in linear space, so this way compressed textures look the same as PNGs.
+
+	//Maps a DXGI_FORMAT (from a DDS DX10 header) to a GL format.
+	static bool FromDXGI(uint32_t dxgi, BlockFormat& out)
+	{
+		switch (dxgi)
+		{
+			case 70: case 71: case 72: out = BC1; return true;
+			case 76: case 77: case 78: out = BC3; return true;
+			case 82: case 83: out = BC5; return true;
+			case 84: out = BC5_SNORM; return true;
+			case 97: case 98: case 99: out = BC7; return true;
+			default: return false;
+		}
+	}
+
+	//Maps a VkFormat (from a KTX2 header) to a GL format.
+	static bool FromVulkan(uint32_t vkFormat, BlockFormat& out)
+	{
+		switch (vkFormat)
+		{
+			case 131: case 132: case 133: case 134: out = BC1; return true;
+			case 137: case 138: out = BC3; return true;
+			case 141: out = BC5; return true;
+			case 142: out = BC5_SNORM; return true;
+			case 145: case 146: out = BC7; return true;
+			default: return false;
+		}
+	}
+
+	static size_t GetLevelSize(int width, int height, int blockSize)
+	{
+		size_t blocksX = std::max(1, (width + 3) / 4);
+		size_t blocksY = std::max(1, (height + 3) / 4);
+		return blocksX * blocksY * blockSize;
+	}
+
+	//Flips every level of a top-down image so that the bottom row comes first.
+	//If the image can't be flipped, we print a warning and leave it upside down
+	//rather than failing the texture.
+	static void FlipImage(const std::string& filename, const BlockFormat& format, CompressedImage& image)
+	{
+		if (format.flipBlock == nullptr)
+		{
+			printf("Warning: %s is a top-down BC7 texture, which can't be flipped for OpenGL, so it will appear upside down. "
+				   "Re-export it bottom-up (as a KTX2 file with KTXorientation \"ru\") to fix this.\n", filename.c_str());
+			return;
+		}
+
+		//If a level isn't a whole number of blocks tall, flipping it would move rows
+		//across block boundaries. That only works when there's a single row of blocks.
+		//We check every level before touching any of them, so we never flip only part of the chain.
+		for (const MipLevel& level : image.levels)
+		{
+			if (level.height > 4 && level.height % 4 != 0)
+			{
+				printf("Warning: %s has a level that isn't a multiple of 4 tall, so it can't be flipped "
+					   "for OpenGL and will appear upside down.\n", filename.c_str());
+				return;
+			}
+		}
+
+		for (MipLevel& level : image.levels)
+		{
+			int blocksX = std::max(1, (level.width + 3) / 4);
+			int blocksY = std::max(1, (level.height + 3) / 4);
+			int rows = blocksY == 1 ? level.height : 4;
+			size_t rowBytes = static_cast<size_t>(blocksX) * format.blockSize;
+			unsigned char* data = level.data.data();
+
+			//Swap whole rows of blocks, then flip the rows within each block.
+			for (int y = 0; y < blocksY / 2; ++y)
+				std::swap_ranges(data + y * rowBytes, data + (y + 1) * rowBytes, data + (blocksY - 1 - y) * rowBytes);
+
+			for (size_t block = 0; block < static_cast<size_t>(blocksX) * blocksY; ++block)
+				format.flipBlock(data + block * format.blockSize, rows);
+		}
+	}
+
+	static bool ReadFile(const std::string& filename, std::vector<unsigned char>& bytes)
+	{
+		std::ifstream reader(filename, std::ios::in | std::ios::binary | std::ios::ate);
+		if (!reader)
+			return false;
+
+		std::streamsize size = reader.tellg();
+		reader.seekg(0, std::ios::beg);
+		bytes.resize(static_cast<size_t>(size));
+		return static_cast<bool>(reader.read(reinterpret_cast<char*>(bytes.data()), size));
+	}
+
+	template<typename T>
+	static T ReadAt(const std::vector<unsigned char>& bytes, size_t offset)
+	{
+		T value = 0;
+		if (offset + sizeof(T) <= bytes.size())
+			memcpy(&value, bytes.data() + offset, sizeof(T));
+		return value;
+	}
+
+	static const unsigned char KTX2_ID[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+	static bool LoadDDS(const std::string& filename, const std::vector<unsigned char>& bytes, CompressedImage& image)
+	{
+		//"DDS " followed by a 124 byte header, and optionally a 20 byte DX10 header.
+		const size_t HEADER_SIZE = 4 + 124;
+		if (bytes.size() < HEADER_SIZE)
+		{
+			printf("DDS file %s is truncated.\n", filename.c_str());
+			return false;
+		}
+
+		int height = static_cast<int>(ReadAt<uint32_t>(bytes, 12));
+		int width = static_cast<int>(ReadAt<uint32_t>(bytes, 16));
+		int mipCount = std::max(1, static_cast<int>(ReadAt<uint32_t>(bytes, 28)));
+		uint32_t fourCC = ReadAt<uint32_t>(bytes, 84);
+
+		if (width <= 0 || height <= 0)
+		{
+			printf("DDS file %s has an invalid size.\n", filename.c_str());
+			return false;
+		}
+
+		//A bad header could ask for more levels than the image can have.
+		mipCount = std::min(mipCount, GetMipCount(width, height));
+
+		auto makeFourCC = [](const char* s) -> uint32_t
+		{
+			return s[0] | (s[1] << 8) | (s[2] << 16) | (s[3] << 24);
+		};
+
+		BlockFormat format;
+		size_t offset = HEADER_SIZE;
+
+		if (fourCC == makeFourCC("DXT1"))
+			format = BC1;
+		else if (fourCC == makeFourCC("DXT5"))
+			format = BC3;
+		else if (fourCC == makeFourCC("ATI2") || fourCC == makeFourCC("BC5U"))
+			format = BC5;
+		else if (fourCC == makeFourCC("BC5S"))
+			format = BC5_SNORM;
+		else if (fourCC == makeFourCC("DX10"))
+		{
+			offset += 20;
+			//DX10 files can also hold arrays and cube maps, which aren't 2D textures.
+			if (ReadAt<uint32_t>(bytes, HEADER_SIZE + 12) > 1 || !FromDXGI(ReadAt<uint32_t>(bytes, HEADER_SIZE), format))
+			{
+				printf("DDS file %s is not a BC1/BC3/BC5/BC7 2D texture.\n", filename.c_str());
+				return false;
+			}
+		}
+		else
+		{
+			printf("DDS file %s is not a BC1/BC3/BC5/BC7 2D texture.\n", filename.c_str());
+			return false;
+		}
+
+		image.format = format.format;
+		image.width = width;
+		image.height = height;
+		image.levels.clear();
+
+		//The levels are stored one after the other, largest first.
+		for (int level = 0; level < mipCount; ++level)
+		{
+			int w = std::max(1, width >> level);
+			int h = std::max(1, height >> level);
+			size_t size = GetLevelSize(w, h, format.blockSize);
+
+			if (offset + size > bytes.size())
+			{
+				printf("DDS file %s is truncated.\n", filename.c_str());
+				return false;
+			}
+
+			image.levels.push_back({ w, h, std::vector<unsigned char>(bytes.begin() + offset, bytes.begin() + offset + size) });
+			offset += size;
+		}
+
+		//DDS files are always stored top-down.
+		FlipImage(filename, format, image);
+		return true;
+	}
+
+	//Returns true if a KTX2 file is stored with the top row first. This is in the
+	//KTXorientation key (e.g., "rd" for right-down), and top-down is the default.
+	static bool IsKTX2TopDown(const std::vector<unsigned char>& bytes)
+	{
+		size_t offset = ReadAt<uint32_t>(bytes, 56);
+		size_t end = std::min(bytes.size(), offset + ReadAt<uint32_t>(bytes, 60));
+		const std::string key = "KTXorientation";
+
+		//Each entry is a length, then the key and value (both null-terminated), padded to 4 bytes.
+		while (offset + 4 <= end)
+		{
+			size_t length = ReadAt<uint32_t>(bytes, offset);
+			size_t entry = offset + 4;
+			if (length == 0 || entry + length > end)
+				break;
+
+			const char* text = reinterpret_cast<const char*>(bytes.data() + entry);
+			if (length > key.size() + 2 && key.compare(0, key.size(), text, key.size()) == 0 && text[key.size()] == '\0')
+				return text[key.size() + 2] != 'u';
+
+			offset = entry + ((length + 3) & ~static_cast<size_t>(3));
+		}
+
+		return true;
+	}
+
+	static bool LoadKTX2(const std::string& filename, const std::vector<unsigned char>& bytes, CompressedImage& image)
+	{
+		//12 byte identifier, 9 uint32 fields, then the data format, key/value and supercompression indices.
+		const size_t LEVEL_INDEX = 80;
+
+		uint32_t vkFormat = ReadAt<uint32_t>(bytes, 12);
+		int width = static_cast<int>(ReadAt<uint32_t>(bytes, 20));
+		int height = static_cast<int>(ReadAt<uint32_t>(bytes, 24));
+		uint32_t depth = ReadAt<uint32_t>(bytes, 28);
+		uint32_t layers = ReadAt<uint32_t>(bytes, 32);
+		uint32_t faces = ReadAt<uint32_t>(bytes, 36);
+		int levelCount = std::max(1, static_cast<int>(ReadAt<uint32_t>(bytes, 40)));
+		uint32_t supercompression = ReadAt<uint32_t>(bytes, 44);
+
+		if (width <= 0 || height <= 0)
+		{
+			printf("KTX2 file %s has an invalid size.\n", filename.c_str());
+			return false;
+		}
+
+		//A bad header could ask for more levels than the image can have.
+		levelCount = std::min(levelCount, GetMipCount(width, height));
+
+		BlockFormat format;
+		if (depth > 1 || layers > 1 || faces != 1 || !FromVulkan(vkFormat, format))
+		{
+			printf("KTX2 file %s is not a BC1/BC3/BC5/BC7 2D texture.\n", filename.c_str());
+			return false;
+		}
+
+		//Basis Universal and zstd need a transcoder, which we don't have.
+		if (supercompression != 0)
+		{
+			printf("KTX2 file %s uses supercompression, which is not supported.\n", filename.c_str());
+			return false;
+		}
+
+		image.format = format.format;
+		image.width = width;
+		image.height = height;
+		image.levels.clear();
+
+		//Unlike DDS, KTX2 has an index telling us where each level lives (level 0 being the largest).
+		for (int level = 0; level < levelCount; ++level)
+		{
+			size_t entry = LEVEL_INDEX + level * 24;
+			size_t offset = static_cast<size_t>(ReadAt<uint64_t>(bytes, entry));
+			size_t length = static_cast<size_t>(ReadAt<uint64_t>(bytes, entry + 8));
+
+			int w = std::max(1, width >> level);
+			int h = std::max(1, height >> level);
+
+			if (length < GetLevelSize(w, h, format.blockSize) || offset + length > bytes.size())
+			{
+				printf("KTX2 file %s is truncated.\n", filename.c_str());
+				return false;
+			}
+
+			image.levels.push_back({ w, h, std::vector<unsigned char>(bytes.begin() + offset, bytes.begin() + offset + length) });
+		}
+
+		if (IsKTX2TopDown(bytes))
+			FlipImage(filename, format, image);
+
+		return true;
+	}
+
+	bool IsCompressedImageFile(const std::string& filename)
+	{
+		size_t dot = filename.find_last_of('.');
+		if (dot == std::string::npos)
+			return false;
+
+		std::string ext = filename.substr(dot + 1);
+		std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+		return ext == "dds" || ext == "ktx2";
+	}
+
+	bool LoadCompressedImage(const std::string& filename, CompressedImage& image)
+	{
+		std::vector<unsigned char> bytes;
+		if (!ReadFile(filename, bytes))
+		{
+			printf("File %s not found.\n", filename.c_str());
+			return false;
+		}
+
+		//We go by what's in the file rather than the extension.
+		if (bytes.size() >= 4 && memcmp(bytes.data(), "DDS ", 4) == 0)
+			return LoadDDS(filename, bytes, image);
+		if (bytes.size() >= 80 && memcmp(bytes.data(), KTX2_ID, sizeof(KTX2_ID)) == 0)
+			return LoadKTX2(filename, bytes, image);
+
+		printf("%s is not a DDS or KTX2 file.\n", filename.c_str());
+		return false;
+	}
+}
@@ -0,0 +1,633 @@
+/*
+NOU Framework - Created for INFR 2310 at Ontario Tech.
+(c) Samantha Stahlke 2020
+
+TextureStreamer.cpp
+Keeps only as much of each streaming texture on the GPU as we need.
+Every streaming texture always has its small mips resident. The larger
+mips are loaded on a background thread once something using the texture
+gets big enough on screen, and dropped again when we go over budget.
+*/
+
+#include "NOU/TextureStreamer.h"
+#include "NOU/Material.h"
+
+#include "stb_image.h"
+#include "TTK/GLState.h"
+#include "TTK/AsyncTextureLoader.h"
+#include "TTK/StreamingBuffer.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nou
+{
+	//Everything we know about one streaming texture.
+	struct StreamState
+	{
+		Texture2D* tex;		//nullptr once the texture has been destroyed
+		std::string filename;
+		MipFilter filter;
+		bool sRGB;
+		bool nearest;
+
+		int width, height;
+		int mipCount;		//0 until we've read the image for the first time
+		int tailBase;		//The level we never drop below
+		int residentBase;	//The largest level on the GPU right now
+		int wantedBase;		//The largest level anything asked for this frame
+		bool pending;		//True while levels are being loaded or uploaded for us
+		bool failed;
+		size_t residentBytes;
+		uint64_t lastUsed;
+
+		//The whole mip chain, kept in memory (within the cache budget) so that
+		//getting more detail later doesn't mean decoding and filtering the file again.
+		//Shared with the worker thread, so only touched with s_lock held.
+		std::shared_ptr<const std::vector<MipLevel>> cache;
+	};
+
+	//Loading levels [base, mipCount) of a texture. The worker fills in the chain,
+	//and then Update uploads it a few rows at a time.
+	struct StreamJob
+	{
+		std::shared_ptr<StreamState> state;
+		int base;	//-1 for the first load, since we don't know how big the image is yet
+		std::shared_ptr<const std::vector<MipLevel>> chain;
+
+		//Upload progress.
+		GLuint target;	//The new texture, which replaces the old one once every level is in
+		int level;
+		int rows;
+	};
+
+	static std::vector<std::shared_ptr<StreamState>> s_states;
+
+	static std::thread s_worker;
+	static std::mutex s_lock;
+	static std::condition_variable s_signal;
+	static std::deque<StreamJob> s_queue;
+	static std::vector<StreamJob> s_done;
+	static bool s_stopping = false;
+
+	//Only touched by the main thread.
+	static std::deque<StreamJob> s_uploads;
+	static TTK::StreamingBuffer* s_stream = nullptr;
+
+	static size_t s_budget = 256 * 1024 * 1024;
+	static size_t s_uploadBudget = TTK::AsyncTextureLoader::UploadBytesPerFrame;
+	static size_t s_cacheBudget = 128 * 1024 * 1024;
+	static int s_tailSize = 64;
+	static int s_screenHeight = 720;
+	static uint64_t s_frame = 0;
+
+	//The first level that is no bigger than our tail size.
+	static int GetTailBase(int width, int height, int mipCount)
+	{
+		int level = 0;
+		while (level < mipCount - 1 && std::max(width >> level, height >> level) > s_tailSize)
+			++level;
+		return level;
+	}
+
+	static size_t GetChainBytes(const std::vector<MipLevel>& chain)
+	{
+		size_t bytes = 0;
+		for (const MipLevel& level : chain)
+			bytes += level.data.size();
+		return bytes;
+	}
+
+	//How much memory levels [base, mipCount) take up on the GPU.
+	static size_t GetResidentBytes(int width, int height, int base, int mipCount)
+	{
+		size_t bytes = 0;
+		for (int level = base; level < mipCount; ++level)
+			bytes += static_cast<size_t>(std::max(1, width >> level)) * std::max(1, height >> level) * 4;
+		return bytes;
+	}
+
+	static void WorkerMain()
+	{
+		while (true)
+		{
+			StreamJob job;
+			{
+				std::unique_lock<std::mutex> lock(s_lock);
+				s_signal.wait(lock, []() { return s_stopping || !s_queue.empty(); });
+				if (s_stopping)
+					return;
+				job = std::move(s_queue.front());
+				s_queue.pop_front();
+			}
+
+			//If we still have the mip chain from last time, we can skip straight to uploading it.
+			std::shared_ptr<const std::vector<MipLevel>> chain;
+			{
+				std::lock_guard<std::mutex> lock(s_lock);
+				chain = job.state->cache;
+			}
+
+			if (chain == nullptr)
+			{
+				int width, height, channels;
+				unsigned char* data = stbi_load(job.state->filename.c_str(), &width, &height, &channels, STBI_rgb_alpha);
+
+				if (data != nullptr)
+				{
+					FlipRows(data, width, height, 4);
+
+					//Streaming needs a mip chain, so we always build one.
+					MipFilter filter = job.state->filter == MipFilter::None ? MipFilter::Box : job.state->filter;
+					chain = std::make_shared<const std::vector<MipLevel>>(GenerateMips(data, width, height, filter, job.state->sRGB));
+					stbi_image_free(data);
+				}
+			}
+
+			if (chain != nullptr && job.base < 0)
+				job.base = GetTailBase((*chain)[0].width, (*chain)[0].height, static_cast<int>(chain->size()));
+
+			job.chain = chain;
+
+			std::lock_guard<std::mutex> lock(s_lock);
+			//Update decides what stays in the cache.
+			if (chain != nullptr && s_cacheBudget > 0)
+				job.state->cache = chain;
+			s_done.push_back(std::move(job));
+		}
+	}
+
+	static void Queue(const std::shared_ptr<StreamState>& state, int base)
+	{
+		if (!s_worker.joinable())
+			s_worker = std::thread(WorkerMain);
+
+		state->pending = true;
+
+		{
+			std::lock_guard<std::mutex> lock(s_lock);
+			s_queue.push_back({ state, base, nullptr, 0, 0, 0 });
+		}
+		s_signal.notify_one();
+	}
+
+	static GLuint CreateStorage(const StreamState& state, int base)
+	{
+		GLuint id;
+		glCreateTextures(GL_TEXTURE_2D, 1, &id);
+
+		glTextureParameteri(id, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTextureParameteri(id, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		glTextureParameteri(id, GL_TEXTURE_MIN_FILTER, state.nearest ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR);
+		glTextureParameteri(id, GL_TEXTURE_MAG_FILTER, state.nearest ? GL_NEAREST : GL_LINEAR);
+
+		glTextureStorage2D(id, state.mipCount - base, GL_RGBA8,
+						   std::max(1, state.width >> base), std::max(1, state.height >> base));
+
+		return id;
+	}
+
+	//Swaps a texture over to a new GL texture holding levels [base, mipCount).
+	void TextureStreamer::Replace(StreamState& state, GLuint id, int base)
+	{
+		GLuint old = state.tex->m_id;
+		if (!state.tex->m_isPlaceholder)
+		{
+			//Bindless materials may have made the old texture resident, which has to be undone before we delete it.
+			Material::ReleaseTexture(old);
+			TTK::GLState::DeleteTextures(1, &old);
+		}
+
+		state.tex->m_id = id;
+		state.tex->m_isPlaceholder = false;
+		++state.tex->m_generation;
+		state.residentBase = base;
+		state.residentBytes = GetResidentBytes(state.width, state.height, base, state.mipCount);
+	}
+
+	bool TextureStreamer::Start(StreamJob& job)
+	{
+		StreamState& state = *job.state;
+
+		if (job.chain == nullptr)
+		{
+			printf("Failed to load texture %s.\n", state.filename.c_str());
+			state.pending = false;
+			state.failed = true;
+			return false;
+		}
+
+		const std::vector<MipLevel>& chain = *job.chain;
+
+		if (state.mipCount == 0)
+		{
+			state.width = chain[0].width;
+			state.height = chain[0].height;
+			state.mipCount = static_cast<int>(chain.size());
+			state.tailBase = job.base;
+			state.wantedBase = state.tailBase;
+			state.tex->m_width = state.width;
+			state.tex->m_height = state.height;
+		}
+
+		//We build a whole new texture holding every level from the base down, and swap it in once it's full.
+		job.target = CreateStorage(state, job.base);
+		job.level = job.base;
+		job.rows = 0;
+
+		return true;
+	}
+
+	bool TextureStreamer::Upload(StreamJob& job, size_t& budget)
+	{
+		StreamState& state = *job.state;
+
+		while (job.level < state.mipCount)
+		{
+			//Any levels we already have on the GPU can just be copied across.
+			if (job.level >= state.residentBase && job.rows == 0)
+			{
+				for (int level = job.level; level < state.mipCount; ++level)
+				{
+					glCopyImageSubData(state.tex->m_id, GL_TEXTURE_2D, level - state.residentBase, 0, 0, 0,
+									   job.target, GL_TEXTURE_2D, level - job.base, 0, 0, 0,
+									   std::max(1, state.width >> level), std::max(1, state.height >> level), 1);
+				}
+
+				job.level = state.mipCount;
+				break;
+			}
+
+			//Otherwise, we copy as many rows as our budget allows through the staging ring.
+			//We always copy at least one row per frame, so that huge textures still get there.
+			const MipLevel& level = (*job.chain)[job.level];
+			size_t rowBytes = static_cast<size_t>(level.width) * 4;
+			int rows = std::min(level.height - job.rows, static_cast<int>(budget / rowBytes));
+
+			if (rows <= 0)
+			{
+				if (budget < s_uploadBudget)
+					return false;
+				rows = 1;
+			}
+
+			size_t bytes = rows * rowBytes;
+			size_t offset = s_stream->FirstByte() + s_stream->Count();
+			memcpy(s_stream->Reserve<unsigned char>(bytes), level.data.data() + job.rows * rowBytes, bytes);
+
+			//With an unpack buffer bound, the data pointer is an offset into the buffer.
+			glTextureSubImage2D(job.target, job.level - job.base, 0, job.rows, level.width, rows,
+								GL_RGBA, GL_UNSIGNED_BYTE, reinterpret_cast<const void*>(offset));
+
+			budget -= std::min(budget, bytes);
+			job.rows += rows;
+
+			if (job.rows == level.height)
+			{
+				++job.level;
+				job.rows = 0;
+			}
+		}
+
+		Replace(state, job.target, job.base);
+		job.target = 0;
+		state.pending = false;
+
+		return true;
+	}
+
+	void TextureStreamer::UploadPending()
+	{
+		if (s_uploads.empty())
+			return;
+
+		if (s_stream == nullptr)
+			s_stream = new TTK::StreamingBuffer(1, s_uploadBudget);
+
+		size_t budget = s_uploadBudget;
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, s_stream->GetHandle());
+
+		while (!s_uploads.empty())
+		{
+			StreamJob& job = s_uploads.front();
+
+			//The texture was destroyed while we were loading it.
+			if (job.state->tex == nullptr)
+			{
+				TTK::GLState::DeleteTextures(1, &job.target);
+				s_uploads.pop_front();
+				continue;
+			}
+
+			if (job.target == 0 && !Start(job))
+			{
+				s_uploads.pop_front();
+				continue;
+			}
+
+			if (!Upload(job, budget))
+				break;
+
+			s_uploads.pop_front();
+		}
+
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		s_stream->EndFrame();
+	}
+
+	//Drops the least recently used mip chains from memory until we're within the cache budget.
+	static void TrimCache()
+	{
+		std::lock_guard<std::mutex> lock(s_lock);
+
+		std::vector<StreamState*> cached;
+		size_t total = 0;
+
+		for (auto& state : s_states)
+		{
+			if (state->cache != nullptr)
+			{
+				cached.push_back(state.get());
+				total += GetChainBytes(*state->cache);
+			}
+		}
+
+		if (total <= s_cacheBudget)
+			return;
+
+		std::sort(cached.begin(), cached.end(), [](const StreamState* a, const StreamState* b)
+		{
+			return a->lastUsed < b->lastUsed;
+		});
+
+		for (StreamState* state : cached)
+		{
+			if (total <= s_cacheBudget)
+				break;
+
+			total -= GetChainBytes(*state->cache);
+			state->cache = nullptr;
+		}
+	}
+
+	//Drops the largest resident level of a texture. The smaller levels are
+	//copied over on the GPU, so we don't need to go back to the file.
+	void TextureStreamer::DropLevel(StreamState& state)
+	{
+		int base = state.residentBase + 1;
+		GLuint old = state.tex->m_id;
+		GLuint id = CreateStorage(state, base);
+
+		for (int level = base; level < state.mipCount; ++level)
+		{
+			glCopyImageSubData(old, GL_TEXTURE_2D, level - state.residentBase, 0, 0, 0,
+							   id, GL_TEXTURE_2D, level - base, 0, 0, 0,
+							   std::max(1, state.width >> level), std::max(1, state.height >> level), 1);
+		}
+
+		Replace(state, id, base);
+	}
+
+	std::unique_ptr<Texture2D> TextureStreamer::Load(const std::string& filename, bool useNearest,
+													 MipFilter mips, bool sRGB)
+	{
+		std::unique_ptr<Texture2D> tex(new Texture2D());
+
+		//We show the same placeholder as textures that are loading in the background.
+		tex->m_id = TTK::AsyncTextureLoader::Instance().GetPlaceholder();
+		tex->m_isPlaceholder = true;
+
+		auto state = std::make_shared<StreamState>();
+		state->tex = tex.get();
+		state->filename = filename;
+		state->filter = mips;
+		state->sRGB = sRGB;
+		state->nearest = useNearest;
+		state->width = 0;
+		state->height = 0;
+		state->mipCount = 0;
+		state->tailBase = 0;
+		state->residentBase = INT_MAX;
+		state->wantedBase = INT_MAX;
+		state->pending = false;
+		state->failed = false;
+		state->residentBytes = 0;
+		state->lastUsed = 0;
+
+		tex->m_streamState = state.get();
+		s_states.push_back(state);
+
+		//The first request just gets us the tail, so we have something to show.
+		Queue(state, -1);
+
+		return tex;
+	}
+
+	void TextureStreamer::RequestSize(const Texture2D& tex, float screenPixels)
+	{
+		StreamState* state = tex.m_streamState;
+		if (state == nullptr || state->mipCount == 0)
+			return;
+
+		state->lastUsed = s_frame;
+
+		//We want about one texel per pixel, so every time the texture is twice as big
+		//as it is on screen we can go down a level.
+		float ratio = std::max(state->width, state->height) / std::max(screenPixels, 1.0f);
+		int level = ratio <= 1.0f ? 0 : static_cast<int>(std::floor(std::log2(ratio)));
+
+		state->wantedBase = std::min(state->wantedBase, std::min(level, state->tailBase));
+	}
+
+	void TextureStreamer::Update()
+	{
+		if (s_states.empty())
+			return;
+
+		//Upload anything the worker has finished, within our per-frame budget.
+		{
+			std::lock_guard<std::mutex> lock(s_lock);
+			for (auto& job : s_done)
+				s_uploads.push_back(std::move(job));
+			s_done.clear();
+		}
+		UploadPending();
+		TrimCache();
+
+		size_t total = 0;
+		for (auto& state : s_states)
+			total += state->residentBytes;
+
+		//When we need room, we drop detail from the textures that were used least recently first.
+		std::vector<StreamState*> candidates;
+		for (auto& state : s_states)
+		{
+			if (state->mipCount > 0 && state->residentBase < state->tailBase)
+				candidates.push_back(state.get());
+		}
+
+		std::sort(candidates.begin(), candidates.end(), [](const StreamState* a, const StreamState* b)
+		{
+			return a->lastUsed < b->lastUsed;
+		});
+
+		//Drops levels until we're within the limit. Textures used this frame are only
+		//touched if unusedOnly is false, and then only if they have more detail than they need.
+		auto evict = [&](size_t limit, bool unusedOnly)
+		{
+			for (StreamState* state : candidates)
+			{
+				while (total > limit && state->residentBase < state->tailBase &&
+					   (state->lastUsed < s_frame || (!unusedOnly && state->residentBase < state->wantedBase)))
+				{
+					total -= state->residentBytes;
+					DropLevel(*state);
+					total += state->residentBytes;
+				}
+
+				if (total <= limit)
+					break;
+			}
+		};
+
+		if (total > s_budget)
+			evict(s_budget, false);
+
+		//Ask for more detail for anything that needs it this frame. If it doesn't fit,
+		//we make room by dropping detail from textures that weren't used this frame - otherwise
+		//a budget full of things we've walked away from would keep new textures blurry forever.
+		for (auto& state : s_states)
+		{
+			if (!state->pending && !state->failed && state->mipCount > 0 &&
+				state->lastUsed == s_frame && state->wantedBase < state->residentBase)
+			{
+				size_t needed = GetResidentBytes(state->width, state->height, state->wantedBase, state->mipCount);
+				size_t growth = needed - state->residentBytes;
+
+				if (growth <= s_budget)
+				{
+					if (total + growth > s_budget)
+						evict(s_budget - growth, true);
+
+					if (total + growth <= s_budget)
+					{
+						total += growth;
+						Queue(state, state->wantedBase);
+					}
+				}
+			}
+
+			state->wantedBase = state->mipCount > 0 ? state->tailBase : INT_MAX;
+		}
+
+		++s_frame;
+	}
+
+	void TextureStreamer::Unregister(StreamState* state)
+	{
+		state->tex = nullptr;
+
+		auto it = std::find_if(s_states.begin(), s_states.end(),
+			[state](const std::shared_ptr<StreamState>& s) { return s.get() == state; });
+		if (it != s_states.end())
+			s_states.erase(it);
+	}
+
+	void TextureStreamer::SetBudget(size_t bytes)
+	{
+		s_budget = bytes;
+	}
+
+	void TextureStreamer::SetUploadBudget(size_t bytesPerFrame)
+	{
+		//Enough for at least one row of the biggest texture GL will let us make (16384 RGBA8 texels).
+		s_uploadBudget = std::max<size_t>(bytesPerFrame, 64 * 1024);
+
+		//The staging ring is sized to the budget, so we make a new one next time we need it.
+		delete s_stream;
+		s_stream = nullptr;
+	}
+
+	void TextureStreamer::SetCacheBudget(size_t bytes)
+	{
+		s_cacheBudget = bytes;
+	}
+
+	void TextureStreamer::SetTailSize(int pixels)
+	{
+		s_tailSize = std::max(1, pixels);
+	}
+
+	void TextureStreamer::SetScreenHeight(int pixels)
+	{
+		s_screenHeight = pixels;
+	}
+
+	int TextureStreamer::GetScreenHeight()
+	{
+		return s_screenHeight;
+	}
+
+	bool TextureStreamer::IsActive()
+	{
+		return !s_states.empty();
+	}
+
+	TextureStreamer::Stats TextureStreamer::GetStats()
+	{
+		Stats stats = { 0, s_budget, 0, 0, static_cast<int>(s_states.size()) };
+
+		std::lock_guard<std::mutex> lock(s_lock);
+		for (auto& state : s_states)
+		{
+			stats.residentBytes += state->residentBytes;
+			if (state->cache != nullptr)
+				stats.cachedBytes += GetChainBytes(*state->cache);
+			if (state->pending)
+				++stats.pendingRequests;
+		}
+
+		return stats;
+	}
+
+	void TextureStreamer::Cleanup()
+	{
+		if (s_worker.joinable())
+		{
+			{
+				std::lock_guard<std::mutex> lock(s_lock);
+				s_stopping = true;
+			}
+			s_signal.notify_all();
+			s_worker.join();
+		}
+
+		s_queue.clear();
+		s_done.clear();
+		s_stopping = false;
+
+		//Anything half uploaded never made it into its texture, so we just throw it away.
+		for (auto& job : s_uploads)
+			TTK::GLState::DeleteTextures(1, &job.target);
+		s_uploads.clear();
+
+		delete s_stream;
+		s_stream = nullptr;
+
+		//Any textures that are still alive keep whatever they have on the GPU,
+		//and just become regular textures.
+		for (auto& state : s_states)
+		{
+			if (state->tex != nullptr)
+				state->tex->m_streamState = nullptr;
+		}
+		s_states.clear();
+	}
+}
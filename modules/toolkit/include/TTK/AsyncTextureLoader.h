@@ -0,0 +1,184 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a background texture loader. Images are decoded
+// on a pool of worker threads, and the pixels are then streamed to the
+// GPU a few rows at a time through a pixel unpack buffer, so that loading
+// a level does not stall the frame. Until a texture is resident, a shared
+// placeholder texture can be drawn in its place
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "glad/glad.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace TTK
+{
+	class StreamingBuffer;
+
+	class AsyncTextureLoader {
+	public:
+		static AsyncTextureLoader& Instance() {
+			if (m_Instance == nullptr)
+				m_Instance = new AsyncTextureLoader();
+			return *m_Instance;
+		}
+		static void DestroyContext() {
+			delete m_Instance;
+			m_Instance = nullptr;
+		}
+		static bool IsCreated() { return m_Instance != nullptr; }
+
+		typedef uint32_t Handle;
+		static const Handle InvalidHandle = 0;
+
+		// The number of bytes that can be streamed to the GPU in a single frame
+		static const size_t UploadBytesPerFrame = 4 * 1024 * 1024;
+		// The largest amount of data that is copied before we check the time budget again
+		static const size_t ChunkBytes = 256 * 1024;
+		// The default amount of time that Pump will spend uploading each frame, in milliseconds
+		static constexpr float DefaultBudgetMs = 2.0f;
+
+		/*
+		 * Describes a texture that has finished loading
+		 */
+		struct LoadedTexture {
+			GLuint Texture; // The new GL texture, owned by the receiver of the callback. 0 if the load failed
+			int    Width;
+			int    Height;
+			bool   Success;
+		};
+		typedef std::function<void(const LoadedTexture&)> Callback;
+
+		/*
+		 * One of the smaller levels of a texture's mip chain, in tightly packed RGBA8
+		 */
+		struct MipLevel {
+			int                  Width;
+			int                  Height;
+			std::vector<uint8_t> Pixels;
+		};
+		/*
+		 * Builds the mip chain for a decoded (and flipped) RGBA8 image. This runs on a worker thread, so it must not
+		 * touch GL. The returned levels should start at level 1, since the image itself is always level 0
+		 */
+		typedef std::function<std::vector<MipLevel>(const uint8_t* pixels, int width, int height)> MipGenerator;
+
+		/*
+		 * Returned when a load is started, the future resolves to true once the texture is resident,
+		 * or false if the load failed or was cancelled
+		 */
+		struct Ticket {
+			Handle                   Id;
+			std::shared_future<bool> Resident;
+		};
+
+		~AsyncTextureLoader();
+
+		AsyncTextureLoader(const AsyncTextureLoader&) = delete;
+		AsyncTextureLoader& operator=(const AsyncTextureLoader&) = delete;
+
+		/*
+		 * Starts loading an image from disk into a new RGBA8 texture. This must be called from the GL thread
+		 * @param filePath The path to the image, relative to the current working directory
+		 * @param onResident The callback to invoke from Pump once the texture is resident or has failed to load
+		 * @param flipVertically True if the rows of the image should be flipped so that the first row is at the bottom
+		 * @param filtering The min and mag filter to use for the texture
+		 * @param edgeBehaviour The texture wrapping mode to use for the texture
+		 * @param generateMips If set, builds the texture's mip chain on the worker thread. The min filter is switched
+		 *                     to the matching mipmapped filter if any levels are generated
+		 * @returns A ticket that can be used to cancel the load, or wait for it to complete
+		 */
+		Ticket Load(const std::string& filePath, const Callback& onResident = nullptr, bool flipVertically = false,
+			GLenum filtering = GL_LINEAR, GLenum edgeBehaviour = GL_CLAMP_TO_EDGE, const MipGenerator& generateMips = nullptr);
+
+		/*
+		 * Cancels a load that has not completed yet. The callback will not be invoked, and any GPU memory
+		 * the load has already used is released
+		 * @param handle The handle of the load to cancel
+		 */
+		void Cancel(Handle handle);
+
+		/*
+		 * Streams decoded images to the GPU, and invokes the callbacks of any loads that have finished.
+		 * This should be called once per frame from the GL thread
+		 * @param budgetMs The amount of time to spend copying pixels this frame, in milliseconds
+		 */
+		void Pump(float budgetMs = DefaultBudgetMs);
+
+		/*
+		 * Gets the number of loads that have been started but not yet completed
+		 */
+		size_t GetPendingCount() const { return m_Jobs.size(); }
+
+		/*
+		 * Gets the texture that should be drawn in place of textures that are still loading
+		 */
+		GLuint GetPlaceholder() const { return m_Placeholder; }
+		/*
+		 * Checks whether the given texture is the shared placeholder, which must never be deleted by it's users
+		 */
+		static bool IsPlaceholder(GLuint texture) { return m_Instance != nullptr && texture != 0 && texture == m_Instance->m_Placeholder; }
+
+	private:
+		AsyncTextureLoader();
+		static AsyncTextureLoader* m_Instance;
+
+		struct Job {
+			Handle              Id;
+			std::string         Path;
+			bool                Flip;
+			GLenum              Filtering;
+			GLenum              EdgeBehaviour;
+			Callback            OnResident;
+			MipGenerator        GenerateMips;
+			std::promise<bool>  Promise;
+			std::atomic<bool>   Cancelled;
+			// Written by the worker before the job is handed back to the GL thread
+			uint8_t*            Pixels;
+			int                 Width;
+			int                 Height;
+			std::vector<MipLevel> Mips;
+			// Only touched by the GL thread
+			GLuint              Texture;
+			int                 Level;
+			int                 RowsUploaded;
+			bool                Uploaded;
+		};
+		typedef std::shared_ptr<Job> JobPtr;
+
+		std::vector<std::thread>    m_Workers;
+		std::mutex                  m_QueueLock;
+		std::condition_variable     m_QueueSignal;
+		std::deque<JobPtr>          m_DecodeQueue;
+		std::vector<JobPtr>         m_Decoded;
+		bool                        m_Stopping;
+
+		// Everything below is only touched by the GL thread
+		std::unordered_map<Handle, JobPtr> m_Jobs;
+		std::deque<JobPtr>          m_Uploads;
+		StreamingBuffer*            m_Stream;
+		GLuint                      m_Placeholder;
+		inline static Handle        m_NextHandle = 1;
+
+		void __WorkerMain();
+		void __Complete(const JobPtr& job, bool success);
+		bool __UploadRows(Job& job, size_t available);
+	};
+}
@@ -1,44 +0,0 @@
-#pragma once
-/*
- * This is a cube, defined in the worst possible format ever.
- * This is literally just every single position and normal in the model, written out in a float
- * array. Do not do this. This is really dumb. Just don't. Please.
- */
-const float CubeData[] = {
--0.50000f, 0.50000f, 0.50000f, 0.00000f, 1.00000f, 0.00000f,
-0.50000f, 0.50000f, -0.50000f, 0.00000f, 1.00000f, 0.00000f,
--0.50000f, 0.50000f, -0.50000f, 0.00000f, 1.00000f, 0.00000f,
-0.50000f, 0.50000f, 0.50000f, 1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, -0.50000f, 1.00000f, 0.00000f, 0.00000f,
-0.50000f, 0.50000f, -0.50000f, 1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, 0.50000f, 0.00000f, -1.00000f, 0.00000f,
--0.50000f, -0.50000f, -0.50000f, 0.00000f, -1.00000f, 0.00000f,
-0.50000f, -0.50000f, -0.50000f, 0.00000f, -1.00000f, 0.00000f,
--0.50000f, -0.50000f, 0.50000f, -1.00000f, 0.00000f, 0.00000f,
--0.50000f, 0.50000f, -0.50000f, -1.00000f, 0.00000f, 0.00000f,
--0.50000f, -0.50000f, -0.50000f, -1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, -0.50000f, 0.00000f, 0.00000f, -1.00000f,
--0.50000f, 0.50000f, -0.50000f, 0.00000f, 0.00000f, -1.00000f,
-0.50000f, 0.50000f, -0.50000f, 0.00000f, 0.00000f, -1.00000f,
-0.50000f, 0.50000f, 0.50000f, 0.00000f, 0.00000f, 1.00000f,
--0.50000f, -0.50000f, 0.50000f, 0.00000f, 0.00000f, 1.00000f,
-0.50000f, -0.50000f, 0.50000f, 0.00000f, 0.00000f, 1.00000f,
--0.50000f, 0.50000f, 0.50000f, 0.00000f, 1.00000f, 0.00000f,
-0.50000f, 0.50000f, 0.50000f, 0.00000f, 1.00000f, 0.00000f,
-0.50000f, 0.50000f, -0.50000f, 0.00000f, 1.00000f, 0.00000f,
-0.50000f, 0.50000f, 0.50000f, 1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, 0.50000f, 1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, -0.50000f, 1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, 0.50000f, 0.00000f, -1.00000f, 0.00000f,
--0.50000f, -0.50000f, 0.50000f, 0.00000f, -1.00000f, 0.00000f,
--0.50000f, -0.50000f, -0.50000f, 0.00000f, -1.00000f, 0.00000f,
--0.50000f, -0.50000f, 0.50000f, -1.00000f, 0.00000f, 0.00000f,
--0.50000f, 0.50000f, 0.50000f, -1.00000f, 0.00000f, 0.00000f,
--0.50000f, 0.50000f, -0.50000f, -1.00000f, 0.00000f, 0.00000f,
-0.50000f, -0.50000f, -0.50000f, 0.00000f, 0.00000f, -1.00000f,
--0.50000f, -0.50000f, -0.50000f, 0.00000f, 0.00000f, -1.00000f,
--0.50000f, 0.50000f, -0.50000f, 0.00000f, 0.00000f, -1.00000f,
-0.50000f, 0.50000f, 0.50000f, 0.00000f, 0.00000f, 1.00000f,
--0.50000f, 0.50000f, 0.50000f, 0.00000f, 0.00000f, 1.00000f,
--0.50000f, -0.50000f, 0.50000f, 0.00000f, 0.00000f, 1.00000f,
-};
\ No newline at end of file
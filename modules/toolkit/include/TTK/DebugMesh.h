@@ -0,0 +1,64 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a retained set of debug lines, triangles and points.
+// The geometry is built once, baked into a GPU buffer, and can then be drawn
+// every frame with a single call to TTK::Context::DrawDebugMesh
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "TTKContext.h"
+#include <memory>
+#include <vector>
+
+namespace TTK
+{
+	class DebugMesh {
+	public:
+		typedef std::shared_ptr<DebugMesh> Ptr;
+
+		DebugMesh();
+		~DebugMesh();
+
+		DebugMesh(const DebugMesh&) = delete;
+		DebugMesh& operator=(const DebugMesh&) = delete;
+
+		/*
+		 * Adds geometry to this mesh, these will have no effect after the mesh has been baked
+		 */
+		void AddLine(const glm::vec3& a, const glm::vec3& b, const glm::vec4& color = { 0, 0, 0, 1 });
+		void AddTri(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c, const glm::vec4& color = { 0, 0, 0, 1 });
+		void AddQuad(const glm::vec3& min, const glm::vec3& max, const glm::vec4& color = { 0, 0, 0, 1 });
+		void AddPoint(const glm::vec3& pos, float size, const glm::vec4& color = { 0, 0, 0, 1 });
+
+		/*
+		 * Uploads all the geometry that has been added to the GPU, and frees the CPU side copy
+		 */
+		void Bake();
+
+		/*
+		 * Returns true if this mesh has been uploaded to the GPU
+		 */
+		bool IsBaked() const { return m_Buffer != 0; }
+
+	private:
+		friend class Context;
+
+		std::vector<Context::SimpleVert> m_TriVerts;
+		std::vector<Context::SimpleVert> m_LineVerts;
+		std::vector<Context::PointVert>  m_PointVerts;
+
+		GLuint  m_Buffer;
+		GLuint  m_SimpleVAO, m_PointVAO;
+		GLsizei m_TriCount, m_LineCount, m_PointCount;
+
+		// A model space bounding sphere around all the geometry, used for culling
+		glm::vec3 m_BoundsCenter;
+		float     m_BoundsRadius;
+	};
+}
@@ -16,6 +16,12 @@
 #include "GLM/glm.hpp"
 #include "glad/glad.h"
 #include "stb_truetype.h"
+#include "StreamingBuffer.h"
+#include "TextLayoutCache.h"
+#include <bitset>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace  TTK
 {
@@ -39,25 +45,67 @@ namespace  TTK
 	};
 	*/
 
+	/*
+	 * The type of atlas that a font is rasterized into
+	 */
+	enum class FontAtlasMode {
+		// Glyphs are stored as coverage, and will blur or alias when drawn at sizes other than the font's size
+		Bitmap,
+		// Glyphs are stored as signed distance fields, so a single atlas stays crisp at any scale
+		SDF
+	};
+
 	struct Col8 {
 		char R, G, B, A;
 	};
 
 	class FontRenderer;
 	
+	/*
+	 * A TrueType font, with glyphs that are rasterized into a fixed size atlas the first time they are used. Text is
+	 * decoded as UTF-8, and when the atlas is full the glyphs that have gone the longest without being drawn are evicted
+	 */
 	class TrueTypeTextureFont {
 	public:
-		TrueTypeTextureFont(const char* fileName, uint32_t size);
+		/*
+		 * Loads a font and creates it's atlas, the printable ASCII range is rasterized up front
+		 * @param fileName The path to the TrueType font file to load
+		 * @param size The size in pixels to rasterize glyphs at. For SDF fonts this is only the base size, larger sizes
+		 *             will have crisper corners at the cost of atlas space
+		 * @param mode The type of atlas to generate
+		 */
+		TrueTypeTextureFont(const char* fileName, uint32_t size, FontAtlasMode mode = FontAtlasMode::Bitmap);
 		~TrueTypeTextureFont();
+
+		TrueTypeTextureFont(const TrueTypeTextureFont&) = delete;
+		TrueTypeTextureFont& operator=(const TrueTypeTextureFont&) = delete;
 		
 		GlyphInfo GetGlyph(int codePoint, float offsetX, float offsetY) const;
 		float  GetKerning(int char1, int char2) const;
 		float  GetLineHeight() const;
+		uint32_t GetSize() const { return myFontSize; }
+		FontAtlasMode GetMode() const { return m_Mode; }
 
 		virtual glm::vec2 MeausureString(const char* text, const float scale = 1.0f);
 
+		/*
+		 * Gets the laid out glyphs for a string, layouts are cached so repeated calls with the same text and scale are cheap
+		 * @param text The UTF-8 text to lay out
+		 * @param scale The scale relative to the font's size
+		 * @returns The layout, which is valid until the next call to GetLayout on this font
+		 */
+		const TextLayout& GetLayout(const char* text, float scale = 1.0f) const;
+
 		virtual GLint GetTexture() const { return myTexture; }
 
+		/*
+		 * Sets the directory that warmed atlases are cached in, so that later runs can load them instead of
+		 * rasterizing. Cached atlases are keyed by the font's contents, size, oversampling and mode
+		 * @param path The directory to store cached atlases in, or an empty string to disable the cache
+		 */
+		static void SetAtlasCacheDirectory(const std::string& path) { m_CacheDirectory = path; }
+		static const std::string& GetAtlasCacheDirectory() { return m_CacheDirectory; }
+
 	protected:
 		friend class FontRenderer;
 		GLuint   myTexture;
@@ -67,10 +115,31 @@ namespace  TTK
 		const uint32_t ATLAS_HEIGHT = 1024;
 		const uint32_t FONT_OVERSAMPLE_X = 2;
 		const uint32_t FONT_OVERSAMPLE_Y = 2;
-		const uint32_t FIRST_CHAR = ' ';
-		const uint32_t CHAR_COUNT = '~' - ' ';
+		// The number of pixels the distance field extends past the edge of each glyph
+		const int      SDF_PADDING = 6;
+		// The atlas value that lies exactly on the edge of a glyph
+		const uint8_t  SDF_ON_EDGE = 128;
+
+		// Used for glyphs that have nothing to draw, or that could not fit in the atlas
+		static const uint32_t NoSlot = 0xFFFFFFFF;
 
-		stbtt_packedchar* myCharInfo;
+		// A glyph that has been rasterized into the atlas, with metrics in unscaled pixels relative to the pen
+		struct CachedGlyph {
+			uint32_t  Slot;
+			glm::vec2 Min, Max;
+			glm::vec2 UVMin, UVMax;
+			float     Advance;
+		};
+
+		// The atlas is split into a grid of cells that can each hold any glyph in the font
+		struct AtlasSlot {
+			uint32_t CodePoint;
+			uint64_t LastUsedFrame;
+		};
+
+		FontAtlasMode     m_Mode;
+
+		unsigned char*    m_FontData;
 		uint32_t          myFontSize;
 		stbtt_fontinfo    myFontInfo;
 		float             myPixelHeightScale;
@@ -78,6 +147,49 @@ namespace  TTK
 		int               myAscent,
 						  myDescent,
 						  myLineGap;
+
+		// Code points below this are stored in flat tables, since nearly all of our text is ASCII
+		static const uint32_t FlatGlyphCount = 128;
+
+		// The glyph cache is filled in lazily, even when we are only measuring or laying out text
+		mutable CachedGlyph                               m_FlatGlyphs[FlatGlyphCount];
+		mutable std::bitset<FlatGlyphCount>               m_FlatGlyphValid;
+		mutable std::unordered_map<uint32_t, CachedGlyph> m_Glyphs;
+
+		// Kerning for every pair of flat code points (indexed by first * FlatGlyphCount + second) is computed up front,
+		// other pairs are looked up the first time they are used and remembered
+		std::vector<float>                             m_FlatKerning;
+		mutable std::unordered_map<uint64_t, float>    m_KerningPairs;
+		mutable std::vector<AtlasSlot> m_Slots;
+		mutable std::vector<uint32_t>  m_FreeSlots;
+		uint32_t                       m_CellWidth, m_CellHeight, m_CellColumns;
+
+		// A CPU copy of the atlas, and the region of it that still needs to be sent to the GPU
+		mutable std::vector<uint8_t> m_AtlasData;
+		mutable glm::ivec2           m_DirtyMin, m_DirtyMax;
+
+		// Identifies this font's atlas in the on-disk cache
+		uint64_t                   m_CacheKey;
+		inline static std::string  m_CacheDirectory = "cache/fonts";
+
+		mutable TextLayoutCache m_LayoutCache;
+		// Set when a glyph has been evicted, so that any cached layouts referring to it will be rebuilt
+		mutable bool            m_LayoutsStale;
+
+		void __LayoutText(const char* text, float scale, TextLayout& layout) const;
+		CachedGlyph __FindGlyph(uint32_t codePoint) const;
+		const CachedGlyph* __LookupGlyph(uint32_t codePoint) const;
+		void __StoreGlyph(uint32_t codePoint, const CachedGlyph& glyph) const;
+		void __EraseGlyph(uint32_t codePoint) const;
+		void __BuildKerning();
+		float __GetKerning(uint32_t first, uint32_t second) const;
+		GlyphInfo __MakeQuad(const CachedGlyph& glyph, float offsetX, float offsetY) const;
+		void __RasterizeGlyph(uint32_t codePoint, CachedGlyph& glyph) const;
+		uint32_t __AllocateSlot() const;
+		void __UploadDirty() const;
+		std::string __GetCachePath() const;
+		bool __LoadAtlasCache();
+		void __SaveAtlasCache() const;
 	};
 	
 	class FontRenderer {
@@ -91,27 +203,62 @@ namespace  TTK
 			delete m_Instance;
 			m_Instance = nullptr;
 		}
+		static bool IsCreated() { return m_Instance != nullptr; }
+		// Gets the number of times that the renderer has been flushed, used to track which glyphs are in use
+		static uint64_t GetFrameIndex() { return m_FrameIndex; }
 
 	private:
 		static FontRenderer* m_Instance;
+		static uint64_t      m_FrameIndex;
 
 		struct Vert {
 			glm::vec2 Position;
-			Col8      Color;
+			uint32_t  Color; // Packed RGBA8
 			glm::vec2 UV;
 		};
 
+		// All the text queued for a single font this frame
+		struct Batch {
+			const TrueTypeTextureFont* Font;
+			std::vector<Vert>          Verts;
+		};
+
 	public:
 		~FontRenderer();
 
+		/*
+		 * Queues some text to be drawn with the given font, this will be drawn when the renderer is next flushed
+		 * @param font The font to draw with, this must stay alive until the next flush
+		 * @param text The text to draw, there is no limit to it's length
+		 * @param pos The position of the top left of the text, in screen coordinates
+		 * @param color The color to draw the text in
+		 * @param scale The scale of the text relative to the font's size
+		 */
 		void Render(const TrueTypeTextureFont& font, const char* text, const glm::vec2& pos, const glm::vec4& color, float scale = 1.0f);
+
+		/*
+		 * Draws all the text that has been queued this frame, with one draw call per font. This is called at the
+		 * end of TTK::Context::Flush, so that text is drawn on top of everything else
+		 */
+		void Flush();
 		
 	private:
 		FontRenderer();
+		friend class TrueTypeTextureFont;
 				
 		GLuint   m_ShaderHandle;
-		GLuint   m_VAO, m_VBO, m_EBO;
-		Vert     m_MeshData[256 * 4];
-		GLuint   m_IndexData[256 * 6];
+		GLuint   m_VAO, m_BoundVBO, m_EBO;
+		size_t   m_IndexQuadCapacity;
+
+		// The vertices for each font are collected on the CPU, then copied into our stream when we flush
+		std::vector<Batch> m_Batches;
+		StreamingBuffer*   m_Stream;
+
+		Batch& __GetBatch(const TrueTypeTextureFont& font);
+		void __DiscardFont(const TrueTypeTextureFont& font);
+		void __GrowIndices(size_t quadCount);
+
+		// These are only the starting sizes, both will grow as required
+		static const size_t InitialQuads = 1024;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,57 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a view frustum that can be extracted from a view
+// projection matrix, and used to reject bounding volumes that are entirely
+// off-screen. The planes are stored in SoA form so that all 6 can be tested
+// with a pair of SSE operations
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <GLM/glm.hpp>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define TTK_FRUSTUM_SSE 1
+#endif
+
+namespace TTK
+{
+	class Frustum {
+	public:
+		Frustum();
+		explicit Frustum(const glm::mat4& viewProjection);
+
+		/*
+		 * Re-extracts the planes of this frustum from a view projection matrix
+		 * @param viewProjection The matrix to extract from, using GL's [-w, w] clip space depth
+		 */
+		void Update(const glm::mat4& viewProjection);
+
+		/*
+		 * Returns true if any part of the sphere may be inside the frustum
+		 * @param center The center of the sphere, in the same space as the frustum
+		 * @param radius The radius of the sphere
+		 */
+		bool TestSphere(const glm::vec3& center, float radius) const;
+		/*
+		 * Returns true if any part of the axis aligned box may be inside the frustum
+		 * @param min The minimum corner of the box
+		 * @param max The maximum corner of the box
+		 */
+		bool TestAABB(const glm::vec3& min, const glm::vec3& max) const;
+
+	private:
+		// 6 planes, padded out to 8 by repeating the first two so that we can always test in groups of 4
+		alignas(16) float m_NormalX[8];
+		alignas(16) float m_NormalY[8];
+		alignas(16) float m_NormalZ[8];
+		alignas(16) float m_Distance[8];
+
+		bool __TestCenterExtents(const glm::vec3& center, const glm::vec3& extents, float radius) const;
+	};
+}
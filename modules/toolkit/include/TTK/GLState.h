@@ -0,0 +1,191 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a shadow copy of the GL state that our renderers
+// touch most often (program, vertex array, texture units, uniform buffer
+// bindings, blending, depth and culling). Changes that would not modify the state are skipped, and
+// the current state can be queried without asking the driver. It is header
+// only, so that it can be shared with modules that do not link against TTK
+//
+// Note that any code that changes this state without going through the
+// cache (ex third party libraries) must call GLState::Invalidate afterwards
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "glad/glad.h"
+#include <cstdint>
+
+namespace TTK
+{
+	class GLState {
+	public:
+		// The number of texture units that we shadow, binds to higher units are always sent to the driver
+		static const GLuint MaxTextureUnits = 32;
+		// The number of uniform buffer binding points that we shadow, binds to higher points are always sent to the driver
+		static const GLuint MaxUniformBuffers = 16;
+
+		static void UseProgram(GLuint program) {
+			if (m_Program != program) {
+				glUseProgram(program);
+				m_Program = program;
+			}
+		}
+		static GLuint GetProgram() { return m_Program; }
+
+		static void BindVertexArray(GLuint vao) {
+			if (m_VertexArray != vao) {
+				glBindVertexArray(vao);
+				m_VertexArray = vao;
+			}
+		}
+		static GLuint GetVertexArray() { return m_VertexArray; }
+
+		/*
+		 * Binds a texture to a texture unit. Note that this uses glBindTextureUnit, so the active texture unit
+		 * is never changed
+		 * @param unit The index of the unit to bind to (ie 0, not GL_TEXTURE0)
+		 * @param texture The texture to bind, or 0 to unbind the unit
+		 */
+		static void BindTexture(GLuint unit, GLuint texture) {
+			if (unit >= MaxTextureUnits) {
+				glBindTextureUnit(unit, texture);
+			} else if (m_Textures[unit] != texture) {
+				glBindTextureUnit(unit, texture);
+				m_Textures[unit] = texture;
+			}
+		}
+		static GLuint GetTexture(GLuint unit) { return unit < MaxTextureUnits ? m_Textures[unit] : Unknown; }
+
+		/*
+		 * Binds a buffer to an indexed uniform buffer binding point
+		 * @param index The binding point to bind to
+		 * @param buffer The buffer to bind, or 0 to unbind the binding point
+		 */
+		static void BindUniformBuffer(GLuint index, GLuint buffer) {
+			if (index >= MaxUniformBuffers) {
+				glBindBufferBase(GL_UNIFORM_BUFFER, index, buffer);
+			} else if (m_UniformBuffers[index] != buffer) {
+				glBindBufferBase(GL_UNIFORM_BUFFER, index, buffer);
+				m_UniformBuffers[index] = buffer;
+			}
+		}
+		static GLuint GetUniformBuffer(GLuint index) { return index < MaxUniformBuffers ? m_UniformBuffers[index] : Unknown; }
+
+		static void SetBlendEnabled(bool enabled) { __SetCapability(GL_BLEND, m_Blend, enabled); }
+		static bool IsBlendEnabled() { return m_Blend == 1; }
+
+		static void SetBlendFunc(GLenum src, GLenum dst) { SetBlendFunc(src, dst, src, dst); }
+		static void SetBlendFunc(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+			if (m_BlendFunc[0] != srcRGB || m_BlendFunc[1] != dstRGB || m_BlendFunc[2] != srcAlpha || m_BlendFunc[3] != dstAlpha) {
+				glBlendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha);
+				m_BlendFunc[0] = srcRGB;
+				m_BlendFunc[1] = dstRGB;
+				m_BlendFunc[2] = srcAlpha;
+				m_BlendFunc[3] = dstAlpha;
+			}
+		}
+
+		static void SetDepthTestEnabled(bool enabled) { __SetCapability(GL_DEPTH_TEST, m_DepthTest, enabled); }
+		static bool IsDepthTestEnabled() { return m_DepthTest == 1; }
+
+		static void SetDepthMask(bool enabled) {
+			int8_t value = enabled ? 1 : 0;
+			if (m_DepthMask != value) {
+				glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+				m_DepthMask = value;
+			}
+		}
+		// Note that if the mask is unknown, this will assume the GL default (enabled)
+		static bool GetDepthMask() { return m_DepthMask != 0; }
+
+		static void SetCullEnabled(bool enabled) { __SetCapability(GL_CULL_FACE, m_Cull, enabled); }
+		static bool IsCullEnabled() { return m_Cull == 1; }
+
+		/*
+		 * Deletes vertex arrays, and forgets them if they are currently bound (since GL will unbind them)
+		 */
+		static void DeleteVertexArrays(GLsizei count, const GLuint* vaos) {
+			for (GLsizei ix = 0; ix < count; ix++) {
+				if (vaos[ix] != 0 && vaos[ix] == m_VertexArray)
+					m_VertexArray = 0;
+			}
+			glDeleteVertexArrays(count, vaos);
+		}
+		/*
+		 * Deletes textures, and forgets them on any units they are currently bound to (since GL will unbind them)
+		 */
+		static void DeleteTextures(GLsizei count, const GLuint* textures) {
+			for (GLsizei ix = 0; ix < count; ix++) {
+				for (GLuint& bound : m_Textures) {
+					if (textures[ix] != 0 && bound == textures[ix])
+						bound = 0;
+				}
+			}
+			glDeleteTextures(count, textures);
+		}
+
+		/*
+		 * Deletes buffers, and forgets them on any uniform buffer binding points they are currently bound to
+		 */
+		static void DeleteBuffers(GLsizei count, const GLuint* buffers) {
+			for (GLsizei ix = 0; ix < count; ix++) {
+				for (GLuint& bound : m_UniformBuffers) {
+					if (buffers[ix] != 0 && bound == buffers[ix])
+						bound = 0;
+				}
+			}
+			glDeleteBuffers(count, buffers);
+		}
+
+		/*
+		 * Forgets all of the shadowed state, so that the next change to each piece of state is always sent to the
+		 * driver. Call this after any code that modifies the GL state without going through the cache
+		 */
+		static void Invalidate() {
+			m_Program = Unknown;
+			m_VertexArray = Unknown;
+			for (GLuint& texture : m_Textures)
+				texture = Unknown;
+			for (GLuint& buffer : m_UniformBuffers)
+				buffer = Unknown;
+			for (GLenum& func : m_BlendFunc)
+				func = Unknown;
+			m_Blend = -1;
+			m_DepthTest = -1;
+			m_DepthMask = -1;
+			m_Cull = -1;
+		}
+
+	private:
+		// Used for any state that we no longer know the value of
+		static const GLuint Unknown = 0xFFFFFFFF;
+
+		// We start with the GL defaults for a freshly created context
+		inline static GLuint m_Program = 0;
+		inline static GLuint m_VertexArray = 0;
+		inline static GLuint m_Textures[MaxTextureUnits] = {};
+		inline static GLuint m_UniformBuffers[MaxUniformBuffers] = {};
+		inline static GLenum m_BlendFunc[4] = { GL_ONE, GL_ZERO, GL_ONE, GL_ZERO };
+		// Capabilities are stored as -1 for unknown, 0 for disabled and 1 for enabled
+		inline static int8_t m_Blend = 0;
+		inline static int8_t m_DepthTest = 0;
+		inline static int8_t m_DepthMask = 1;
+		inline static int8_t m_Cull = 0;
+
+		static void __SetCapability(GLenum capability, int8_t& state, bool enabled) {
+			int8_t value = enabled ? 1 : 0;
+			if (state != value) {
+				if (enabled)
+					glEnable(capability);
+				else
+					glDisable(capability);
+				state = value;
+			}
+		}
+	};
+}
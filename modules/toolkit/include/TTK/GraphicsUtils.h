@@ -15,6 +15,7 @@
 
 #include <string>
 #include <glm/glm.hpp>
+#include "DebugMesh.h"
 
 struct GLFWwindow;
 
@@ -32,6 +33,7 @@ namespace TTK
 	{
 	private:
 		static inline float _fov = 60.0f;
+		static inline DebugMesh::Ptr _gridMesh = nullptr;
 		
 	public:
 		/*
@@ -189,6 +191,19 @@ namespace TTK
 		 */
 		static void DrawSphere(float *p0, float size = 1.0f, float *colour = nullptr);
 
+		/*
+		 * Draws a capped cylinder in the scene, with the given transformation
+		 * @param transform The transformation to apply to the unit cylinder (radius 1, extending from -1 to 1 along the Y axis)
+		 * @param colour The color to draw the cylinder in
+		 */
+		static void DrawCylinder(const glm::mat4& transform, const glm::vec4& colour = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+		/*
+		 * Draws a capsule in the scene, with the given transformation
+		 * @param transform The transformation to apply to the unit capsule (radius 1, with hemisphere centers at -1 and 1 along the Y axis)
+		 * @param colour The color to draw the capsule in
+		 */
+		static void DrawCapsule(const glm::mat4& transform, const glm::vec4& colour = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+
 		// Description:
 		// Clears the current projection matrix and then resets it
 		// to an orthographic projection.
@@ -211,6 +226,13 @@ namespace TTK
 		 */
 		static void SetDepthEnabled(bool isEnabled = true);
 
+		/*
+		 * Enables or disables frustum culling of debug primitives. When enabled, anything that is entirely off-screen
+		 * will be discarded on the CPU instead of being sent to the GPU
+		 * @param isEnabled Whether or not culling is enabled
+		 */
+		static void SetCullingEnabled(bool isEnabled = true);
+
 		/*
 		 * Sets the view matrix for TTK to use when rendering, to not use a camera, call this with either no parameters,
 		 * or the identity matrix
@@ -244,6 +266,13 @@ namespace TTK
 		 */
 		static void DrawGrid(float gridWidth = 10.0f, AlignMode mode = AlignMode::YUp);
 
+		/*
+		 * Draws a debug mesh that has been baked to the GPU
+		 * @param mesh The mesh to draw
+		 * @param transform The model matrix to draw the mesh with
+		 */
+		static void DrawDebugMesh(const DebugMesh::Ptr& mesh, const glm::mat4& transform = glm::mat4(1.0f));
+
 		/*
 		 * Handles freeing the resources used by TTK
 		 */
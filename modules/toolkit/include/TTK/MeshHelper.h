@@ -4,8 +4,8 @@
 // You may not use this header in your GDW games.
 //
 // This header contains a helper class for drawing the primitive types that
-// were originally supported by GLUT. This file was purposefully built to
-// be non-optimal
+// were originally supported by GLUT. Primitives are queued as instances by
+// the TTK context, and drawn with one instanced call per shape
 //
 // Based off of TTK by Michael Gharbharan 2017
 // Shawn Matthews 2019
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "TTKContext.h"
+#include "PrimitiveGeometry.h"
 
 namespace TTK {
 	namespace Impl {
@@ -21,20 +22,46 @@ namespace TTK {
 		public:
 			~MeshHelper();
 			MeshHelper();
-			void RenderTeapot(const glm::mat4& transform, const glm::vec4& color) const;
-			void RenderSphere(const glm::mat4& transform, const glm::vec4& color) const;
-			void RenderCube(const glm::mat4& transform, const glm::vec4& color) const;
+			/*
+			 * Draws all the instances of a shape that have been queued this frame
+			 * @param shape The shape to draw
+			 * @param viewProjection The view projection matrix to render with
+			 * @param instances The stream containing the Context::MeshInstance data for this frame
+			 */
+			void RenderInstanced(MeshShape shape, const glm::mat4& viewProjection, const StreamingBuffer& instances);
+			/*
+			 * Rebuilds the sphere, cylinder and capsule meshes at a new tessellation level. Must be called from the
+			 * thread that owns the GL context
+			 * @param slices The number of segments around the Y axis (minimum 3)
+			 * @param stacks The number of segments from pole to pole of the sphere, capsules get half of this per hemisphere
+			 */
+			void SetTessellation(int slices, int stacks);
+			/*
+			 * Gets a model space bounding sphere for a shape
+			 * @param shape The shape to get the bounds for
+			 * @param center Receives the center of the sphere
+			 * @param radius Receives the radius of the sphere
+			 */
+			void GetBoundingSphere(MeshShape shape, glm::vec3& center, float& radius) const {
+				const mesh& m = m_Meshes[static_cast<size_t>(shape)];
+				center = m.Offset;
+				radius = glm::length(m.Scale);
+			}
 			
 		private:
 			struct mesh {
-				GLuint VAO;
-				GLuint VBO;
+				GLuint    VAO;
+				GLuint    VBO;
+				GLuint    EBO;
+				GLuint    InstanceVBO;
+				GLsizei   IndexCount;
+				glm::vec3 Offset;
+				glm::vec3 Scale;
 			};
-			mesh __MakeMesh(const float* data, size_t size) const;
+			mesh __MakeMesh(const Primitives::MeshData& data) const;
+			void __FreeMesh(mesh& m) const;
 			
-			mesh m_Teapot;
-			mesh m_Sphere;
-			mesh m_Cube;
+			mesh m_Meshes[static_cast<size_t>(MeshShape::Count)];
 			GLuint m_Shader;
 		};
 	}
@@ -0,0 +1,75 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains generators for the primitive meshes used by TTK.
+// All meshes are indexed, with de-duplicated positions stored as 16 bit
+// normalized integers relative to the mesh's bounds
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <GLM/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace TTK
+{
+	namespace Primitives
+	{
+		/*
+		 * A compact vertex position, normalized to [-1, 1] within a mesh's bounds. W is padding
+		 * to keep each vertex 4 byte aligned
+		 */
+		struct PackedPosition {
+			int16_t X, Y, Z, W;
+		};
+
+		/*
+		 * Stores an indexed mesh in the compact primitive format. To get a model space position from
+		 * a packed position, use Offset + (packed / 32767) * Scale
+		 */
+		struct MeshData {
+			std::vector<PackedPosition> Vertices;
+			std::vector<uint16_t>       Indices;
+			glm::vec3                   Offset;
+			glm::vec3                   Scale;
+		};
+
+		/*
+		 * Quantizes and de-duplicates a list of positions into the compact mesh format
+		 * @param positions The model space positions of the mesh
+		 * @param indices The triangle indices into positions
+		 */
+		MeshData Pack(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices);
+
+		/*
+		 * Creates a sphere with a radius of 1, centered at the origin
+		 * @param slices The number of segments around the Y axis (minimum 3)
+		 * @param stacks The number of segments from pole to pole (minimum 2)
+		 */
+		MeshData Sphere(int slices = 24, int stacks = 16);
+		/*
+		 * Creates a cube with a side length of 1, centered at the origin
+		 */
+		MeshData Cube();
+		/*
+		 * Creates a capped cylinder with a radius of 1 that extends from -1 to 1 along the Y axis
+		 * @param slices The number of segments around the Y axis (minimum 3)
+		 */
+		MeshData Cylinder(int slices = 24);
+		/*
+		 * Creates a capsule with a radius of 1, where the centers of the hemispheres are at -1 and 1 on the Y axis
+		 * @param slices The number of segments around the Y axis (minimum 3)
+		 * @param stacks The number of segments in each hemisphere (minimum 1)
+		 */
+		MeshData Capsule(int slices = 24, int stacks = 8);
+		/*
+		 * Gets the Utah teapot, as generated by tools/PackMesh.py
+		 */
+		MeshData Teapot();
+	}
+}
@@ -0,0 +1,180 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a registry that shares resources loaded from disk.
+// Each resource is keyed by it's normalized path plus the options it was
+// imported with, so asking for the same file from many places only loads
+// it once. Handles are shared pointers, so the registry can tell which
+// resources are no longer referenced and release them in bulk
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace TTK
+{
+	template <typename T>
+	class ResourceRegistry {
+	public:
+		static ResourceRegistry& Instance() {
+			if (m_Instance == nullptr)
+				m_Instance = new ResourceRegistry();
+			return *m_Instance;
+		}
+		static void DestroyContext() {
+			delete m_Instance;
+			m_Instance = nullptr;
+		}
+		static bool IsCreated() { return m_Instance != nullptr; }
+
+		typedef std::shared_ptr<T> Ptr;
+		typedef std::function<Ptr(const std::string& path)> Loader;
+
+		ResourceRegistry(const ResourceRegistry&) = delete;
+		ResourceRegistry& operator=(const ResourceRegistry&) = delete;
+
+		/*
+		 * Gets a shared resource, constructing it as T(path, args...) if it has not been loaded with these options yet
+		 * @param path The path to the resource, relative to the current working directory
+		 * @param args Any extra constructor arguments, these also form part of the key
+		 * @returns A handle to the shared resource
+		 */
+		template <typename... Args>
+		Ptr Load(const std::string& path, const Args&... args) {
+			return LoadCustom(path, MakeOptionsKey(args...), [&](const std::string& file) {
+				return std::make_shared<T>(file, args...);
+			});
+		}
+
+		/*
+		 * Gets a shared resource, invoking the loader if it has not been loaded with these options yet
+		 * @param path The path to the resource, relative to the current working directory
+		 * @param options A string describing any import options that would produce a different resource
+		 * @param loader The function that loads the resource if it is not already in the registry
+		 * @returns A handle to the shared resource, or nullptr if the loader failed
+		 */
+		Ptr LoadCustom(const std::string& path, const std::string& options, const Loader& loader) {
+			std::string key = __MakeKey(path, options);
+			auto it = m_Resources.find(key);
+			if (it != m_Resources.end())
+				return it->second;
+
+			Ptr result = loader(path);
+			if (result != nullptr)
+				m_Resources[key] = result;
+			return result;
+		}
+
+		/*
+		 * Gets a resource that has already been loaded, without loading it
+		 * @returns The resource, or nullptr if it is not in the registry
+		 */
+		Ptr Find(const std::string& path, const std::string& options = "") const {
+			auto it = m_Resources.find(__MakeKey(path, options));
+			return it != m_Resources.end() ? it->second : nullptr;
+		}
+
+		/*
+		 * Gets the number of handles to a resource that exist outside of the registry, including the one passed in
+		 * @param resource The resource to check
+		 */
+		long GetReferenceCount(const Ptr& resource) const {
+			if (resource == nullptr)
+				return 0;
+			for (const auto& kvp : m_Resources)
+				if (kvp.second == resource)
+					return resource.use_count() - 1;
+			return resource.use_count();
+		}
+
+		/*
+		 * Releases every resource that is only referenced by the registry, for instance when changing levels
+		 * @returns The number of resources that were released
+		 */
+		size_t UnloadUnused() {
+			size_t count = 0;
+			for (auto it = m_Resources.begin(); it != m_Resources.end(); ) {
+				if (it->second.use_count() == 1) {
+					it = m_Resources.erase(it);
+					count++;
+				} else
+					++it;
+			}
+			return count;
+		}
+
+		/*
+		 * Forgets about every resource. Resources that still have handles elsewhere stay alive until those are released,
+		 * but will be loaded again the next time they are requested
+		 */
+		void UnloadAll() { m_Resources.clear(); }
+
+		/*
+		 * Gets the number of unique resources in the registry
+		 */
+		size_t GetCount() const { return m_Resources.size(); }
+
+		/*
+		 * Converts a path into the form used for keys, so that different spellings of the same file match
+		 * @param path The path to normalize
+		 */
+		static std::string NormalizePath(const std::string& path) {
+			std::error_code error;
+			std::filesystem::path result = std::filesystem::weakly_canonical(path, error);
+			if (error)
+				result = std::filesystem::path(path).lexically_normal();
+			std::string normalized = result.generic_string();
+			#ifdef _WIN32
+			// Windows paths are not case sensitive
+			std::transform(normalized.begin(), normalized.end(), normalized.begin(), [](char c) { return (char)tolower(c); });
+			#endif
+			return normalized;
+		}
+
+		/*
+		 * Builds an options key out of a list of import settings
+		 */
+		template <typename... Args>
+		static std::string MakeOptionsKey(const Args&... args) {
+			std::string result;
+			(__AppendOption(result, args), ...);
+			return result;
+		}
+
+	private:
+		ResourceRegistry() = default;
+		~ResourceRegistry() = default;
+		inline static ResourceRegistry* m_Instance = nullptr;
+
+		std::unordered_map<std::string, Ptr> m_Resources;
+
+		static std::string __MakeKey(const std::string& path, const std::string& options) {
+			return options.empty() ? NormalizePath(path) : NormalizePath(path) + "|" + options;
+		}
+
+		template <typename Arg>
+		static void __AppendOption(std::string& key, const Arg& arg) {
+			if (!key.empty())
+				key += ",";
+			if constexpr (std::is_enum_v<Arg>)
+				key += std::to_string(static_cast<std::underlying_type_t<Arg>>(arg));
+			else if constexpr (std::is_arithmetic_v<Arg>)
+				key += std::to_string(arg);
+			else
+				key += std::string(arg);
+		}
+	};
+}
@@ -0,0 +1,144 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a data oriented alternative to SpriteSheetQuad for
+// scenes with thousands of animated sprites. Frame tables are stored once
+// per sheet, and the state of each animator is stored in flat arrays so
+// that they can be advanced in bulk (with SSE, and across threads) and
+// written straight into the SpriteBatch
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <GLM/glm.hpp>
+#include "SpriteBatch.h"
+#include "Texture2D.h"
+#include "VertexLayout.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace TTK
+{
+	/*
+	 * A texture that has been sliced into animation frames, shared between every animator that uses it
+	 */
+	class SpriteSheet {
+	public:
+		typedef std::shared_ptr<SpriteSheet> Ptr;
+
+		SpriteSheet();
+
+		SpriteSheet(const SpriteSheet&) = delete;
+		SpriteSheet& operator=(const SpriteSheet&) = delete;
+
+		/*
+		 * Loads a texture and slices it into a grid of frames, ordered left to right and then top to bottom
+		 * @param fileName The path to the texture to load, relative to the current working directory
+		 * @param numSpritesPerRow The number of sprites in a single row
+		 * @param numRows The number of rows that make up the sheet
+		 * @param animTime The time it should take to complete one full cycle of the animation, if this is 0, then the sprite will default to 60 FPS
+		 */
+		void Slice(const char* fileName, int numSpritesPerRow, int numRows, float animTime = 0.0f);
+
+		/*
+		 * Sets a given frame to last for a given duration in seconds. Animators that are currently showing the frame
+		 * will pick up the new length the next time they change frames
+		 */
+		void SetFrameLength(int frameNumber, float time);
+		float GetFrameLength(int frameNumber) const { return m_FrameLengths[frameNumber]; }
+
+		// Gets the UV rectangle of a frame, as (uMin, vMin, uMax, vMax)
+		const glm::vec4& GetFrameRect(int frameNumber) const { return m_FrameRects[frameNumber]; }
+		int GetNumberOfFrames() const { return static_cast<int>(m_FrameRects.size()); }
+
+		const Texture2D& GetTexture() const { return *m_Texture; }
+
+	private:
+		Texture2D::Ptr         m_Texture; // Shared with every other sheet that uses the same file
+		std::vector<glm::vec4> m_FrameRects;
+		std::vector<float>     m_FrameLengths;
+	};
+
+	/*
+	 * Stores and updates a large number of sprite animators. Animators are referred to by handles, which stay valid
+	 * until the animator is removed, so they can be stored in an entity or component
+	 */
+	class SpriteAnimationSystem {
+	public:
+		typedef uint32_t Handle;
+		static const Handle InvalidHandle = 0xFFFFFFFF;
+
+		SpriteAnimationSystem();
+
+		/*
+		 * Adds a new animator, starting on the first frame of the sheet
+		 * @param sheet The sprite sheet to animate, this must have at least one frame
+		 * @param looping True if the animation should loop, false if it should stop on the last frame
+		 * @returns The handle to the new animator
+		 */
+		Handle Add(const SpriteSheet::Ptr& sheet, bool looping = true);
+		/*
+		 * Removes an animator, after which it's handle may be reused
+		 */
+		void Remove(Handle handle);
+
+		void SetTransform(Handle handle, const glm::mat4& transform) { m_Transforms[m_HandleToIndex[handle]] = transform; }
+		void SetColor(Handle handle, const glm::vec4& color) { m_Colors[m_HandleToIndex[handle]] = PackRGBA8(color); }
+		void SetLooping(Handle handle, bool looping) { m_Looping[m_HandleToIndex[handle]] = looping ? 1 : 0; }
+		void ResetAnimation(Handle handle);
+		int GetCurrentFrame(Handle handle) const { return static_cast<int>(m_Frames[m_HandleToIndex[handle]]); }
+
+		size_t GetCount() const { return m_Frames.size(); }
+
+		/*
+		 * Advances every animator by the given time
+		 * @param deltaTime The time since the last update, in seconds
+		 * @param threadCount The number of threads to split the work over, including the calling thread. Small
+		 *                    numbers of animators are always updated on the calling thread
+		 */
+		void Update(float deltaTime, size_t threadCount = 1);
+		/*
+		 * Advances a range of animators by the given time. Ranges that do not overlap can be updated from different
+		 * threads at the same time, for use with an external job system
+		 * @param begin The index of the first animator to update
+		 * @param end One past the index of the last animator to update, this will be clamped to GetCount()
+		 * @param deltaTime The time since the last update, in seconds
+		 */
+		void UpdateRange(size_t begin, size_t end, float deltaTime);
+
+		/*
+		 * Writes every animator into a sprite batch, this should be called once per frame after updating
+		 */
+		void Submit(SpriteBatch& batch) const;
+		void Submit() const { Submit(SpriteBatch::Instance()); }
+
+		// Below this many animators per thread, the cost of starting a thread outweighs the update itself
+		static const size_t MinAnimatorsPerThread = 4096;
+
+	private:
+		// The unique sheets used by our animators, animators store an index into this list
+		std::vector<SpriteSheet::Ptr> m_Sheets;
+
+		// The state of each animator, with all arrays indexed by the animator's index
+		std::vector<float>     m_FrameTimes;
+		// The length of the frame each animator is on, copied from the sheet so the update doesn't need to look it up
+		std::vector<float>     m_FrameLengths;
+		std::vector<uint32_t>  m_Frames;
+		std::vector<uint16_t>  m_SheetIndices;
+		std::vector<uint8_t>   m_Looping;
+		std::vector<glm::mat4> m_Transforms;
+		std::vector<uint32_t>  m_Colors;
+
+		// Animators are kept tightly packed, so handles are mapped to indices
+		std::vector<uint32_t>  m_HandleToIndex;
+		std::vector<Handle>    m_IndexToHandle;
+		std::vector<Handle>    m_FreeHandles;
+
+		void __Advance(size_t index);
+	};
+}
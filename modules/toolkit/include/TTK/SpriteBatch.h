@@ -0,0 +1,113 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a shared renderer for textured quads. Sprites are
+// queued with a transform, UV rectangle and color, and every sprite that
+// uses the same texture is drawn with a single instanced draw call
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <GLM/glm.hpp>
+#include "glad/glad.h"
+#include "StreamingBuffer.h"
+#include "Texture2D.h"
+#include "TextureAtlas.h"
+#include <vector>
+
+namespace TTK
+{
+	class SpriteBatch {
+	public:
+		static SpriteBatch& Instance() {
+			if (m_Instance == nullptr)
+				m_Instance = new SpriteBatch();
+			return *m_Instance;
+		}
+		static void DestroyContext() {
+			delete m_Instance;
+			m_Instance = nullptr;
+		}
+		static bool IsCreated() { return m_Instance != nullptr; }
+
+		/*
+		 * The per-sprite data that is sent to the GPU
+		 */
+		struct SpriteInstance {
+			glm::mat4 Transform;
+			glm::vec4 UVRect;
+			uint32_t  Color; // Packed RGBA8, see PackRGBA8
+		};
+
+		~SpriteBatch();
+
+		SpriteBatch(const SpriteBatch&) = delete;
+		SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+		/*
+		 * Queues a sprite to be drawn the next time the batch is flushed. The sprite is a quad from -1 to 1 on the
+		 * X and Y axes, with the top left corner showing the minimum UV coordinate
+		 * @param texture The GL texture to draw the sprite with, this must stay alive until the next flush
+		 * @param transform The matrix that transforms the quad directly into clip space
+		 * @param uvRect The area of the texture to show, as (uMin, vMin, uMax, vMax)
+		 * @param color The color to multiply the texture by
+		 */
+		void Submit(GLuint texture, const glm::mat4& transform, const glm::vec4& uvRect = { 0, 0, 1, 1 }, const glm::vec4& color = glm::vec4(1.0f));
+		void Submit(const Texture2D& texture, const glm::mat4& transform, const glm::vec4& uvRect = { 0, 0, 1, 1 }, const glm::vec4& color = glm::vec4(1.0f)) {
+			Submit(texture.GetID(), transform, uvRect, color);
+		}
+
+		/*
+		 * Queues a sprite that shows a region of an atlas, sprites from the same page share a single draw call
+		 * @param atlas The atlas to draw from, this must use AtlasStorage::Pages
+		 * @param region The handle of the region within the atlas to draw
+		 * @param transform The matrix that transforms the quad directly into clip space
+		 * @param color The color to multiply the texture by
+		 */
+		void Submit(const TextureAtlas& atlas, TextureAtlas::Handle region, const glm::mat4& transform, const glm::vec4& color = glm::vec4(1.0f));
+
+		/*
+		 * Reserves space for a number of sprites that use the same texture, so that systems can write their sprites
+		 * directly without going through Submit
+		 * @param texture The GL texture to draw the sprites with, this must stay alive until the next flush
+		 * @param count The number of sprites to reserve
+		 * @returns A pointer to the sprites, which is valid until the next call to Submit or Reserve
+		 */
+		SpriteInstance* Reserve(GLuint texture, size_t count);
+
+		/*
+		 * Draws all the sprites that have been queued, with one draw call per texture. Textures are drawn in the
+		 * order they were first submitted this frame. This is called by TTK::Context::Flush before text is drawn,
+		 * but can be called earlier if sprites need to be drawn before other geometry
+		 */
+		void Flush();
+
+	private:
+		SpriteBatch();
+
+		static SpriteBatch* m_Instance;
+
+		// All the sprites queued for a single texture this frame
+		struct Batch {
+			GLuint                Texture;
+			std::vector<SpriteInstance> Instances;
+		};
+
+		GLuint m_ShaderHandle;
+		GLuint m_VAO, m_QuadVBO, m_BoundVBO;
+
+		std::vector<Batch> m_Batches;
+		StreamingBuffer*   m_Stream;
+		// Sprites are usually drawn from a handful of textures in a row, so we remember the last batch we used
+		size_t             m_LastBatch;
+
+		Batch& __GetBatch(GLuint texture);
+
+		// This is only the starting size, the stream will grow as required
+		static const size_t InitialInstances = 1024;
+	};
+}
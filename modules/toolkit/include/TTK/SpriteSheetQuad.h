@@ -75,8 +75,9 @@ namespace TTK {
 		void SetLooping(bool loop);
 
 		/*
-		 * Renders this sprite with the given transformation matrix. Note that this matrix
-		 * should transform the sprite directly into clip space
+		 * Queues this sprite to be rendered with the given transformation matrix. Note that this matrix
+		 * should transform the sprite directly into clip space. Sprites are drawn by the shared SpriteBatch
+		 * when the frame ends, so this sprite sheet must stay alive until then
 		 * @param matrix The MVP matrix to render this sprite with
 		 */
 		void Draw(const glm::mat4& matrix);
@@ -112,18 +113,11 @@ namespace TTK {
 		int GetNumberOfFrames() const;
 
 	private:
-		struct QuadVert {
-			glm::vec3 Position;
-			glm::vec2 Texture;
-		};
-
 		int   m_CurrentFrame;
 		float m_FrameTime;
 		bool  m_DoesLoop;
-		Texture2D m_Texture;
+		Texture2D::Ptr m_Texture;
 		glm::vec4 m_Color;
-		QuadVert  m_Vertices[4];
-		uint32_t m_VAO, m_VBO, m_EBO, m_Shader;
 
 		std::vector<SpriteCoordinates> m_SpriteCoordinates;
 
@@ -0,0 +1,91 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a persistently mapped, triple buffered ring of
+// GPU memory that can be written to directly from the CPU. Each frame
+// writes into its own region, which is fenced when the frame is done so
+// that we never overwrite data the GPU is still reading from
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "glad/glad.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace TTK
+{
+	class StreamingBuffer {
+	public:
+		// The number of frames that we can have in flight at once
+		static const size_t FrameCount = 3;
+
+		/*
+		 * Creates a new streaming buffer
+		 * @param elemSize The size of a single element in the buffer, in bytes
+		 * @param initialCapacity The number of elements that each frame can hold before the buffer grows
+		 */
+		StreamingBuffer(size_t elemSize, size_t initialCapacity);
+		~StreamingBuffer();
+
+		StreamingBuffer(const StreamingBuffer&) = delete;
+		StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+		/*
+		 * Reserves space for the given number of elements in the current frame, growing the buffer if required
+		 * @param count The number of elements to reserve
+		 * @returns A pointer into mapped GPU memory that the elements can be written to
+		 */
+		void* Reserve(size_t count);
+		template <typename T>
+		T* Reserve(size_t count) { return static_cast<T*>(Reserve(count)); }
+
+		/*
+		 * Marks the end of the current frame. This fences the current region, and moves to the next one
+		 */
+		void EndFrame();
+
+		/*
+		 * Gets the number of elements that have been written this frame
+		 */
+		size_t Count() const { return m_Count; }
+		/*
+		 * Gets the index of the first element of the current frame, for use as the first vertex or base instance
+		 */
+		size_t FirstElement() const { return m_Region * m_Capacity; }
+		/*
+		 * Gets the byte offset of the current frame within the underlying buffer
+		 */
+		size_t FirstByte() const { return FirstElement() * m_ElemSize; }
+		/*
+		 * Gets the number of elements that each frame can hold before the buffer has to grow
+		 */
+		size_t Capacity() const { return m_Capacity; }
+		/*
+		 * Gets the size of a single element, in bytes
+		 */
+		size_t ElementSize() const { return m_ElemSize; }
+
+		/*
+		 * Gets the underlying OpenGL buffer. Note that this handle will change when the buffer grows
+		 */
+		GLuint GetHandle() const { return m_Handle; }
+
+	private:
+		GLuint    m_Handle;
+		uint8_t*  m_Mapped;
+		size_t    m_ElemSize;
+		size_t    m_Capacity;
+		size_t    m_Count;
+		size_t    m_Region;
+		GLsync    m_Fences[FrameCount];
+
+		void __Allocate(size_t capacity);
+		void __Grow(size_t required);
+		void __WaitForRegion();
+	};
+}
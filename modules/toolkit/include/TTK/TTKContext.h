@@ -14,28 +14,75 @@
 #pragma once
 
 #include <GLM/glm.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include "FontRenderer.h"
+#include "Frustum.h"
+#include "StreamingBuffer.h"
+#include "VertexLayout.h"
 
 namespace TTK
 {
 	namespace Impl {
 		class MeshHelper;
+		struct DebugRecorder;
+
+		// The primitive meshes that the mesh helper can draw
+		enum class MeshShape {
+			Teapot = 0,
+			Sphere,
+			Cube,
+			Cylinder,
+			Capsule,
+			Count
+		};
 	}
+
+	class DebugMesh;
 	
 	class Context {
 	public:
+		// Colors are packed into RGBA8, see PackRGBA8
 		struct SimpleVert {
 			glm::vec3 Position;
-			glm::vec4 Color;
+			uint32_t  Color;
+
+			static VertexLayout GetLayout() {
+				return VertexLayout(sizeof(SimpleVert)).Float(0, 3, offsetof(SimpleVert, Position)).RGBA8(1, offsetof(SimpleVert, Color));
+			}
 		};
 
 		struct PointVert
 		{
 			glm::vec3 Position;
-			glm::vec4 Color;
+			uint32_t  Color;
 			float     Size;
+
+			static VertexLayout GetLayout() {
+				return VertexLayout(sizeof(PointVert)).Float(0, 3, offsetof(PointVert, Position)).RGBA8(1, offsetof(PointVert, Color)).Float(2, 1, offsetof(PointVert, Size));
+			}
+		};
+
+		struct MeshInstance
+		{
+			glm::mat4 Transform;
+			uint32_t  Color;
+
+			// Note that the transform takes up 4 attribute slots, one per column
+			static VertexLayout GetLayout() {
+				VertexLayout result(sizeof(MeshInstance), 1);
+				for (GLuint col = 0; col < 4; col++)
+					result.Float(col, 4, static_cast<GLint>(offsetof(MeshInstance, Transform) + sizeof(glm::vec4) * col));
+				return result.RGBA8(4, offsetof(MeshInstance, Color));
+			}
 		};
 		
+		/*
+		 * Gets the context instance. The context must first be created on the thread that owns the GL context,
+		 * after which it may be used for recording primitives from any thread
+		 */
 		inline static Context& Instance() {
 			if (m_Instance == nullptr)
 				m_Instance = new Context();
@@ -51,13 +98,23 @@ namespace TTK
 	public:
 		~Context();
 
-		void SetProjection(const glm::mat4& value) { m_Projection = value; m_ViewProjection = m_Projection * m_ViewMatrix; }
+		void SetProjection(const glm::mat4& value) { m_Projection = value; __UpdateViewProjection(); }
 		const glm::mat4& GetProjection() const { return m_Projection; }
 
-		void SetView(const glm::mat4& value) { m_ViewMatrix = value; m_ViewProjection = m_Projection * m_ViewMatrix; }
+		void SetView(const glm::mat4& value) { m_ViewMatrix = value; __UpdateViewProjection(); }
 		const glm::mat4& GetView() const { return m_ViewMatrix; }
 
 		const glm::mat4& GetViewProjection() const { return m_ViewProjection; }
+		const Frustum& GetFrustum() const { return m_Frustum; }
+
+		/*
+		 * Sets whether primitives, meshes and debug meshes that are entirely outside of the view frustum should be
+		 * discarded before they are queued. Primitives from the render thread are tested against the frustum when they
+		 * are added, primitives from other threads are tested against the frustum when they are flushed. Points are
+		 * tested by their center only, so large points may pop at the edges of the screen
+		 */
+		void SetCullingEnabled(bool enabled) { m_CullingEnabled = enabled; }
+		bool IsCullingEnabled() const { return m_CullingEnabled; }
 		
 		glm::mat4 GetOrthoProjection() const;
 		
@@ -65,15 +122,43 @@ namespace TTK
 		void SetViewport(int x, int y, int w, int h);
 
 		void RenderText(const char* text, const glm::vec2& position, const glm::vec4& color, float scale = 1.0f);
+		/*
+		 * Gets the font used by RenderText, this is loaded the first time it is needed from the font bundled with
+		 * TTK (res/fonts), falling back to the system's Consolas
+		 */
+		TTK::TrueTypeTextureFont* GetDefaultFont();
 		
-		void DrawTeapot(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f)) const;
-		void DrawSphere(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f)) const;
-		void DrawCube(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f)) const;
+		void DrawTeapot(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f));
+		void DrawSphere(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f));
+		void DrawCube(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f));
+		void DrawCylinder(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f));
+		void DrawCapsule(const glm::mat4& mat, const glm::vec4& color = glm::vec4(1.0f));
+
+		/*
+		 * Sets how finely spheres, cylinders and capsules are tessellated, trading smoothness for vertex count.
+		 * Must be called from the thread that created the context
+		 * @param slices The number of segments around the Y axis (minimum 3, default 24). Very fine levels are clamped so every mesh fits in 16 bit indices
+		 * @param stacks The number of segments from pole to pole of the sphere (minimum 2, default 16), capsules
+		 *               get half of this per hemisphere
+		 */
+		void SetPrimitiveTessellation(int slices, int stacks);
 
+		/*
+		 * Adds primitives to the current frame. These may be called from any thread, calls made from threads
+		 * other than the one that created the context are recorded into a per-thread buffer and merged in the
+		 * next call to Flush
+		 */
 		void AddLine(const glm::vec3& a, const glm::vec3& b, const glm::vec4& color = {0, 0, 0, 1});
 		void AddTri(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c, const glm::vec4& color = { 0, 0, 0, 1 });
 		void AddQuad(const glm::vec3& min, const glm::vec3& max, const glm::vec4& color = { 0, 0, 0, 1 });
 		void AddPoint(const glm::vec3& pos, float size, const glm::vec4& color = { 0, 0, 0, 1 });
+
+		/*
+		 * Queues a baked debug mesh to be drawn with the given transform when the context is next flushed
+		 * @param mesh The mesh to draw, the context will keep it alive until it has been drawn
+		 * @param transform The model matrix to draw the mesh with
+		 */
+		void DrawDebugMesh(const std::shared_ptr<DebugMesh>& mesh, const glm::mat4& transform = glm::mat4(1.0f));
 		
 		void Flush();
 
@@ -82,34 +167,55 @@ namespace TTK
 		glm::mat4				  m_Projection;
 		glm::mat4                 m_ViewMatrix;
 		glm::mat4                 m_ViewProjection;
+		Frustum                   m_Frustum;
+		bool                      m_CullingEnabled;
 		TTK::TrueTypeTextureFont* m_DefaultFont;
 		Impl::MeshHelper*         m_MeshHelper;
 
 		GLuint m_ShaderHandle;
 		GLuint m_PointShaderHandle;
 		struct GLBuff {
-			GLuint VBO, VAO;
-			size_t Count;
-			size_t ElemSize;
-			GLenum Mode;
-			void*  Data;
-			GLuint Shader;
+			GLuint           VAO;
+			GLuint           BoundVBO;
+			GLenum           Mode;
+			GLuint           Shader;
+			StreamingBuffer* Stream;
 		};
 		GLBuff m_Tris, m_Lines, m_Points;
 
+		// Per-shape instance data for the mesh helper, drawn with one instanced call per shape
+		StreamingBuffer* m_MeshInstances[static_cast<size_t>(Impl::MeshShape::Count)];
+
+		// Retained meshes that have been queued for drawing this frame
+		struct DebugMeshDraw {
+			std::shared_ptr<DebugMesh> Mesh;
+			glm::mat4                  Transform;
+		};
+		std::vector<DebugMeshDraw> m_DebugMeshDraws;
+
+		// Recording buffers for threads other than the render thread, the mutex only guards registration.
+		// Recorders are shared with their thread, and released once it has exited
+		std::thread::id                             m_RenderThread;
+		uint32_t                                    m_Generation;
+		std::mutex                                  m_RecorderMutex;
+		std::vector<std::shared_ptr<Impl::DebugRecorder>> m_Recorders;
+
 		int m_WindowWidth, m_WindowHeight;
 		int m_viewportX, m_viewportY;
 
-		GLBuff __InitBuff(GLenum mode, GLuint shader, void* dataSource, size_t elemSize, size_t maxElems);
+		void __UpdateViewProjection() { m_ViewProjection = m_Projection * m_ViewMatrix; m_Frustum.Update(m_ViewProjection); }
+		GLBuff __InitBuff(GLenum mode, GLuint shader, const VertexLayout& layout, size_t initialElems);
 		void __Flush(GLBuff& buff);
+		void __QueueMesh(Impl::MeshShape shape, const glm::mat4& mat, const glm::vec4& color);
+		void __FlushDebugMeshes();
+		Impl::DebugRecorder* __GetRecorder();
+		void __MergeRecorders();
 		GLuint __CompileShader(const char* vsSource, const char* fsSource);
 
-		static const size_t MaxPointVerts = 512;
-		static const size_t MaxLineVerts = 512 * 2;
-		static const size_t MaxTriVerts = 512 * 3;
-
-		PointVert  m_PointVerts[MaxPointVerts];
-		SimpleVert m_LineVerts[MaxLineVerts];
-		SimpleVert m_TriVerts[MaxTriVerts];
+		// These are only the starting sizes, the streaming buffers will grow as required
+		static const size_t InitialPointVerts = 512;
+		static const size_t InitialLineVerts = 512 * 2;
+		static const size_t InitialTriVerts = 512 * 3;
+		static const size_t InitialMeshInstances = 256;
 	};
 }
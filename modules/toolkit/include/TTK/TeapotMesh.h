@@ -0,0 +1,1618 @@
+#pragma once
+/*
+ * This file was generated by modules/toolkit/tools/PackMesh.py from Teapot.h, do not edit it by hand.
+ * Positions are normalized 16 bit integers (x, y, z, padding) relative to the mesh bounds,
+ * use the offset and scale to get back to model space.
+ * 3241 unique vertices, 6320 triangles
+ */
+#include <cstdint>
+
+const float TeapotOffset[] = { 0.21700f, 1.57500f, 0.00000f };
+const float TeapotScale[] = { 3.21700f, 1.57500f, 2.00000f };
+
+const int16_t TeapotVertices[] = {
+11724, 17901, -3726, 0, 11866, 17164, -3763, 0, 12050, 17164, 0, 0, 11906, 17901, 0, 0,
+11197, 17901, -7244, 0, 11333, 17164, -7318, 0, 10351, 17901, -10512, 0, 10479, 17164, -10619, 0,
+9214, 17901, -13486, 0, 9330, 17164, -13623, 0, 7812, 17901, -16122, 0, 7914, 17164, -16285, 0,
+6174, 17901, -18376, 0, 6259, 17164, -18562, 0, 4325, 17901, -20205, 0, 4391, 17164, -20410, 0,
+2293, 17901, -21566, 0, 2339, 17164, -21784, 0, 106, 17901, -22414, 0, 129, 17164, -22642, 0,
+-2210, 17901, -22706, 0, -2210, 17164, -22937, 0, 11669, 18474, -3711, 0, 11850, 18474, 0, 0,
+11144, 18474, -7215, 0, 10301, 18474, -10470, 0, 9168, 18474, -13432, 0, 7772, 18474, -16057, 0,
+6140, 18474, -18302, 0, 4299, 18474, -20125, 0, 2275, 18474, -21480, 0, 97, 18474, -22324, 0,
+-2210, 18474, -22616, 0, 11687, 18884, -3716, 0, 11869, 18884, 0, 0, 11161, 18884, -7225, 0,
+10318, 18884, -10484, 0, 9183, 18884, -13450, 0, 7786, 18884, -16078, 0, 6151, 18884, -18327, 0,
+4308, 18884, -20151, 0, 2281, 18884, -21508, 0, 100, 18884, -22354, 0, -2210, 18884, -22646, 0,
+11767, 19130, -3737, 0, 11950, 19130, 0, 0, 11238, 19130, -7267, 0, 10390, 19130, -10545, 0,
+9249, 19130, -13527, 0, 7843, 19130, -16171, 0, 6200, 19130, -18432, 0, 4345, 19130, -20267, 0,
+2307, 19130, -21632, 0, 113, 19130, -22483, 0, -2210, 19130, -22776, 0, 11897, 19212, -3772, 0,
+12081, 19212, 0, 0, 11363, 19212, -7334, 0, 10507, 19212, -10643, 0, 9356, 19212, -13653, 0,
+7937, 19212, -16322, 0, 6278, 19212, -18604, 0, 4406, 19212, -20456, 0, 2349, 19212, -21833, 0,
+135, 19212, -22692, 0, -2210, 19212, -22988, 0, 12065, 19130, -3817, 0, 12251, 19130, 0, 0,
+11525, 19130, -7421, 0, 10658, 19130, -10769, 0, 9493, 19130, -13815, 0, 8057, 19130, -16516, 0,
+6379, 19130, -18825, 0, 4485, 19130, -20699, 0, 2403, 19130, -22093, 0, 163, 19130, -22962, 0,
+-2210, 19130, -23261, 0, 12258, 18884, -3868, 0, 12447, 18884, 0, 0, 11711, 18884, -7522, 0,
+10832, 18884, -10915, 0, 9652, 18884, -14002, 0, 8196, 18884, -16739, 0, 6495, 18884, -19080, 0,
+4575, 18884, -20979, 0, 2466, 18884, -22392, 0, 195, 18884, -23273, 0, -2210, 18884, -23576, 0,
+12465, 18474, -3924, 0, 12657, 18474, 0, 0, 11910, 18474, -7629, 0, 11019, 18474, -11071, 0,
+9821, 18474, -14203, 0, 8345, 18474, -16979, 0, 6620, 18474, -19353, 0, 4673, 18474, -21279, 0,
+2533, 18474, -22712, 0, 229, 18474, -23605, 0, -2210, 18474, -23913, 0, 12674, 17901, -3979, 0,
+12868, 17901, 0, 0, 12110, 17901, -7738, 0, 11207, 17901, -11228, 0, 9992, 17901, -14404, 0,
+8495, 17901, -17220, 0, 6745, 17901, -19627, 0, 4770, 17901, -21581, 0, 2600, 17901, -23034, 0,
+264, 17901, -23941, 0, -2210, 17901, -24253, 0, 12871, 17164, -4032, 0, 13068, 17164, 0, 0,
+12301, 17164, -7840, 0, 11385, 17164, -11377, 0, 10154, 17164, -14596, 0, 8637, 17164, -17448, 0,
+6864, 17164, -19888, 0, 4863, 17164, -21868, 0, 2664, 17164, -23341, 0, 297, 17164, -24259, 0,
+-2210, 17164, -24575, 0, -4526, 17901, -22414, 0, -4550, 17164, -22642, 0, -6714, 17901, -21566, 0,
+-6760, 17164, -21784, 0, -8746, 17901, -20205, 0, -8812, 17164, -20410, 0, -10594, 17901, -18376, 0,
+-10679, 17164, -18562, 0, -12233, 17901, -16122, 0, -12335, 17164, -16285, 0, -13634, 17901, -13486, 0,
+-13750, 17164, -13623, 0, -14772, 17901, -10512, 0, -14899, 17164, -10619, 0, -15618, 17901, -7244, 0,
+-15754, 17164, -7318, 0, -16145, 17901, -3726, 0, -16286, 17164, -3763, 0, -16327, 17901, 0, 0,
+-16470, 17164, 0, 0, -4517, 18474, -22324, 0, -6696, 18474, -21480, 0, -8720, 18474, -20125, 0,
+-10561, 18474, -18302, 0, -12193, 18474, -16057, 0, -13589, 18474, -13432, 0, -14722, 18474, -10470, 0,
+-15564, 18474, -7215, 0, -16089, 18474, -3711, 0, -16270, 18474, 0, 0, -4520, 18884, -22354, 0,
+-6702, 18884, -21508, 0, -8728, 18884, -20151, 0, -10572, 18884, -18327, 0, -12206, 18884, -16078, 0,
+-13604, 18884, -13450, 0, -14738, 18884, -10484, 0, -15582, 18884, -7225, 0, -16108, 18884, -3716, 0,
+-16289, 18884, 0, 0, -4534, 19130, -22483, 0, -6728, 19130, -21632, 0, -8766, 19130, -20267, 0,
+-10620, 19130, -18432, 0, -12264, 19130, -16171, 0, -13670, 19130, -13527, 0, -14810, 19130, -10545, 0,
+-15659, 19130, -7267, 0, -16188, 19130, -3737, 0, -16370, 19130, 0, 0, -4555, 19212, -22692, 0,
+-6770, 19212, -21833, 0, -8827, 19212, -20456, 0, -10698, 19212, -18604, 0, -12357, 19212, -16322, 0,
+-13776, 19212, -13653, 0, -14928, 19212, -10643, 0, -15784, 19212, -7334, 0, -16318, 19212, -3772, 0,
+-16502, 19212, 0, 0, -4583, 19130, -22962, 0, -6824, 19130, -22093, 0, -8905, 19130, -20699, 0,
+-10799, 19130, -18825, 0, -12478, 19130, -16516, 0, -13914, 19130, -13815, 0, -15079, 19130, -10769, 0,
+-15945, 19130, -7421, 0, -16485, 19130, -3817, 0, -16672, 19130, 0, 0, -4615, 18884, -23273, 0,
+-6887, 18884, -22392, 0, -8996, 18884, -20979, 0, -10916, 18884, -19080, 0, -12617, 18884, -16739, 0,
+-14072, 18884, -14002, 0, -15253, 18884, -10915, 0, -16131, 18884, -7522, 0, -16679, 18884, -3868, 0,
+-16868, 18884, 0, 0, -4650, 18474, -23605, 0, -6953, 18474, -22712, 0, -9093, 18474, -21279, 0,
+-11040, 18474, -19353, 0, -12766, 18474, -16979, 0, -14242, 18474, -14203, 0, -15439, 18474, -11071, 0,
+-16330, 18474, -7629, 0, -16886, 18474, -3924, 0, -17077, 18474, 0, 0, -4684, 17901, -23941, 0,
+-7021, 17901, -23034, 0, -9191, 17901, -21581, 0, -11165, 17901, -19627, 0, -12916, 17901, -17220, 0,
+-14413, 17901, -14404, 0, -15627, 17901, -11228, 0, -16531, 17901, -7738, 0, -17094, 17901, -3979, 0,
+-17288, 17901, 0, 0, -4717, 17164, -24259, 0, -7085, 17164, -23341, 0, -9284, 17164, -21868, 0,
+-11284, 17164, -19888, 0, -13058, 17164, -17448, 0, -14575, 17164, -14596, 0, -15806, 17164, -11377, 0,
+-16721, 17164, -7840, 0, -17292, 17164, -4032, 0, -17489, 17164, 0, 0, -16145, 17901, 3726, 0,
+-16286, 17164, 3763, 0, -15618, 17901, 7244, 0, -15754, 17164, 7318, 0, -14772, 17901, 10512, 0,
+-14899, 17164, 10619, 0, -13634, 17901, 13486, 0, -13750, 17164, 13623, 0, -12233, 17901, 16122, 0,
+-12335, 17164, 16285, 0, -10594, 17901, 18376, 0, -10679, 17164, 18562, 0, -8746, 17901, 20205, 0,
+-8812, 17164, 20410, 0, -6714, 17901, 21566, 0, -6760, 17164, 21784, 0, -4526, 17901, 22414, 0,
+-4550, 17164, 22642, 0, -2210, 17901, 22706, 0, -2210, 17164, 22937, 0, -16089, 18474, 3711, 0,
+-15564, 18474, 7215, 0, -14722, 18474, 10470, 0, -13589, 18474, 13432, 0, -12193, 18474, 16057, 0,
+-10561, 18474, 18302, 0, -8720, 18474, 20125, 0, -6696, 18474, 21480, 0, -4517, 18474, 22324, 0,
+-2210, 18474, 22616, 0, -16108, 18884, 3716, 0, -15582, 18884, 7225, 0, -14738, 18884, 10484, 0,
+-13604, 18884, 13450, 0, -12206, 18884, 16078, 0, -10572, 18884, 18327, 0, -8728, 18884, 20151, 0,
+-6702, 18884, 21508, 0, -4520, 18884, 22354, 0, -2210, 18884, 22646, 0, -16188, 19130, 3737, 0,
+-15659, 19130, 7267, 0, -14810, 19130, 10545, 0, -13670, 19130, 13527, 0, -12264, 19130, 16171, 0,
+-10620, 19130, 18432, 0, -8766, 19130, 20267, 0, -6728, 19130, 21632, 0, -4534, 19130, 22483, 0,
+-2210, 19130, 22776, 0, -16318, 19212, 3772, 0, -15784, 19212, 7334, 0, -14928, 19212, 10643, 0,
+-13776, 19212, 13653, 0, -12357, 19212, 16322, 0, -10698, 19212, 18604, 0, -8827, 19212, 20456, 0,
+-6770, 19212, 21833, 0, -4555, 19212, 22692, 0, -2210, 19212, 22988, 0, -16485, 19130, 3817, 0,
+-15945, 19130, 7421, 0, -15079, 19130, 10769, 0, -13914, 19130, 13815, 0, -12478, 19130, 16516, 0,
+-10799, 19130, 18825, 0, -8905, 19130, 20699, 0, -6824, 19130, 22093, 0, -4583, 19130, 22962, 0,
+-2210, 19130, 23261, 0, -16679, 18884, 3868, 0, -16131, 18884, 7522, 0, -15253, 18884, 10915, 0,
+-14072, 18884, 14002, 0, -12617, 18884, 16739, 0, -10916, 18884, 19080, 0, -8996, 18884, 20979, 0,
+-6887, 18884, 22392, 0, -4615, 18884, 23273, 0, -2210, 18884, 23576, 0, -16886, 18474, 3924, 0,
+-16330, 18474, 7629, 0, -15439, 18474, 11071, 0, -14242, 18474, 14203, 0, -12766, 18474, 16979, 0,
+-11040, 18474, 19353, 0, -9093, 18474, 21279, 0, -6953, 18474, 22712, 0, -4650, 18474, 23605, 0,
+-2210, 18474, 23913, 0, -17094, 17901, 3979, 0, -16531, 17901, 7738, 0, -15627, 17901, 11228, 0,
+-14413, 17901, 14404, 0, -12916, 17901, 17220, 0, -11165, 17901, 19627, 0, -9191, 17901, 21581, 0,
+-7021, 17901, 23034, 0, -4684, 17901, 23941, 0, -2210, 17901, 24253, 0, -17292, 17164, 4032, 0,
+-16721, 17164, 7840, 0, -15806, 17164, 11377, 0, -14575, 17164, 14596, 0, -13058, 17164, 17448, 0,
+-11284, 17164, 19888, 0, -9284, 17164, 21868, 0, -7085, 17164, 23341, 0, -4717, 17164, 24259, 0,
+-2210, 17164, 24575, 0, 106, 17901, 22414, 0, 129, 17164, 22642, 0, 2293, 17901, 21566, 0,
+2339, 17164, 21784, 0, 4325, 17901, 20205, 0, 4391, 17164, 20410, 0, 6174, 17901, 18376, 0,
+6259, 17164, 18562, 0, 7812, 17901, 16122, 0, 7914, 17164, 16285, 0, 9214, 17901, 13486, 0,
+9330, 17164, 13623, 0, 10351, 17901, 10512, 0, 10479, 17164, 10619, 0, 11197, 17901, 7244, 0,
+11333, 17164, 7318, 0, 11724, 17901, 3726, 0, 11866, 17164, 3763, 0, 97, 18474, 22324, 0,
+2275, 18474, 21480, 0, 4299, 18474, 20125, 0, 6140, 18474, 18302, 0, 7772, 18474, 16057, 0,
+9168, 18474, 13432, 0, 10301, 18474, 10470, 0, 11144, 18474, 7215, 0, 11669, 18474, 3711, 0,
+100, 18884, 22354, 0, 2281, 18884, 21508, 0, 4308, 18884, 20151, 0, 6151, 18884, 18327, 0,
+7786, 18884, 16078, 0, 9183, 18884, 13450, 0, 10318, 18884, 10484, 0, 11161, 18884, 7225, 0,
+11687, 18884, 3716, 0, 113, 19130, 22483, 0, 2307, 19130, 21632, 0, 4345, 19130, 20267, 0,
+6200, 19130, 18432, 0, 7843, 19130, 16171, 0, 9249, 19130, 13527, 0, 10390, 19130, 10545, 0,
+11238, 19130, 7267, 0, 11767, 19130, 3737, 0, 135, 19212, 22692, 0, 2349, 19212, 21833, 0,
+4406, 19212, 20456, 0, 6278, 19212, 18604, 0, 7937, 19212, 16322, 0, 9356, 19212, 13653, 0,
+10507, 19212, 10643, 0, 11363, 19212, 7334, 0, 11897, 19212, 3772, 0, 163, 19130, 22962, 0,
+2403, 19130, 22093, 0, 4485, 19130, 20699, 0, 6379, 19130, 18825, 0, 8057, 19130, 16516, 0,
+9493, 19130, 13815, 0, 10658, 19130, 10769, 0, 11525, 19130, 7421, 0, 12065, 19130, 3817, 0,
+195, 18884, 23273, 0, 2466, 18884, 22392, 0, 4575, 18884, 20979, 0, 6495, 18884, 19080, 0,
+8196, 18884, 16739, 0, 9652, 18884, 14002, 0, 10832, 18884, 10915, 0, 11711, 18884, 7522, 0,
+12258, 18884, 3868, 0, 229, 18474, 23605, 0, 2533, 18474, 22712, 0, 4673, 18474, 21279, 0,
+6620, 18474, 19353, 0, 8345, 18474, 16979, 0, 9821, 18474, 14203, 0, 11019, 18474, 11071, 0,
+11910, 18474, 7629, 0, 12465, 18474, 3924, 0, 264, 17901, 23941, 0, 2600, 17901, 23034, 0,
+4770, 17901, 21581, 0, 6745, 17901, 19627, 0, 8495, 17901, 17220, 0, 9992, 17901, 14404, 0,
+11207, 17901, 11228, 0, 12110, 17901, 7738, 0, 12674, 17901, 3979, 0, 297, 17164, 24259, 0,
+2664, 17164, 23341, 0, 4863, 17164, 21868, 0, 6864, 17164, 19888, 0, 8637, 17164, 17448, 0,
+10154, 17164, 14596, 0, 11385, 17164, 11377, 0, 12301, 17164, 7840, 0, 12871, 17164, 4032, 0,
+13623, 13888, -4233, 0, 13829, 13888, 0, 0, 13024, 13888, -8231, 0, 12063, 13888, -11944, 0,
+10770, 13888, -15323, 0, 9178, 13888, -18318, 0, 7316, 13888, -20879, 0, 5216, 13888, -22958, 0,
+2907, 13888, -24504, 0, 422, 13888, -25468, 0, -2210, 13888, -25800, 0, 14359, 10623, -4430, 0,
+14576, 10623, 0, 0, 13732, 10623, -8614, 0, 12726, 10623, -12500, 0, 11374, 10623, -16036, 0,
+9708, 10623, -19170, 0, 7759, 10623, -21851, 0, 5561, 10623, -24026, 0, 3145, 10623, -25643, 0,
+544, 10623, -26652, 0, -2210, 10623, -27000, 0, 15066, 7376, -4619, 0, 15291, 7376, 0, 0,
+14412, 7376, -8981, 0, 13363, 7376, -13033, 0, 11953, 7376, -16719, 0, 10216, 7376, -19987, 0,
+8184, 7376, -22782, 0, 5892, 7376, -25050, 0, 3373, 7376, -26737, 0, 661, 7376, -27788, 0,
+-2210, 7376, -28151, 0, 15727, 4157, -4796, 0, 15961, 4157, 0, 0, 15048, 4157, -9325, 0,
+13959, 4157, -13531, 0, 12495, 4157, -17359, 0, 10691, 4157, -20752, 0, 8582, 4157, -23654, 0,
+6202, 4157, -26008, 0, 3587, 4157, -27760, 0, 771, 4157, -28852, 0, -2210, 4157, -29228, 0,
+16327, 975, -4956, 0, 16569, 975, 0, 0, 15626, 975, -9637, 0, 14501, 975, -13985, 0,
+12988, 975, -17941, 0, 11123, 975, -21447, 0, 8943, 975, -24446, 0, 6484, 975, -26879, 0,
+3781, 975, -28689, 0, 871, 975, -29818, 0, -2210, 975, -30207, 0, 16853, -2160, -5097, 0,
+17102, -2160, 0, 0, 16131, -2160, -9910, 0, 14974, -2160, -14381, 0, 13418, -2160, -18449, 0,
+11501, -2160, -22055, 0, 9259, -2160, -25139, 0, 6730, -2160, -27641, 0, 3951, -2160, -29503, 0,
+958, -2160, -30663, 0, -2210, -2160, -31063, 0, 17288, -5238, -5213, 0, 17542, -5238, 0, 0,
+16550, -5238, -10136, 0, 15366, -5238, -14709, 0, 13775, -5238, -18870, 0, 11814, -5238, -22558, 0,
+9521, -5238, -25712, 0, 6934, -5238, -28272, 0, 4092, -5238, -30175, 0, 1031, -5238, -31362, 0,
+-2210, -5238, -31772, 0, 17617, -8251, -5301, 0, 17876, -8251, 0, 0, 16867, -8251, -10308, 0,
+15663, -8251, -14957, 0, 14045, -8251, -19189, 0, 12051, -8251, -22939, 0, 9719, -8251, -26146, 0,
+7089, -8251, -28749, 0, 4198, -8251, -30685, 0, 1085, -8251, -31892, 0, -2210, -8251, -32308, 0,
+17826, -11189, -5357, 0, 18087, -11189, 0, 0, 17067, -11189, -10416, 0, 15851, -11189, -15115, 0,
+14216, -11189, -19390, 0, 12201, -11189, -23180, 0, 9845, -11189, -26422, 0, 7187, -11189, -29052, 0,
+4265, -11189, -31008, 0, 1120, -11189, -32228, 0, -2210, -11189, -32648, 0, 17899, -14043, -5376, 0,
+18161, -14043, 0, 0, 17137, -14043, -10454, 0, 15917, -14043, -15170, 0, 14276, -14043, -19461, 0,
+12253, -14043, -23265, 0, 9889, -14043, -26518, 0, 7221, -14043, -29157, 0, 4289, -14043, -31121, 0,
+1132, -14043, -32345, 0, -2210, -14043, -32767, 0, -4842, 13888, -25468, 0, -7328, 13888, -24504, 0,
+-9636, 13888, -22958, 0, -11737, 13888, -20879, 0, -13598, 13888, -18318, 0, -15191, 13888, -15323, 0,
+-16483, 13888, -11944, 0, -17444, 13888, -8231, 0, -18043, 13888, -4233, 0, -18250, 13888, 0, 0,
+-4964, 10623, -26652, 0, -7566, 10623, -25643, 0, -9981, 10623, -24026, 0, -12180, 10623, -21851, 0,
+-14128, 10623, -19170, 0, -15795, 10623, -16036, 0, -17147, 10623, -12500, 0, -18153, 10623, -8614, 0,
+-18780, 10623, -4430, 0, -18996, 10623, 0, 0, -5082, 7376, -27788, 0, -7794, 7376, -26737, 0,
+-10313, 7376, -25050, 0, -12605, 7376, -22782, 0, -14636, 7376, -19987, 0, -16374, 7376, -16719, 0,
+-17784, 7376, -13033, 0, -18832, 7376, -8981, 0, -19486, 7376, -4619, 0, -19712, 7376, 0, 0,
+-5192, 4157, -28852, 0, -8008, 4157, -27760, 0, -10623, 4157, -26008, 0, -13002, 4157, -23654, 0,
+-15112, 4157, -20752, 0, -16916, 4157, -17359, 0, -18380, 4157, -13531, 0, -19468, 4157, -9325, 0,
+-20147, 4157, -4796, 0, -20381, 4157, 0, 0, -5292, 975, -29818, 0, -8202, 975, -28689, 0,
+-10904, 975, -26879, 0, -13364, 975, -24446, 0, -15544, 975, -21447, 0, -17408, 975, -17941, 0,
+-18921, 975, -13985, 0, -20046, 975, -9637, 0, -20748, 975, -4956, 0, -20990, 975, 0, 0,
+-5379, -2160, -30663, 0, -8372, -2160, -29503, 0, -11151, -2160, -27641, 0, -13680, -2160, -25139, 0,
+-15922, -2160, -22055, 0, -17839, -2160, -18449, 0, -19395, -2160, -14381, 0, -20552, -2160, -9910, 0,
+-21273, -2160, -5097, 0, -21522, -2160, 0, 0, -5451, -5238, -31362, 0, -8512, -5238, -30175, 0,
+-11355, -5238, -28272, 0, -13942, -5238, -25712, 0, -16234, -5238, -22558, 0, -18196, -5238, -18870, 0,
+-19787, -5238, -14709, 0, -20970, -5238, -10136, 0, -21708, -5238, -5213, 0, -21963, -5238, 0, 0,
+-5506, -8251, -31892, 0, -8619, -8251, -30685, 0, -11509, -8251, -28749, 0, -14140, -8251, -26146, 0,
+-16471, -8251, -22939, 0, -18465, -8251, -19189, 0, -20084, -8251, -14957, 0, -21287, -8251, -10308, 0,
+-22038, -8251, -5301, 0, -22296, -8251, 0, 0, -5541, -11189, -32228, 0, -8686, -11189, -31008, 0,
+-11607, -11189, -29052, 0, -14265, -11189, -26422, 0, -16621, -11189, -23180, 0, -18636, -11189, -19390, 0,
+-20272, -11189, -15115, 0, -21488, -11189, -10416, 0, -22246, -11189, -5357, 0, -22508, -11189, 0, 0,
+-5553, -14043, -32345, 0, -8709, -14043, -31121, 0, -11641, -14043, -29157, 0, -14309, -14043, -26518, 0,
+-16674, -14043, -23265, 0, -18696, -14043, -19461, 0, -20337, -14043, -15170, 0, -21558, -14043, -10454, 0,
+-22319, -14043, -5376, 0, -22581, -14043, 0, 0, -18043, 13888, 4233, 0, -17444, 13888, 8231, 0,
+-16483, 13888, 11944, 0, -15191, 13888, 15323, 0, -13598, 13888, 18318, 0, -11737, 13888, 20879, 0,
+-9636, 13888, 22958, 0, -7328, 13888, 24504, 0, -4842, 13888, 25468, 0, -2210, 13888, 25800, 0,
+-18780, 10623, 4430, 0, -18153, 10623, 8614, 0, -17147, 10623, 12500, 0, -15795, 10623, 16036, 0,
+-14128, 10623, 19170, 0, -12180, 10623, 21851, 0, -9981, 10623, 24026, 0, -7566, 10623, 25643, 0,
+-4964, 10623, 26652, 0, -2210, 10623, 27000, 0, -19486, 7376, 4619, 0, -18832, 7376, 8981, 0,
+-17784, 7376, 13033, 0, -16374, 7376, 16719, 0, -14636, 7376, 19987, 0, -12605, 7376, 22782, 0,
+-10313, 7376, 25050, 0, -7794, 7376, 26737, 0, -5082, 7376, 27788, 0, -2210, 7376, 28151, 0,
+-20147, 4157, 4796, 0, -19468, 4157, 9325, 0, -18380, 4157, 13531, 0, -16916, 4157, 17359, 0,
+-15112, 4157, 20752, 0, -13002, 4157, 23654, 0, -10623, 4157, 26008, 0, -8008, 4157, 27760, 0,
+-5192, 4157, 28852, 0, -2210, 4157, 29228, 0, -20748, 975, 4956, 0, -20046, 975, 9637, 0,
+-18921, 975, 13985, 0, -17408, 975, 17941, 0, -15544, 975, 21447, 0, -13364, 975, 24446, 0,
+-10904, 975, 26879, 0, -8202, 975, 28689, 0, -5292, 975, 29818, 0, -2210, 975, 30207, 0,
+-21273, -2160, 5097, 0, -20552, -2160, 9910, 0, -19395, -2160, 14381, 0, -17839, -2160, 18449, 0,
+-15922, -2160, 22055, 0, -13680, -2160, 25139, 0, -11151, -2160, 27641, 0, -8372, -2160, 29503, 0,
+-5379, -2160, 30663, 0, -2210, -2160, 31063, 0, -21708, -5238, 5213, 0, -20970, -5238, 10136, 0,
+-19787, -5238, 14709, 0, -18196, -5238, 18870, 0, -16234, -5238, 22558, 0, -13942, -5238, 25712, 0,
+-11355, -5238, 28272, 0, -8512, -5238, 30175, 0, -5451, -5238, 31362, 0, -2210, -5238, 31772, 0,
+-22038, -8251, 5301, 0, -21287, -8251, 10308, 0, -20084, -8251, 14957, 0, -18465, -8251, 19189, 0,
+-16471, -8251, 22939, 0, -14140, -8251, 26146, 0, -11509, -8251, 28749, 0, -8619, -8251, 30685, 0,
+-5506, -8251, 31892, 0, -2210, -8251, 32308, 0, -22246, -11189, 5357, 0, -21488, -11189, 10416, 0,
+-20272, -11189, 15115, 0, -18636, -11189, 19390, 0, -16621, -11189, 23180, 0, -14265, -11189, 26422, 0,
+-11607, -11189, 29052, 0, -8686, -11189, 31008, 0, -5541, -11189, 32228, 0, -2210, -11189, 32648, 0,
+-22319, -14043, 5376, 0, -21558, -14043, 10454, 0, -20337, -14043, 15170, 0, -18696, -14043, 19461, 0,
+-16674, -14043, 23265, 0, -14309, -14043, 26518, 0, -11641, -14043, 29157, 0, -8709, -14043, 31121, 0,
+-5553, -14043, 32345, 0, -2210, -14043, 32767, 0, 422, 13888, 25468, 0, 2907, 13888, 24504, 0,
+5216, 13888, 22958, 0, 7316, 13888, 20879, 0, 9178, 13888, 18318, 0, 10770, 13888, 15323, 0,
+12063, 13888, 11944, 0, 13024, 13888, 8231, 0, 13623, 13888, 4233, 0, 544, 10623, 26652, 0,
+3145, 10623, 25643, 0, 5561, 10623, 24026, 0, 7759, 10623, 21851, 0, 9708, 10623, 19170, 0,
+11374, 10623, 16036, 0, 12726, 10623, 12500, 0, 13732, 10623, 8614, 0, 14359, 10623, 4430, 0,
+661, 7376, 27788, 0, 3373, 7376, 26737, 0, 5892, 7376, 25050, 0, 8184, 7376, 22782, 0,
+10216, 7376, 19987, 0, 11953, 7376, 16719, 0, 13363, 7376, 13033, 0, 14412, 7376, 8981, 0,
+15066, 7376, 4619, 0, 771, 4157, 28852, 0, 3587, 4157, 27760, 0, 6202, 4157, 26008, 0,
+8582, 4157, 23654, 0, 10691, 4157, 20752, 0, 12495, 4157, 17359, 0, 13959, 4157, 13531, 0,
+15048, 4157, 9325, 0, 15727, 4157, 4796, 0, 871, 975, 29818, 0, 3781, 975, 28689, 0,
+6484, 975, 26879, 0, 8943, 975, 24446, 0, 11123, 975, 21447, 0, 12988, 975, 17941, 0,
+14501, 975, 13985, 0, 15626, 975, 9637, 0, 16327, 975, 4956, 0, 958, -2160, 30663, 0,
+3951, -2160, 29503, 0, 6730, -2160, 27641, 0, 9259, -2160, 25139, 0, 11501, -2160, 22055, 0,
+13418, -2160, 18449, 0, 14974, -2160, 14381, 0, 16131, -2160, 9910, 0, 16853, -2160, 5097, 0,
+1031, -5238, 31362, 0, 4092, -5238, 30175, 0, 6934, -5238, 28272, 0, 9521, -5238, 25712, 0,
+11814, -5238, 22558, 0, 13775, -5238, 18870, 0, 15366, -5238, 14709, 0, 16550, -5238, 10136, 0,
+17288, -5238, 5213, 0, 1085, -8251, 31892, 0, 4198, -8251, 30685, 0, 7089, -8251, 28749, 0,
+9719, -8251, 26146, 0, 12051, -8251, 22939, 0, 14045, -8251, 19189, 0, 15663, -8251, 14957, 0,
+16867, -8251, 10308, 0, 17617, -8251, 5301, 0, 1120, -11189, 32228, 0, 4265, -11189, 31008, 0,
+7187, -11189, 29052, 0, 9845, -11189, 26422, 0, 12201, -11189, 23180, 0, 14216, -11189, 19390, 0,
+15851, -11189, 15115, 0, 17067, -11189, 10416, 0, 17826, -11189, 5357, 0, 1132, -14043, 32345, 0,
+4289, -14043, 31121, 0, 7221, -14043, 29157, 0, 9889, -14043, 26518, 0, 12253, -14043, 23265, 0,
+14276, -14043, 19461, 0, 15917, -14043, 15170, 0, 17137, -14043, 10454, 0, 17899, -14043, 5376, 0,
+17758, -16713, -5339, 0, 18018, -16713, 0, 0, 17002, -16713, -10381, 0, 15790, -16713, -15064, 0,
+14160, -16713, -19325, 0, 12152, -16713, -23102, 0, 9804, -16713, -26332, 0, 7155, -16713, -28953, 0,
+4243, -16713, -30903, 0, 1109, -16713, -32119, 0, -2210, -16713, -32538, 0, 17376, -19111, -5237, 0,
+17631, -19111, 0, 0, 16634, -19111, -10182, 0, 15446, -19111, -14775, 0, 13847, -19111, -18955, 0,
+11877, -19111, -22660, 0, 9574, -19111, -25828, 0, 6976, -19111, -28399, 0, 4120, -19111, -30312, 0,
+1045, -19111, -31504, 0, -2210, -19111, -31915, 0, 16813, -21247, -5086, 0, 17061, -21247, 0, 0,
+16093, -21247, -9889, 0, 14938, -21247, -14351, 0, 13385, -21247, -18410, 0, 11472, -21247, -22008, 0,
+9235, -21247, -25086, 0, 6711, -21247, -27583, 0, 3938, -21247, -29440, 0, 952, -21247, -30598, 0,
+-2210, -21247, -30998, 0, 16129, -23130, -4903, 0, 16368, -23130, 0, 0, 15435, -23130, -9534, 0,
+14322, -23130, -13835, 0, 12825, -23130, -17748, 0, 10980, -23130, -21217, 0, 8824, -23130, -24184, 0,
+6391, -23130, -26592, 0, 3717, -23130, -28382, 0, 838, -23130, -29499, 0, -2210, -23130, -29884, 0,
+15385, -24770, -4704, 0, 15614, -24770, 0, 0, 14719, -24770, -9147, 0, 13651, -24770, -13274, 0,
+12215, -24770, -17028, 0, 10445, -24770, -20356, 0, 8376, -24770, -23203, 0, 6042, -24770, -25513, 0,
+3477, -24770, -27231, 0, 714, -24770, -28302, 0, -2210, -24770, -28671, 0, 14641, -26176, -4505, 0,
+14861, -26176, 0, 0, 14003, -26176, -8760, 0, 12980, -26176, -12712, 0, 11605, -26176, -16308, 0,
+9910, -26176, -19496, 0, 7929, -26176, -22222, 0, 5693, -26176, -24434, 0, 3236, -26176, -26079, 0,
+591, -26176, -27105, 0, -2210, -26176, -27459, 0, 13957, -27357, -4323, 0, 14168, -27357, 0, 0,
+13345, -27357, -8405, 0, 12364, -27357, -12197, 0, 11044, -27357, -15647, 0, 9418, -27357, -18705, 0,
+7517, -27357, -21320, 0, 5372, -27357, -23442, 0, 3015, -27357, -25021, 0, 477, -27357, -26005, 0,
+-2210, -27357, -26345, 0, 13394, -28323, -4172, 0, 13598, -28323, 0, 0, 12804, -28323, -8112, 0,
+11856, -28323, -11772, 0, 10583, -28323, -15102, 0, 9013, -28323, -18053, 0, 7178, -28323, -20578, 0,
+5108, -28323, -22626, 0, 2833, -28323, -24150, 0, 383, -28323, -25100, 0, -2210, -28323, -25427, 0,
+13012, -29083, -4070, 0, 13211, -29083, 0, 0, 12436, -29083, -7914, 0, 11512, -29083, -11484, 0,
+10270, -29083, -14732, 0, 8739, -29083, -17611, 0, 6949, -29083, -20074, 0, 4929, -29083, -22072, 0,
+2710, -29083, -23558, 0, 320, -29083, -24485, 0, -2210, -29083, -24805, 0, 12871, -29646, -4032, 0,
+13068, -29646, 0, 0, 12301, -29646, -7840, 0, 11385, -29646, -11377, 0, 10154, -29646, -14596, 0,
+8637, -29646, -17448, 0, 6864, -29646, -19888, 0, 4863, -29646, -21868, 0, 2664, -29646, -23341, 0,
+297, -29646, -24259, 0, -2210, -29646, -24575, 0, -5529, -16713, -32119, 0, -8664, -16713, -30903, 0,
+-11575, -16713, -28953, 0, -14224, -16713, -26332, 0, -16573, -16713, -23102, 0, -18581, -16713, -19325, 0,
+-20210, -16713, -15064, 0, -21423, -16713, -10381, 0, -22178, -16713, -5339, 0, -22439, -16713, 0, 0,
+-5466, -19111, -31504, 0, -8541, -19111, -30312, 0, -11396, -19111, -28399, 0, -13995, -19111, -25828, 0,
+-16298, -19111, -22660, 0, -18268, -19111, -18955, 0, -19866, -19111, -14775, 0, -21055, -19111, -10182, 0,
+-21796, -19111, -5237, 0, -22052, -19111, 0, 0, -5372, -21247, -30598, 0, -8358, -21247, -29440, 0,
+-11132, -21247, -27583, 0, -13656, -21247, -25086, 0, -15893, -21247, -22008, 0, -17806, -21247, -18410, 0,
+-19359, -21247, -14351, 0, -20513, -21247, -9889, 0, -21233, -21247, -5086, 0, -21481, -21247, 0, 0,
+-5259, -23130, -29499, 0, -8138, -23130, -28382, 0, -10811, -23130, -26592, 0, -13244, -23130, -24184, 0,
+-15401, -23130, -21217, 0, -17246, -23130, -17748, 0, -18742, -23130, -13835, 0, -19855, -23130, -9534, 0,
+-20550, -23130, -4903, 0, -20789, -23130, 0, 0, -5135, -24770, -28302, 0, -7897, -24770, -27231, 0,
+-10462, -24770, -25513, 0, -12797, -24770, -23203, 0, -14866, -24770, -20356, 0, -16635, -24770, -17028, 0,
+-18071, -24770, -13274, 0, -19140, -24770, -9147, 0, -19805, -24770, -4704, 0, -20035, -24770, 0, 0,
+-5011, -26176, -27105, 0, -7657, -26176, -26079, 0, -10113, -26176, -24434, 0, -12349, -26176, -22222, 0,
+-14331, -26176, -19496, 0, -16025, -26176, -16308, 0, -17401, -26176, -12712, 0, -18424, -26176, -8760, 0,
+-19061, -26176, -4505, 0, -19281, -26176, 0, 0, -4898, -27357, -26005, 0, -7436, -27357, -25021, 0,
+-9793, -27357, -23442, 0, -11938, -27357, -21320, 0, -13839, -27357, -18705, 0, -15465, -27357, -15647, 0,
+-16784, -27357, -12197, 0, -17766, -27357, -8405, 0, -18378, -27357, -4323, 0, -18589, -27357, 0, 0,
+-4804, -28323, -25100, 0, -7254, -28323, -24150, 0, -9529, -28323, -22626, 0, -11599, -28323, -20578, 0,
+-13434, -28323, -18053, 0, -15003, -28323, -15102, 0, -16277, -28323, -11772, 0, -17224, -28323, -8112, 0,
+-17815, -28323, -4172, 0, -18018, -28323, 0, 0, -4741, -29083, -24485, 0, -7130, -29083, -23558, 0,
+-9350, -29083, -22072, 0, -11369, -29083, -20074, 0, -13159, -29083, -17611, 0, -14690, -29083, -14732, 0,
+-15932, -29083, -11484, 0, -16857, -29083, -7914, 0, -17433, -29083, -4070, 0, -17631, -29083, 0, 0,
+-4717, -29646, -24259, 0, -7085, -29646, -23341, 0, -9284, -29646, -21868, 0, -11284, -29646, -19888, 0,
+-13058, -29646, -17448, 0, -14575, -29646, -14596, 0, -15806, -29646, -11377, 0, -16721, -29646, -7840, 0,
+-17292, -29646, -4032, 0, -17489, -29646, 0, 0, -22178, -16713, 5339, 0, -21423, -16713, 10381, 0,
+-20210, -16713, 15064, 0, -18581, -16713, 19325, 0, -16573, -16713, 23102, 0, -14224, -16713, 26332, 0,
+-11575, -16713, 28953, 0, -8664, -16713, 30903, 0, -5529, -16713, 32119, 0, -2210, -16713, 32538, 0,
+-21796, -19111, 5237, 0, -21055, -19111, 10182, 0, -19866, -19111, 14775, 0, -18268, -19111, 18955, 0,
+-16298, -19111, 22660, 0, -13995, -19111, 25828, 0, -11396, -19111, 28399, 0, -8541, -19111, 30312, 0,
+-5466, -19111, 31504, 0, -2210, -19111, 31915, 0, -21233, -21247, 5086, 0, -20513, -21247, 9889, 0,
+-19359, -21247, 14351, 0, -17806, -21247, 18410, 0, -15893, -21247, 22008, 0, -13656, -21247, 25086, 0,
+-11132, -21247, 27583, 0, -8358, -21247, 29440, 0, -5372, -21247, 30598, 0, -2210, -21247, 30998, 0,
+-20550, -23130, 4903, 0, -19855, -23130, 9534, 0, -18742, -23130, 13835, 0, -17246, -23130, 17748, 0,
+-15401, -23130, 21217, 0, -13244, -23130, 24184, 0, -10811, -23130, 26592, 0, -8138, -23130, 28382, 0,
+-5259, -23130, 29499, 0, -2210, -23130, 29884, 0, -19805, -24770, 4704, 0, -19140, -24770, 9147, 0,
+-18071, -24770, 13274, 0, -16635, -24770, 17028, 0, -14866, -24770, 20356, 0, -12797, -24770, 23203, 0,
+-10462, -24770, 25513, 0, -7897, -24770, 27231, 0, -5135, -24770, 28302, 0, -2210, -24770, 28671, 0,
+-19061, -26176, 4505, 0, -18424, -26176, 8760, 0, -17401, -26176, 12712, 0, -16025, -26176, 16308, 0,
+-14331, -26176, 19496, 0, -12349, -26176, 22222, 0, -10113, -26176, 24434, 0, -7657, -26176, 26079, 0,
+-5011, -26176, 27105, 0, -2210, -26176, 27459, 0, -18378, -27357, 4323, 0, -17766, -27357, 8405, 0,
+-16784, -27357, 12197, 0, -15465, -27357, 15647, 0, -13839, -27357, 18705, 0, -11938, -27357, 21320, 0,
+-9793, -27357, 23442, 0, -7436, -27357, 25021, 0, -4898, -27357, 26005, 0, -2210, -27357, 26345, 0,
+-17815, -28323, 4172, 0, -17224, -28323, 8112, 0, -16277, -28323, 11772, 0, -15003, -28323, 15102, 0,
+-13434, -28323, 18053, 0, -11599, -28323, 20578, 0, -9529, -28323, 22626, 0, -7254, -28323, 24150, 0,
+-4804, -28323, 25100, 0, -2210, -28323, 25427, 0, -17433, -29083, 4070, 0, -16857, -29083, 7914, 0,
+-15932, -29083, 11484, 0, -14690, -29083, 14732, 0, -13159, -29083, 17611, 0, -11369, -29083, 20074, 0,
+-9350, -29083, 22072, 0, -7130, -29083, 23558, 0, -4741, -29083, 24485, 0, -2210, -29083, 24805, 0,
+-17292, -29646, 4032, 0, -16721, -29646, 7840, 0, -15806, -29646, 11377, 0, -14575, -29646, 14596, 0,
+-13058, -29646, 17448, 0, -11284, -29646, 19888, 0, -9284, -29646, 21868, 0, -7085, -29646, 23341, 0,
+-4717, -29646, 24259, 0, -2210, -29646, 24575, 0, 1109, -16713, 32119, 0, 4243, -16713, 30903, 0,
+7155, -16713, 28953, 0, 9804, -16713, 26332, 0, 12152, -16713, 23102, 0, 14160, -16713, 19325, 0,
+15790, -16713, 15064, 0, 17002, -16713, 10381, 0, 17758, -16713, 5339, 0, 1045, -19111, 31504, 0,
+4120, -19111, 30312, 0, 6976, -19111, 28399, 0, 9574, -19111, 25828, 0, 11877, -19111, 22660, 0,
+13847, -19111, 18955, 0, 15446, -19111, 14775, 0, 16634, -19111, 10182, 0, 17376, -19111, 5237, 0,
+952, -21247, 30598, 0, 3938, -21247, 29440, 0, 6711, -21247, 27583, 0, 9235, -21247, 25086, 0,
+11472, -21247, 22008, 0, 13385, -21247, 18410, 0, 14938, -21247, 14351, 0, 16093, -21247, 9889, 0,
+16813, -21247, 5086, 0, 838, -23130, 29499, 0, 3717, -23130, 28382, 0, 6391, -23130, 26592, 0,
+8824, -23130, 24184, 0, 10980, -23130, 21217, 0, 12825, -23130, 17748, 0, 14322, -23130, 13835, 0,
+15435, -23130, 9534, 0, 16129, -23130, 4903, 0, 714, -24770, 28302, 0, 3477, -24770, 27231, 0,
+6042, -24770, 25513, 0, 8376, -24770, 23203, 0, 10445, -24770, 20356, 0, 12215, -24770, 17028, 0,
+13651, -24770, 13274, 0, 14719, -24770, 9147, 0, 15385, -24770, 4704, 0, 591, -26176, 27105, 0,
+3236, -26176, 26079, 0, 5693, -26176, 24434, 0, 7929, -26176, 22222, 0, 9910, -26176, 19496, 0,
+11605, -26176, 16308, 0, 12980, -26176, 12712, 0, 14003, -26176, 8760, 0, 14641, -26176, 4505, 0,
+477, -27357, 26005, 0, 3015, -27357, 25021, 0, 5372, -27357, 23442, 0, 7517, -27357, 21320, 0,
+9418, -27357, 18705, 0, 11044, -27357, 15647, 0, 12364, -27357, 12197, 0, 13345, -27357, 8405, 0,
+13957, -27357, 4323, 0, 383, -28323, 25100, 0, 2833, -28323, 24150, 0, 5108, -28323, 22626, 0,
+7178, -28323, 20578, 0, 9013, -28323, 18053, 0, 10583, -28323, 15102, 0, 11856, -28323, 11772, 0,
+12804, -28323, 8112, 0, 13394, -28323, 4172, 0, 320, -29083, 24485, 0, 2710, -29083, 23558, 0,
+4929, -29083, 22072, 0, 6949, -29083, 20074, 0, 8739, -29083, 17611, 0, 10270, -29083, 14732, 0,
+11512, -29083, 11484, 0, 12436, -29083, 7914, 0, 13012, -29083, 4070, 0, 297, -29646, 24259, 0,
+2664, -29646, 23341, 0, 4863, -29646, 21868, 0, 6864, -29646, 19888, 0, 8637, -29646, 17448, 0,
+10154, -29646, 14596, 0, 11385, -29646, 11377, 0, 12301, -29646, 7840, 0, 12871, -29646, 4032, 0,
+-20549, 9488, -1327, 0, -18479, 9493, -1327, 0, -18507, 9362, 0, 0, -20553, 9357, 0, 0,
+-20537, 9844, -2359, 0, -18401, 9849, -2359, 0, -20519, 10367, -3096, 0, -18287, 10373, -3096, 0,
+-20496, 11003, -3539, 0, -18149, 11010, -3539, 0, -20472, 11695, -3686, 0, -17998, 11703, -3686, 0,
+-20449, 12388, -3539, 0, -17847, 12395, -3539, 0, -20426, 13024, -3096, 0, -17709, 13032, -3096, 0,
+-20408, 13547, -2359, 0, -17595, 13556, -2359, 0, -20396, 13903, -1327, 0, -17517, 13912, -1327, 0,
+-20392, 14034, 0, 0, -17489, 14043, 0, 0, -22427, 9455, -1327, 0, -22410, 9325, 0, 0,
+-22471, 9807, -2359, 0, -22535, 10328, -3096, 0, -22614, 10959, -3539, 0, -22700, 11646, -3686, 0,
+-22785, 12333, -3539, 0, -22864, 12965, -3096, 0, -22929, 13485, -2359, 0, -22973, 13838, -1327, 0,
+-22989, 13968, 0, 0, -24105, 9363, -1327, 0, -24072, 9236, 0, 0, -24197, 9709, -2359, 0,
+-24333, 10219, -3096, 0, -24497, 10839, -3539, 0, -24676, 11513, -3686, 0, -24855, 12187, -3539, 0,
+-25019, 12806, -3096, 0, -25155, 13317, -2359, 0, -25247, 13663, -1327, 0, -25281, 13790, 0, 0,
+-25580, 9185, -1327, 0, -25531, 9062, 0, 0, -25712, 9518, -2359, 0, -25906, 10009, -3096, 0,
+-26142, 10605, -3539, 0, -26399, 11253, -3686, 0, -26656, 11902, -3539, 0, -26892, 12497, -3096, 0,
+-27086, 12988, -2359, 0, -27218, 13321, -1327, 0, -27267, 13444, 0, 0, -26844, 8892, -1327, 0,
+-26783, 8777, 0, 0, -27008, 9203, -2359, 0, -27250, 9662, -3096, 0, -27545, 10219, -3539, 0,
+-27865, 10825, -3686, 0, -28186, 11431, -3539, 0, -28480, 11988, -3096, 0, -28722, 12447, -2359, 0,
+-28887, 12758, -1327, 0, -28947, 12873, 0, 0, -27891, 8454, -1327, 0, -27821, 8351, 0, 0,
+-28081, 8733, -2359, 0, -28361, 9144, -3096, 0, -28701, 9643, -3539, 0, -29072, 10186, -3686, 0,
+-29442, 10729, -3539, 0, -29782, 11228, -3096, 0, -30062, 11639, -2359, 0, -30252, 11918, -1327, 0,
+-30322, 12021, 0, 0, -28716, 7842, -1327, 0, -28639, 7756, 0, 0, -28925, 8076, -2359, 0,
+-29233, 8421, -3096, 0, -29608, 8839, -3539, 0, -30015, 9294, -3686, 0, -30423, 9749, -3539, 0,
+-30797, 10168, -3096, 0, -31106, 10512, -2359, 0, -31315, 10746, -1327, 0, -31392, 10832, 0, 0,
+-29312, 7029, -1327, 0, -29231, 6965, 0, 0, -29535, 7203, -2359, 0, -29862, 7459, -3096, 0,
+-30260, 7769, -3539, 0, -30693, 8107, -3686, 0, -31126, 8446, -3539, 0, -31524, 8756, -3096, 0,
+-31852, 9012, -2359, 0, -32074, 9186, -1327, 0, -32156, 9250, 0, 0, -29675, 5985, -1327, 0,
+-29590, 5950, 0, 0, -29905, 6082, -2359, 0, -30243, 6224, -3096, 0, -30655, 6396, -3539, 0,
+-31102, 6584, -3686, 0, -31550, 6772, -3539, 0, -31961, 6944, -3096, 0, -32300, 7086, -2359, 0,
+-32530, 7183, -1327, 0, -32614, 7218, 0, 0, -29797, 4681, -1327, 0, -29711, 4681, 0, 0,
+-30029, 4681, -2359, 0, -30371, 4681, -3096, 0, -30787, 4681, -3539, 0, -31239, 4681, -3686, 0,
+-31691, 4681, -3539, 0, -32107, 4681, -3096, 0, -32449, 4681, -2359, 0, -32681, 4681, -1327, 0,
+-32767, 4681, 0, 0, -20396, 13903, 1327, 0, -17517, 13912, 1327, 0, -20408, 13547, 2359, 0,
+-17595, 13556, 2359, 0, -20426, 13024, 3096, 0, -17709, 13032, 3096, 0, -20449, 12388, 3539, 0,
+-17847, 12395, 3539, 0, -20472, 11695, 3686, 0, -17998, 11703, 3686, 0, -20496, 11003, 3539, 0,
+-18149, 11010, 3539, 0, -20519, 10367, 3096, 0, -18287, 10373, 3096, 0, -20537, 9844, 2359, 0,
+-18401, 9849, 2359, 0, -20549, 9488, 1327, 0, -18479, 9493, 1327, 0, -22973, 13838, 1327, 0,
+-22929, 13485, 2359, 0, -22864, 12965, 3096, 0, -22785, 12333, 3539, 0, -22700, 11646, 3686, 0,
+-22614, 10959, 3539, 0, -22535, 10328, 3096, 0, -22471, 9807, 2359, 0, -22427, 9455, 1327, 0,
+-25247, 13663, 1327, 0, -25155, 13317, 2359, 0, -25019, 12806, 3096, 0, -24855, 12187, 3539, 0,
+-24676, 11513, 3686, 0, -24497, 10839, 3539, 0, -24333, 10219, 3096, 0, -24197, 9709, 2359, 0,
+-24105, 9363, 1327, 0, -27218, 13321, 1327, 0, -27086, 12988, 2359, 0, -26892, 12497, 3096, 0,
+-26656, 11902, 3539, 0, -26399, 11253, 3686, 0, -26142, 10605, 3539, 0, -25906, 10009, 3096, 0,
+-25712, 9518, 2359, 0, -25580, 9185, 1327, 0, -28887, 12758, 1327, 0, -28722, 12447, 2359, 0,
+-28480, 11988, 3096, 0, -28186, 11431, 3539, 0, -27865, 10825, 3686, 0, -27545, 10219, 3539, 0,
+-27250, 9662, 3096, 0, -27008, 9203, 2359, 0, -26844, 8892, 1327, 0, -30252, 11918, 1327, 0,
+-30062, 11639, 2359, 0, -29782, 11228, 3096, 0, -29442, 10729, 3539, 0, -29072, 10186, 3686, 0,
+-28701, 9643, 3539, 0, -28361, 9144, 3096, 0, -28081, 8733, 2359, 0, -27891, 8454, 1327, 0,
+-31315, 10746, 1327, 0, -31106, 10512, 2359, 0, -30797, 10168, 3096, 0, -30423, 9749, 3539, 0,
+-30015, 9294, 3686, 0, -29608, 8839, 3539, 0, -29233, 8421, 3096, 0, -28925, 8076, 2359, 0,
+-28716, 7842, 1327, 0, -32074, 9186, 1327, 0, -31852, 9012, 2359, 0, -31524, 8756, 3096, 0,
+-31126, 8446, 3539, 0, -30693, 8107, 3686, 0, -30260, 7769, 3539, 0, -29862, 7459, 3096, 0,
+-29535, 7203, 2359, 0, -29312, 7029, 1327, 0, -32530, 7183, 1327, 0, -32300, 7086, 2359, 0,
+-31961, 6944, 3096, 0, -31550, 6772, 3539, 0, -31102, 6584, 3686, 0, -30655, 6396, 3539, 0,
+-30243, 6224, 3096, 0, -29905, 6082, 2359, 0, -29675, 5985, 1327, 0, -32681, 4681, 1327, 0,
+-32449, 4681, 2359, 0, -32107, 4681, 3096, 0, -31691, 4681, 3539, 0, -31239, 4681, 3686, 0,
+-30787, 4681, 3539, 0, -30371, 4681, 3096, 0, -30029, 4681, 2359, 0, -29797, 4681, 1327, 0,
+-29733, 3111, -1327, 0, -29649, 3146, 0, 0, -29962, 3016, -2359, 0, -30299, 2876, -3096, 0,
+-30709, 2706, -3539, 0, -31154, 2521, -3686, 0, -31600, 2336, -3539, 0, -32009, 2166, -3096, 0,
+-32346, 2027, -2359, 0, -32575, 1931, -1327, 0, -32660, 1897, 0, 0, -29539, 1323, -1327, 0,
+-29459, 1386, 0, 0, -29758, 1154, -2359, 0, -30080, 906, -3096, 0, -30471, 604, -3539, 0,
+-30897, 275, -3686, 0, -31323, -54, -3539, 0, -31714, -356, -3096, 0, -32036, -605, -2359, 0,
+-32255, -774, -1327, 0, -32335, -836, 0, 0, -29208, -626, -1327, 0, -29134, -543, 0, 0,
+-29410, -852, -2359, 0, -29708, -1185, -3096, 0, -30069, -1588, -3539, 0, -30462, -2028, -3686, 0,
+-30855, -2468, -3539, 0, -31217, -2872, -3096, 0, -31514, -3204, -2359, 0, -31716, -3430, -1327, 0,
+-31791, -3513, 0, 0, -28734, -2683, -1327, 0, -28668, -2584, 0, 0, -28913, -2953, -2359, 0,
+-29177, -3350, -3096, 0, -29497, -3832, -3539, 0, -29846, -4356, -3686, 0, -30194, -4881, -3539, 0,
+-30515, -5363, -3096, 0, -30778, -5760, -2359, 0, -30957, -6030, -1327, 0, -31023, -6129, 0, 0,
+-28111, -4793, -1327, 0, -28056, -4681, 0, 0, -28261, -5097, -2359, 0, -28482, -5545, -3096, 0,
+-28751, -6088, -3539, 0, -29043, -6680, -3686, 0, -29335, -7272, -3539, 0, -29603, -7816, -3096, 0,
+-29824, -8264, -2359, 0, -29974, -8567, -1327, 0, -30030, -8679, 0, 0, -27334, -6901, -1327, 0,
+-27291, -6778, 0, 0, -27449, -7234, -2359, 0, -27619, -7724, -3096, 0, -27825, -8320, -3539, 0,
+-28049, -8969, -3686, 0, -28273, -9617, -3539, 0, -28479, -10213, -3096, 0, -28649, -10704, -2359, 0,
+-28764, -11037, -1327, 0, -28807, -11160, 0, 0, -26395, -8952, -1327, 0, -26367, -8819, 0, 0,
+-26470, -9312, -2359, 0, -26580, -9844, -3096, 0, -26714, -10490, -3539, 0, -26860, -11192, -3686, 0,
+-27005, -11894, -3539, 0, -27139, -12540, -3096, 0, -27249, -13071, -2359, 0, -27324, -13432, -1327, 0,
+-27352, -13565, 0, 0, -25289, -10892, -1327, 0, -25279, -10748, 0, 0, -25318, -11282, -2359, 0,
+-25361, -11858, -3096, 0, -25413, -12558, -3539, 0, -25470, -13319, -3686, 0, -25527, -14080, -3539, 0,
+-25579, -14780, -3096, 0, -25622, -15356, -2359, 0, -25651, -15746, -1327, 0, -25662, -15890, 0, 0,
+-24011, -12665, -1327, 0, -24019, -12508, 0, 0, -23989, -13092, -2359, 0, -23957, -13722, -3096, 0,
+-23918, -14487, -3539, 0, -23876, -15320, -3686, 0, -23833, -16152, -3539, 0, -23795, -16917, -3096, 0,
+-23763, -17547, -2359, 0, -23741, -17974, -1327, 0, -23733, -18132, 0, 0, -22553, -14218, -1327, 0,
+-22475, -14692, -2359, 0, -22361, -15391, -3096, 0, -22223, -16240, -3539, 0, -22072, -17164, -3686, 0,
+-21921, -18087, -3539, 0, -21783, -18936, -3096, 0, -21669, -19635, -2359, 0, -21591, -20110, -1327, 0,
+-21563, -20284, 0, 0, -32575, 1931, 1327, 0, -32346, 2027, 2359, 0, -32009, 2166, 3096, 0,
+-31600, 2336, 3539, 0, -31154, 2521, 3686, 0, -30709, 2706, 3539, 0, -30299, 2876, 3096, 0,
+-29962, 3016, 2359, 0, -29733, 3111, 1327, 0, -32255, -774, 1327, 0, -32036, -605, 2359, 0,
+-31714, -356, 3096, 0, -31323, -54, 3539, 0, -30897, 275, 3686, 0, -30471, 604, 3539, 0,
+-30080, 906, 3096, 0, -29758, 1154, 2359, 0, -29539, 1323, 1327, 0, -31716, -3430, 1327, 0,
+-31514, -3204, 2359, 0, -31217, -2872, 3096, 0, -30855, -2468, 3539, 0, -30462, -2028, 3686, 0,
+-30069, -1588, 3539, 0, -29708, -1185, 3096, 0, -29410, -852, 2359, 0, -29208, -626, 1327, 0,
+-30957, -6030, 1327, 0, -30778, -5760, 2359, 0, -30515, -5363, 3096, 0, -30194, -4881, 3539, 0,
+-29846, -4356, 3686, 0, -29497, -3832, 3539, 0, -29177, -3350, 3096, 0, -28913, -2953, 2359, 0,
+-28734, -2683, 1327, 0, -29974, -8567, 1327, 0, -29824, -8264, 2359, 0, -29603, -7816, 3096, 0,
+-29335, -7272, 3539, 0, -29043, -6680, 3686, 0, -28751, -6088, 3539, 0, -28482, -5545, 3096, 0,
+-28261, -5097, 2359, 0, -28111, -4793, 1327, 0, -28764, -11037, 1327, 0, -28649, -10704, 2359, 0,
+-28479, -10213, 3096, 0, -28273, -9617, 3539, 0, -28049, -8969, 3686, 0, -27825, -8320, 3539, 0,
+-27619, -7724, 3096, 0, -27449, -7234, 2359, 0, -27334, -6901, 1327, 0, -27324, -13432, 1327, 0,
+-27249, -13071, 2359, 0, -27139, -12540, 3096, 0, -27005, -11894, 3539, 0, -26860, -11192, 3686, 0,
+-26714, -10490, 3539, 0, -26580, -9844, 3096, 0, -26470, -9312, 2359, 0, -26395, -8952, 1327, 0,
+-25651, -15746, 1327, 0, -25622, -15356, 2359, 0, -25579, -14780, 3096, 0, -25527, -14080, 3539, 0,
+-25470, -13319, 3686, 0, -25413, -12558, 3539, 0, -25361, -11858, 3096, 0, -25318, -11282, 2359, 0,
+-25289, -10892, 1327, 0, -23741, -17974, 1327, 0, -23763, -17547, 2359, 0, -23795, -16917, 3096, 0,
+-23833, -16152, 3539, 0, -23876, -15320, 3686, 0, -23918, -14487, 3539, 0, -23957, -13722, 3096, 0,
+-23989, -13092, 2359, 0, -24011, -12665, 1327, 0, -21591, -20110, 1327, 0, -21669, -19635, 2359, 0,
+-21783, -18936, 3096, 0, -21921, -18087, 3539, 0, -22072, -17164, 3686, 0, -22223, -16240, 3539, 0,
+-22361, -15391, 3096, 0, -22475, -14692, 2359, 0, -22553, -14218, 1327, 0, 17544, -3158, -2869, 0,
+15105, -3601, -2920, 0, 15105, -3121, 0, 0, 17508, -2721, 0, 0, 17640, -4342, -5100, 0,
+15105, -4906, -5190, 0, 17783, -6088, -6694, 0, 15105, -6828, -6812, 0, 17955, -8208, -7650, 0,
+15105, -9162, -7785, 0, 18144, -10515, -7969, 0, 15105, -11702, -8110, 0, 18332, -12822, -7650, 0,
+15105, -14243, -7785, 0, 18505, -14942, -6694, 0, 15105, -16577, -6812, 0, 18647, -16688, -5100, 0,
+15105, -18499, -5190, 0, 18744, -17872, -2869, 0, 15105, -19804, -2920, 0, 18779, -18309, 0, 0,
+15105, -20284, 0, 0, 19352, -1995, -2731, 0, 19294, -1610, 0, 0, 19512, -3038, -4855, 0,
+19748, -4576, -6372, 0, 20034, -6444, -7282, 0, 20345, -8476, -7586, 0, 20656, -10508, -7282, 0,
+20942, -12375, -6372, 0, 21177, -13913, -4855, 0, 21337, -14957, -2731, 0, 21396, -15341, 0, 0,
+20651, -246, -2528, 0, 20578, 81, 0, 0, 20849, -1134, -4494, 0, 21140, -2443, -5898, 0,
+21494, -4033, -6741, 0, 21880, -5762, -7022, 0, 22265, -7492, -6741, 0, 22619, -9081, -5898, 0,
+22911, -10390, -4494, 0, 23108, -11279, -2528, 0, 23181, -11606, 0, 0, 21558, 1955, -2281, 0,
+21477, 2222, 0, 0, 21777, 1229, -4055, 0, 22100, 159, -5323, 0, 22493, -1139, -6083, 0,
+22920, -2553, -6336, 0, 23346, -3966, -6083, 0, 23739, -5265, -5323, 0, 24062, -6334, -4055, 0,
+24281, -7060, -2281, 0, 24362, -7327, 0, 0, 22193, 4473, -2013, 0, 22108, 4681, 0, 0,
+22426, 3910, -3578, 0, 22768, 3080, -4696, 0, 23183, 2072, -5367, 0, 23636, 975, -5591, 0,
+24088, -122, -5367, 0, 24503, -1130, -4696, 0, 24846, -1960, -3578, 0, 25078, -2523, -2013, 0,
+25163, -2731, 0, 0, 22676, 7177, -1744, 0, 22585, 7327, 0, 0, 22921, 6769, -3101, 0,
+23282, 6168, -4070, 0, 23721, 5438, -4651, 0, 24199, 4644, -4845, 0, 24676, 3849, -4651, 0,
+25115, 3119, -4070, 0, 25477, 2518, -3101, 0, 25722, 2110, -1744, 0, 25812, 1960, 0, 0,
+23125, 9932, -1498, 0, 23027, 10030, 0, 0, 23391, 9665, -2662, 0, 23784, 9272, -3494, 0,
+24261, 8794, -3994, 0, 24780, 8275, -4160, 0, 25300, 7755, -3994, 0, 25777, 7277, -3494, 0,
+26170, 6884, -2662, 0, 26436, 6617, -1498, 0, 26534, 6519, 0, 0, 23659, 12603, -1294, 0,
+23547, 12657, 0, 0, 23964, 12456, -2301, 0, 24413, 12239, -3020, 0, 24958, 11976, -3452, 0,
+25552, 11690, -3596, 0, 26145, 11404, -3452, 0, 26690, 11141, -3020, 0, 27139, 10924, -2301, 0,
+27444, 10777, -1294, 0, 27556, 10723, 0, 0, 24399, 15058, -1157, 0, 24263, 15079, 0, 0,
+24766, 15003, -2056, 0, 25309, 14921, -2699, 0, 25967, 14821, -3085, 0, 26683, 14712, -3213, 0,
+27400, 14604, -3085, 0, 28058, 14504, -2699, 0, 28600, 14422, -2056, 0, 28968, 14366, -1157, 0,
+29103, 14346, 0, 0, 25462, 17164, -1106, 0, 25291, 17164, 0, 0, 25926, 17164, -1966, 0,
+26611, 17164, -2580, 0, 27442, 17164, -2949, 0, 28346, 17164, -3072, 0, 29251, 17164, -2949, 0,
+30082, 17164, -2580, 0, 30767, 17164, -1966, 0, 31231, 17164, -1106, 0, 31402, 17164, 0, 0,
+18744, -17872, 2869, 0, 15105, -19804, 2920, 0, 18647, -16688, 5100, 0, 15105, -18499, 5190, 0,
+18505, -14942, 6694, 0, 15105, -16577, 6812, 0, 18332, -12822, 7650, 0, 15105, -14243, 7785, 0,
+18144, -10515, 7969, 0, 15105, -11702, 8110, 0, 17955, -8208, 7650, 0, 15105, -9162, 7785, 0,
+17783, -6088, 6694, 0, 15105, -6828, 6812, 0, 17640, -4342, 5100, 0, 15105, -4906, 5190, 0,
+17544, -3158, 2869, 0, 15105, -3601, 2920, 0, 21337, -14957, 2731, 0, 21177, -13913, 4855, 0,
+20942, -12375, 6372, 0, 20656, -10508, 7282, 0, 20345, -8476, 7586, 0, 20034, -6444, 7282, 0,
+19748, -4576, 6372, 0, 19512, -3038, 4855, 0, 19352, -1995, 2731, 0, 23108, -11279, 2528, 0,
+22911, -10390, 4494, 0, 22619, -9081, 5898, 0, 22265, -7492, 6741, 0, 21880, -5762, 7022, 0,
+21494, -4033, 6741, 0, 21140, -2443, 5898, 0, 20849, -1134, 4494, 0, 20651, -246, 2528, 0,
+24281, -7060, 2281, 0, 24062, -6334, 4055, 0, 23739, -5265, 5323, 0, 23346, -3966, 6083, 0,
+22920, -2553, 6336, 0, 22493, -1139, 6083, 0, 22100, 159, 5323, 0, 21777, 1229, 4055, 0,
+21558, 1955, 2281, 0, 25078, -2523, 2013, 0, 24846, -1960, 3578, 0, 24503, -1130, 4696, 0,
+24088, -122, 5367, 0, 23636, 975, 5591, 0, 23183, 2072, 5367, 0, 22768, 3080, 4696, 0,
+22426, 3910, 3578, 0, 22193, 4473, 2013, 0, 25722, 2110, 1744, 0, 25477, 2518, 3101, 0,
+25115, 3119, 4070, 0, 24676, 3849, 4651, 0, 24199, 4644, 4845, 0, 23721, 5438, 4651, 0,
+23282, 6168, 4070, 0, 22921, 6769, 3101, 0, 22676, 7177, 1744, 0, 26436, 6617, 1498, 0,
+26170, 6884, 2662, 0, 25777, 7277, 3494, 0, 25300, 7755, 3994, 0, 24780, 8275, 4160, 0,
+24261, 8794, 3994, 0, 23784, 9272, 3494, 0, 23391, 9665, 2662, 0, 23125, 9932, 1498, 0,
+27444, 10777, 1294, 0, 27139, 10924, 2301, 0, 26690, 11141, 3020, 0, 26145, 11404, 3452, 0,
+25552, 11690, 3596, 0, 24958, 11976, 3452, 0, 24413, 12239, 3020, 0, 23964, 12456, 2301, 0,
+23659, 12603, 1294, 0, 28968, 14366, 1157, 0, 28600, 14422, 2056, 0, 28058, 14504, 2699, 0,
+27400, 14604, 3085, 0, 26683, 14712, 3213, 0, 25967, 14821, 3085, 0, 25309, 14921, 2699, 0,
+24766, 15003, 2056, 0, 24399, 15058, 1157, 0, 31231, 17164, 1106, 0, 30767, 17164, 1966, 0,
+30082, 17164, 2580, 0, 29251, 17164, 2949, 0, 28346, 17164, 3072, 0, 27442, 17164, 2949, 0,
+26611, 17164, 2580, 0, 25926, 17164, 1966, 0, 25462, 17164, 1106, 0, 25774, 17588, -1093, 0,
+25594, 17585, 0, 0, 26260, 17597, -1944, 0, 26978, 17610, -2552, 0, 27849, 17626, -2916, 0,
+28797, 17643, -3038, 0, 29745, 17660, -2916, 0, 30616, 17676, -2552, 0, 31333, 17689, -1944, 0,
+31820, 17698, -1093, 0, 31999, 17701, 0, 0, 26069, 17919, -1060, 0, 25886, 17913, 0, 0,
+26565, 17936, -1884, 0, 27297, 17961, -2473, 0, 28186, 17992, -2826, 0, 29153, 18025, -2944, 0,
+30120, 18058, -2826, 0, 31009, 18089, -2473, 0, 31741, 18114, -1884, 0, 32238, 18131, -1060, 0,
+32421, 18137, 0, 0, 26335, 18156, -1010, 0, 26152, 18147, 0, 0, 26831, 18180, -1796, 0,
+27561, 18216, -2357, 0, 28448, 18259, -2694, 0, 29413, 18306, -2806, 0, 30378, 18354, -2694, 0,
+31265, 18397, -2357, 0, 31996, 18433, -1796, 0, 32491, 18457, -1010, 0, 32674, 18466, 0, 0,
+26561, 18298, -950, 0, 26383, 18287, 0, 0, 27047, 18328, -1689, 0, 27762, 18372, -2217, 0,
+28630, 18425, -2534, 0, 29575, 18484, -2639, 0, 30520, 18542, -2534, 0, 31388, 18595, -2217, 0,
+32103, 18639, -1689, 0, 32588, 18669, -950, 0, 32767, 18680, 0, 0, 26736, 18346, -885, 0,
+26564, 18334, 0, 0, 27203, 18379, -1573, 0, 27891, 18429, -2064, 0, 28726, 18488, -2359, 0,
+29636, 18553, -2458, 0, 30545, 18618, -2359, 0, 31380, 18678, -2064, 0, 32068, 18727, -1573, 0,
+32535, 18760, -885, 0, 32707, 18773, 0, 0, 26847, 18300, -819, 0, 26684, 18287, 0, 0,
+27289, 18334, -1456, 0, 27941, 18384, -1912, 0, 28732, 18445, -2185, 0, 29593, 18512, -2276, 0,
+30454, 18578, -2185, 0, 31245, 18639, -1912, 0, 31897, 18690, -1456, 0, 32339, 18724, -819, 0,
+32502, 18736, 0, 0, 26883, 18158, -759, 0, 26731, 18147, 0, 0, 27296, 18190, -1350, 0,
+27904, 18237, -1771, 0, 28642, 18294, -2024, 0, 29445, 18356, -2109, 0, 30249, 18417, -2024, 0,
+30987, 18474, -1771, 0, 31595, 18521, -1350, 0, 32008, 18553, -759, 0, 32160, 18564, 0, 0,
+26832, 17922, -710, 0, 26692, 17913, 0, 0, 27212, 17948, -1261, 0, 27771, 17985, -1656, 0,
+28451, 18031, -1892, 0, 29190, 18081, -1971, 0, 29929, 18131, -1892, 0, 30608, 18177, -1656, 0,
+31168, 18215, -1261, 0, 31547, 18240, -710, 0, 31687, 18250, 0, 0, 26683, 17591, -676, 0,
+26556, 17585, 0, 0, 27028, 17606, -1202, 0, 27536, 17628, -1577, 0, 28153, 17655, -1803, 0,
+28824, 17685, -1878, 0, 29496, 17715, -1803, 0, 30113, 17742, -1577, 0, 30621, 17764, -1202, 0,
+30966, 17779, -676, 0, 31093, 17785, 0, 0, 26423, 17164, -664, 0, 26309, 17164, 0, 0,
+26733, 17164, -1180, 0, 27189, 17164, -1548, 0, 27743, 17164, -1769, 0, 28346, 17164, -1843, 0,
+28949, 17164, -1769, 0, 29504, 17164, -1548, 0, 29960, 17164, -1180, 0, 30269, 17164, -664, 0,
+30384, 17164, 0, 0, 31820, 17698, 1093, 0, 31333, 17689, 1944, 0, 30616, 17676, 2552, 0,
+29745, 17660, 2916, 0, 28797, 17643, 3038, 0, 27849, 17626, 2916, 0, 26978, 17610, 2552, 0,
+26260, 17597, 1944, 0, 25774, 17588, 1093, 0, 32238, 18131, 1060, 0, 31741, 18114, 1884, 0,
+31009, 18089, 2473, 0, 30120, 18058, 2826, 0, 29153, 18025, 2944, 0, 28186, 17992, 2826, 0,
+27297, 17961, 2473, 0, 26565, 17936, 1884, 0, 26069, 17919, 1060, 0, 32491, 18457, 1010, 0,
+31996, 18433, 1796, 0, 31265, 18397, 2357, 0, 30378, 18354, 2694, 0, 29413, 18306, 2806, 0,
+28448, 18259, 2694, 0, 27561, 18216, 2357, 0, 26831, 18180, 1796, 0, 26335, 18156, 1010, 0,
+32588, 18669, 950, 0, 32103, 18639, 1689, 0, 31388, 18595, 2217, 0, 30520, 18542, 2534, 0,
+29575, 18484, 2639, 0, 28630, 18425, 2534, 0, 27762, 18372, 2217, 0, 27047, 18328, 1689, 0,
+26561, 18298, 950, 0, 32535, 18760, 885, 0, 32068, 18727, 1573, 0, 31380, 18678, 2064, 0,
+30545, 18618, 2359, 0, 29636, 18553, 2458, 0, 28726, 18488, 2359, 0, 27891, 18429, 2064, 0,
+27203, 18379, 1573, 0, 26736, 18346, 885, 0, 32339, 18724, 819, 0, 31897, 18690, 1456, 0,
+31245, 18639, 1912, 0, 30454, 18578, 2185, 0, 29593, 18512, 2276, 0, 28732, 18445, 2185, 0,
+27941, 18384, 1912, 0, 27289, 18334, 1456, 0, 26847, 18300, 819, 0, 32008, 18553, 759, 0,
+31595, 18521, 1350, 0, 30987, 18474, 1771, 0, 30249, 18417, 2024, 0, 29445, 18356, 2109, 0,
+28642, 18294, 2024, 0, 27904, 18237, 1771, 0, 27296, 18190, 1350, 0, 26883, 18158, 759, 0,
+31547, 18240, 710, 0, 31168, 18215, 1261, 0, 30608, 18177, 1656, 0, 29929, 18131, 1892, 0,
+29190, 18081, 1971, 0, 28451, 18031, 1892, 0, 27771, 17985, 1656, 0, 27212, 17948, 1261, 0,
+26832, 17922, 710, 0, 30966, 17779, 676, 0, 30621, 17764, 1202, 0, 30113, 17742, 1577, 0,
+29496, 17715, 1803, 0, 28824, 17685, 1878, 0, 28153, 17655, 1803, 0, 27536, 17628, 1577, 0,
+27028, 17606, 1202, 0, 26683, 17591, 676, 0, 30269, 17164, 664, 0, 29960, 17164, 1180, 0,
+29504, 17164, 1548, 0, 28949, 17164, 1769, 0, 28346, 17164, 1843, 0, 27743, 17164, 1769, 0,
+27189, 17164, 1548, 0, 26733, 17164, 1180, 0, 26423, 17164, 664, 0, -2210, 32767, 0, 0,
+-228, 32589, 0, 0, -254, 32589, -525, 0, -327, 32589, -1020, 0, -446, 32589, -1480, 0,
+-605, 32589, -1897, 0, -801, 32589, -2267, 0, -1031, 32589, -2583, 0, -1290, 32589, -2838, 0,
+-1576, 32589, -3029, 0, -1884, 32589, -3147, 0, -2210, 32589, -3188, 0, 895, 32093, -833, 0,
+935, 32093, 0, 0, 778, 32093, -1619, 0, 590, 32093, -2348, 0, 337, 32093, -3010, 0,
+26, 32093, -3597, 0, -339, 32093, -4098, 0, -751, 32093, -4504, 0, -1204, 32093, -4806, 0,
+-1692, 32093, -4994, 0, -2210, 32093, -5059, 0, 1391, 31335, -966, 0, 1438, 31335, 0, 0,
+1256, 31335, -1878, 0, 1038, 31335, -2723, 0, 745, 31335, -3492, 0, 383, 31335, -4172, 0,
+-40, 31335, -4754, 0, -517, 31335, -5225, 0, -1043, 31335, -5575, 0, -1609, 31335, -5793, 0,
+-2210, 31335, -5869, 0, 1393, 30370, -967, 0, 1440, 30370, 0, 0, 1258, 30370, -1879, 0,
+1040, 30370, -2725, 0, 747, 30370, -3493, 0, 385, 30370, -4174, 0, -38, 30370, -4756, 0,
+-516, 30370, -5228, 0, -1042, 30370, -5578, 0, -1609, 30370, -5797, 0, -2210, 30370, -5872, 0,
+1058, 29256, -877, 0, 1100, 29256, 0, 0, 934, 29256, -1704, 0, 737, 29256, -2470, 0,
+471, 29256, -3168, 0, 143, 29256, -3785, 0, -241, 29256, -4313, 0, -674, 29256, -4740, 0,
+-1151, 29256, -5058, 0, -1665, 29256, -5256, 0, -2210, 29256, -5325, 0, 541, 28049, -738, 0,
+577, 28049, 0, 0, 437, 28049, -1434, 0, 271, 28049, -2079, 0, 47, 28049, -2666, 0,
+-229, 28049, -3186, 0, -553, 28049, -3630, 0, -918, 28049, -3991, 0, -1319, 28049, -4258, 0,
+-1752, 28049, -4425, 0, -2210, 28049, -4483, 0, 0, 26803, -592, 0, 29, 26803, 0, 0,
+-84, 26803, -1151, 0, -217, 26803, -1670, 0, -397, 26803, -2141, 0, -619, 26803, -2559, 0,
+-879, 26803, -2916, 0, -1172, 26803, -3206, 0, -1495, 26803, -3421, 0, -1842, 26803, -3555, 0,
+-2210, 26803, -3601, 0, -408, 25577, -482, 0, -385, 25577, 0, 0, -477, 25577, -938, 0,
+-586, 25577, -1361, 0, -733, 25577, -1745, 0, -914, 25577, -2086, 0, -1125, 25577, -2377, 0,
+-1364, 25577, -2613, 0, -1627, 25577, -2789, 0, -1910, 25577, -2898, 0, -2210, 25577, -2936, 0,
+-527, 24425, -450, 0, -505, 24425, 0, 0, -591, 24425, -875, 0, -693, 24425, -1270, 0,
+-830, 24425, -1629, 0, -1000, 24425, -1948, 0, -1197, 24425, -2220, 0, -1421, 24425, -2441, 0,
+-1666, 24425, -2605, 0, -1930, 24425, -2707, 0, -2210, 24425, -2743, 0, -199, 23405, -538, 0,
+-173, 23405, 0, 0, -276, 23405, -1045, 0, -398, 23405, -1517, 0, -562, 23405, -1946, 0,
+-764, 23405, -2326, 0, -1000, 23405, -2652, 0, -1267, 23405, -2916, 0, -1560, 23405, -3112, 0,
+-1876, 23405, -3234, 0, -2210, 23405, -3277, 0, -2537, 32589, -3147, 0, -2845, 32589, -3029, 0,
+-3130, 32589, -2838, 0, -3390, 32589, -2583, 0, -3619, 32589, -2267, 0, -3816, 32589, -1897, 0,
+-3975, 32589, -1480, 0, -4093, 32589, -1020, 0, -4167, 32589, -525, 0, -4192, 32589, 0, 0,
+-2728, 32093, -4994, 0, -3217, 32093, -4806, 0, -3670, 32093, -4504, 0, -4082, 32093, -4098, 0,
+-4446, 32093, -3597, 0, -4758, 32093, -3010, 0, -5011, 32093, -2348, 0, -5198, 32093, -1619, 0,
+-5315, 32093, -833, 0, -5356, 32093, 0, 0, -2811, 31335, -5793, 0, -3378, 31335, -5575, 0,
+-3903, 31335, -5225, 0, -4381, 31335, -4754, 0, -4804, 31335, -4172, 0, -5166, 31335, -3492, 0,
+-5459, 31335, -2723, 0, -5676, 31335, -1878, 0, -5812, 31335, -966, 0, -5859, 31335, 0, 0,
+-2811, 30370, -5797, 0, -3378, 30370, -5578, 0, -3904, 30370, -5228, 0, -4382, 30370, -4756, 0,
+-4805, 30370, -4174, 0, -5167, 30370, -3493, 0, -5460, 30370, -2725, 0, -5678, 30370, -1879, 0,
+-5814, 30370, -967, 0, -5861, 30370, 0, 0, -2755, 29256, -5256, 0, -3269, 29256, -5058, 0,
+-3746, 29256, -4740, 0, -4180, 29256, -4313, 0, -4563, 29256, -3785, 0, -4891, 29256, -3168, 0,
+-5157, 29256, -2470, 0, -5355, 29256, -1704, 0, -5478, 29256, -877, 0, -5521, 29256, 0, 0,
+-2669, 28049, -4425, 0, -3102, 28049, -4258, 0, -3503, 28049, -3991, 0, -3868, 28049, -3630, 0,
+-4191, 28049, -3186, 0, -4467, 28049, -2666, 0, -4691, 28049, -2079, 0, -4858, 28049, -1434, 0,
+-4961, 28049, -738, 0, -4997, 28049, 0, 0, -2579, 26803, -3555, 0, -2926, 26803, -3421, 0,
+-3248, 26803, -3206, 0, -3542, 26803, -2916, 0, -3801, 26803, -2559, 0, -4023, 26803, -2141, 0,
+-4203, 26803, -1670, 0, -4337, 26803, -1151, 0, -4420, 26803, -592, 0, -4449, 26803, 0, 0,
+-2510, 25577, -2898, 0, -2793, 25577, -2789, 0, -3056, 25577, -2613, 0, -3295, 25577, -2377, 0,
+-3507, 25577, -2086, 0, -3688, 25577, -1745, 0, -3835, 25577, -1361, 0, -3944, 25577, -938, 0,
+-4012, 25577, -482, 0, -4036, 25577, 0, 0, -2490, 24425, -2707, 0, -2754, 24425, -2605, 0,
+-3000, 24425, -2441, 0, -3223, 24425, -2220, 0, -3421, 24425, -1948, 0, -3590, 24425, -1629, 0,
+-3728, 24425, -1270, 0, -3830, 24425, -875, 0, -3893, 24425, -450, 0, -3915, 24425, 0, 0,
+-2545, 23405, -3234, 0, -2860, 23405, -3112, 0, -3153, 23405, -2916, 0, -3420, 23405, -2652, 0,
+-3657, 23405, -2326, 0, -3859, 23405, -1946, 0, -4023, 23405, -1517, 0, -4145, 23405, -1045, 0,
+-4221, 23405, -538, 0, -4247, 23405, 0, 0, -4167, 32589, 525, 0, -4093, 32589, 1020, 0,
+-3975, 32589, 1480, 0, -3816, 32589, 1897, 0, -3619, 32589, 2267, 0, -3390, 32589, 2583, 0,
+-3130, 32589, 2838, 0, -2845, 32589, 3029, 0, -2537, 32589, 3147, 0, -2210, 32589, 3188, 0,
+-5315, 32093, 833, 0, -5198, 32093, 1619, 0, -5011, 32093, 2348, 0, -4758, 32093, 3010, 0,
+-4446, 32093, 3597, 0, -4082, 32093, 4098, 0, -3670, 32093, 4504, 0, -3217, 32093, 4806, 0,
+-2728, 32093, 4994, 0, -2210, 32093, 5059, 0, -5812, 31335, 966, 0, -5676, 31335, 1878, 0,
+-5459, 31335, 2723, 0, -5166, 31335, 3492, 0, -4804, 31335, 4172, 0, -4381, 31335, 4754, 0,
+-3903, 31335, 5225, 0, -3378, 31335, 5575, 0, -2811, 31335, 5793, 0, -2210, 31335, 5869, 0,
+-5814, 30370, 967, 0, -5678, 30370, 1879, 0, -5460, 30370, 2725, 0, -5167, 30370, 3493, 0,
+-4805, 30370, 4174, 0, -4382, 30370, 4756, 0, -3904, 30370, 5228, 0, -3378, 30370, 5578, 0,
+-2811, 30370, 5797, 0, -2210, 30370, 5872, 0, -5478, 29256, 877, 0, -5355, 29256, 1704, 0,
+-5157, 29256, 2470, 0, -4891, 29256, 3168, 0, -4563, 29256, 3785, 0, -4180, 29256, 4313, 0,
+-3746, 29256, 4740, 0, -3269, 29256, 5058, 0, -2755, 29256, 5256, 0, -2210, 29256, 5325, 0,
+-4961, 28049, 738, 0, -4858, 28049, 1434, 0, -4691, 28049, 2079, 0, -4467, 28049, 2666, 0,
+-4191, 28049, 3186, 0, -3868, 28049, 3630, 0, -3503, 28049, 3991, 0, -3102, 28049, 4258, 0,
+-2669, 28049, 4425, 0, -2210, 28049, 4483, 0, -4420, 26803, 592, 0, -4337, 26803, 1151, 0,
+-4203, 26803, 1670, 0, -4023, 26803, 2141, 0, -3801, 26803, 2559, 0, -3542, 26803, 2916, 0,
+-3248, 26803, 3206, 0, -2926, 26803, 3421, 0, -2579, 26803, 3555, 0, -2210, 26803, 3601, 0,
+-4012, 25577, 482, 0, -3944, 25577, 938, 0, -3835, 25577, 1361, 0, -3688, 25577, 1745, 0,
+-3507, 25577, 2086, 0, -3295, 25577, 2377, 0, -3056, 25577, 2613, 0, -2793, 25577, 2789, 0,
+-2510, 25577, 2898, 0, -2210, 25577, 2936, 0, -3893, 24425, 450, 0, -3830, 24425, 875, 0,
+-3728, 24425, 1270, 0, -3590, 24425, 1629, 0, -3421, 24425, 1948, 0, -3223, 24425, 2220, 0,
+-3000, 24425, 2441, 0, -2754, 24425, 2605, 0, -2490, 24425, 2707, 0, -2210, 24425, 2743, 0,
+-4221, 23405, 538, 0, -4145, 23405, 1045, 0, -4023, 23405, 1517, 0, -3859, 23405, 1946, 0,
+-3657, 23405, 2326, 0, -3420, 23405, 2652, 0, -3153, 23405, 2916, 0, -2860, 23405, 3112, 0,
+-2545, 23405, 3234, 0, -2210, 23405, 3277, 0, -1884, 32589, 3147, 0, -1576, 32589, 3029, 0,
+-1290, 32589, 2838, 0, -1031, 32589, 2583, 0, -801, 32589, 2267, 0, -605, 32589, 1897, 0,
+-446, 32589, 1480, 0, -327, 32589, 1020, 0, -254, 32589, 525, 0, -1692, 32093, 4994, 0,
+-1204, 32093, 4806, 0, -751, 32093, 4504, 0, -339, 32093, 4098, 0, 26, 32093, 3597, 0,
+337, 32093, 3010, 0, 590, 32093, 2348, 0, 778, 32093, 1619, 0, 895, 32093, 833, 0,
+-1609, 31335, 5793, 0, -1043, 31335, 5575, 0, -517, 31335, 5225, 0, -40, 31335, 4754, 0,
+383, 31335, 4172, 0, 745, 31335, 3492, 0, 1038, 31335, 2723, 0, 1256, 31335, 1878, 0,
+1391, 31335, 966, 0, -1609, 30370, 5797, 0, -1042, 30370, 5578, 0, -516, 30370, 5228, 0,
+-38, 30370, 4756, 0, 385, 30370, 4174, 0, 747, 30370, 3493, 0, 1040, 30370, 2725, 0,
+1258, 30370, 1879, 0, 1393, 30370, 967, 0, -1665, 29256, 5256, 0, -1151, 29256, 5058, 0,
+-674, 29256, 4740, 0, -241, 29256, 4313, 0, 143, 29256, 3785, 0, 471, 29256, 3168, 0,
+737, 29256, 2470, 0, 934, 29256, 1704, 0, 1058, 29256, 877, 0, -1752, 28049, 4425, 0,
+-1319, 28049, 4258, 0, -918, 28049, 3991, 0, -553, 28049, 3630, 0, -229, 28049, 3186, 0,
+47, 28049, 2666, 0, 271, 28049, 2079, 0, 437, 28049, 1434, 0, 541, 28049, 738, 0,
+-1842, 26803, 3555, 0, -1495, 26803, 3421, 0, -1172, 26803, 3206, 0, -879, 26803, 2916, 0,
+-619, 26803, 2559, 0, -397, 26803, 2141, 0, -217, 26803, 1670, 0, -84, 26803, 1151, 0,
+0, 26803, 592, 0, -1910, 25577, 2898, 0, -1627, 25577, 2789, 0, -1364, 25577, 2613, 0,
+-1125, 25577, 2377, 0, -914, 25577, 2086, 0, -733, 25577, 1745, 0, -586, 25577, 1361, 0,
+-477, 25577, 938, 0, -408, 25577, 482, 0, -1930, 24425, 2707, 0, -1666, 24425, 2605, 0,
+-1421, 24425, 2441, 0, -1197, 24425, 2220, 0, -1000, 24425, 1948, 0, -830, 24425, 1629, 0,
+-693, 24425, 1270, 0, -591, 24425, 875, 0, -527, 24425, 450, 0, -1876, 23405, 3234, 0,
+-1560, 23405, 3112, 0, -1267, 23405, 2916, 0, -1000, 23405, 2652, 0, -764, 23405, 2326, 0,
+-562, 23405, 1946, 0, -398, 23405, 1517, 0, -276, 23405, 1045, 0, -199, 23405, 538, 0,
+599, 22556, -751, 0, 636, 22556, 0, 0, 493, 22556, -1460, 0, 322, 22556, -2119, 0,
+93, 22556, -2719, 0, -190, 22556, -3250, 0, -520, 22556, -3704, 0, -893, 22556, -4073, 0,
+-1302, 22556, -4348, 0, -1743, 22556, -4519, 0, -2210, 22556, -4578, 0, 1723, 21857, -1052, 0,
+1774, 21857, 0, 0, 1574, 21857, -2045, 0, 1335, 21857, -2967, 0, 1014, 21857, -3807, 0,
+619, 21857, -4551, 0, 156, 21857, -5187, 0, -366, 21857, -5703, 0, -939, 21857, -6087, 0,
+-1556, 21857, -6327, 0, -2210, 21857, -6409, 0, 3076, 21270, -1413, 0, 3145, 21270, 0, 0,
+2876, 21270, -2748, 0, 2555, 21270, -3988, 0, 2124, 21270, -5116, 0, 1592, 21270, -6116, 0,
+970, 21270, -6972, 0, 269, 21270, -7666, 0, -502, 21270, -8182, 0, -1332, 21270, -8504, 0,
+-2210, 21270, -8614, 0, 4562, 20759, -1811, 0, 4651, 20759, 0, 0, 4306, 20759, -3521, 0,
+3895, 20759, -5109, 0, 3342, 20759, -6555, 0, 2661, 20759, -7836, 0, 1865, 20759, -8931, 0,
+966, 20759, -9820, 0, -21, 20759, -10482, 0, -1085, 20759, -10894, 0, -2210, 20759, -11036, 0,
+6085, 20284, -2218, 0, 6193, 20284, 0, 0, 5771, 20284, -4312, 0, 5267, 20284, -6258, 0,
+4590, 20284, -8028, 0, 3756, 20284, -9597, 0, 2780, 20284, -10939, 0, 1680, 20284, -12027, 0,
+471, 20284, -12837, 0, -831, 20284, -13342, 0, -2210, 20284, -13516, 0, 7546, 19810, -2609, 0,
+7674, 19810, 0, 0, 7177, 19810, -5072, 0, 6585, 19810, -7360, 0, 5789, 19810, -9442, 0,
+4807, 19810, -11288, 0, 3660, 19810, -12866, 0, 2366, 19810, -14147, 0, 943, 19810, -15100, 0,
+-589, 19810, -15694, 0, -2210, 19810, -15899, 0, 8852, 19298, -2958, 0, 8996, 19298, 0, 0,
+8433, 19298, -5751, 0, 7761, 19298, -8345, 0, 6859, 19298, -10705, 0, 5746, 19298, -12798, 0,
+4445, 19298, -14587, 0, 2978, 19298, -16039, 0, 1365, 19298, -17120, 0, -372, 19298, -17793, 0,
+-2210, 19298, -18025, 0, 9903, 18712, -3239, 0, 10061, 18712, 0, 0, 9445, 18712, -6297, 0,
+8709, 18712, -9138, 0, 7721, 18712, -11723, 0, 6503, 18712, -14015, 0, 5078, 18712, -15974, 0,
+3471, 18712, -17564, 0, 1705, 18712, -18747, 0, -197, 18712, -19485, 0, -2210, 18712, -19739, 0,
+10605, 18012, -3426, 0, 10772, 18012, 0, 0, 10120, 18012, -6662, 0, 9342, 18012, -9668, 0,
+8296, 18012, -12402, 0, 7007, 18012, -14827, 0, 5500, 18012, -16900, 0, 3800, 18012, -18582, 0,
+1932, 18012, -19833, 0, -80, 18012, -20613, 0, -2210, 18012, -20882, 0, 10860, 17164, -3495, 0,
+11031, 17164, 0, 0, 10366, 17164, -6795, 0, 9572, 17164, -9860, 0, 8506, 17164, -12650, 0,
+7191, 17164, -15122, 0, 5654, 17164, -17236, 0, 3920, 17164, -18952, 0, 2014, 17164, -20229, 0,
+-38, 17164, -21024, 0, -2210, 17164, -21299, 0, -2677, 22556, -4519, 0, -3118, 22556, -4348, 0,
+-3528, 22556, -4073, 0, -3900, 22556, -3704, 0, -4231, 22556, -3250, 0, -4513, 22556, -2719, 0,
+-4743, 22556, -2119, 0, -4913, 22556, -1460, 0, -5019, 22556, -751, 0, -5056, 22556, 0, 0,
+-2864, 21857, -6327, 0, -3482, 21857, -6087, 0, -4055, 21857, -5703, 0, -4577, 21857, -5187, 0,
+-5039, 21857, -4551, 0, -5435, 21857, -3807, 0, -5756, 21857, -2967, 0, -5995, 21857, -2045, 0,
+-6144, 21857, -1052, 0, -6195, 21857, 0, 0, -3089, 21270, -8504, 0, -3919, 21270, -8182, 0,
+-4690, 21270, -7666, 0, -5391, 21270, -6972, 0, -6013, 21270, -6116, 0, -6544, 21270, -5116, 0,
+-6976, 21270, -3988, 0, -7297, 21270, -2748, 0, -7497, 21270, -1413, 0, -7566, 21270, 0, 0,
+-3336, 20759, -10894, 0, -4399, 20759, -10482, 0, -5387, 20759, -9820, 0, -6285, 20759, -8931, 0,
+-7082, 20759, -7836, 0, -7763, 20759, -6555, 0, -8316, 20759, -5109, 0, -8727, 20759, -3521, 0,
+-8983, 20759, -1811, 0, -9071, 20759, 0, 0, -3589, 20284, -13342, 0, -4891, 20284, -12837, 0,
+-6101, 20284, -12027, 0, -7201, 20284, -10939, 0, -8176, 20284, -9597, 0, -9011, 20284, -8028, 0,
+-9688, 20284, -6258, 0, -10191, 20284, -4312, 0, -10505, 20284, -2218, 0, -10613, 20284, 0, 0,
+-3832, 19810, -15694, 0, -5364, 19810, -15100, 0, -6786, 19810, -14147, 0, -8081, 19810, -12866, 0,
+-9228, 19810, -11288, 0, -10209, 19810, -9442, 0, -11006, 19810, -7360, 0, -11598, 19810, -5072, 0,
+-11967, 19810, -2609, 0, -12094, 19810, 0, 0, -4049, 19298, -17793, 0, -5786, 19298, -17120, 0,
+-7398, 19298, -16039, 0, -8866, 19298, -14587, 0, -10167, 19298, -12798, 0, -11279, 19298, -10705, 0,
+-12182, 19298, -8345, 0, -12853, 19298, -5751, 0, -13272, 19298, -2958, 0, -13416, 19298, 0, 0,
+-4224, 18712, -19485, 0, -6125, 18712, -18747, 0, -7891, 18712, -17564, 0, -9499, 18712, -15974, 0,
+-10923, 18712, -14015, 0, -12141, 18712, -11723, 0, -13130, 18712, -9138, 0, -13865, 18712, -6297, 0,
+-14324, 18712, -3239, 0, -14482, 18712, 0, 0, -4340, 18012, -20613, 0, -6352, 18012, -19833, 0,
+-8221, 18012, -18582, 0, -9921, 18012, -16900, 0, -11428, 18012, -14827, 0, -12717, 18012, -12402, 0,
+-13763, 18012, -9668, 0, -14541, 18012, -6662, 0, -15026, 18012, -3426, 0, -15193, 18012, 0, 0,
+-4383, 17164, -21024, 0, -6435, 17164, -20229, 0, -8340, 17164, -18952, 0, -10075, 17164, -17236, 0,
+-11612, 17164, -15122, 0, -12926, 17164, -12650, 0, -13993, 17164, -9860, 0, -14786, 17164, -6795, 0,
+-15281, 17164, -3495, 0, -15452, 17164, 0, 0, -5019, 22556, 751, 0, -4913, 22556, 1460, 0,
+-4743, 22556, 2119, 0, -4513, 22556, 2719, 0, -4231, 22556, 3250, 0, -3900, 22556, 3704, 0,
+-3528, 22556, 4073, 0, -3118, 22556, 4348, 0, -2677, 22556, 4519, 0, -2210, 22556, 4578, 0,
+-6144, 21857, 1052, 0, -5995, 21857, 2045, 0, -5756, 21857, 2967, 0, -5435, 21857, 3807, 0,
+-5039, 21857, 4551, 0, -4577, 21857, 5187, 0, -4055, 21857, 5703, 0, -3482, 21857, 6087, 0,
+-2864, 21857, 6327, 0, -2210, 21857, 6409, 0, -7497, 21270, 1413, 0, -7297, 21270, 2748, 0,
+-6976, 21270, 3988, 0, -6544, 21270, 5116, 0, -6013, 21270, 6116, 0, -5391, 21270, 6972, 0,
+-4690, 21270, 7666, 0, -3919, 21270, 8182, 0, -3089, 21270, 8504, 0, -2210, 21270, 8614, 0,
+-8983, 20759, 1811, 0, -8727, 20759, 3521, 0, -8316, 20759, 5109, 0, -7763, 20759, 6555, 0,
+-7082, 20759, 7836, 0, -6285, 20759, 8931, 0, -5387, 20759, 9820, 0, -4399, 20759, 10482, 0,
+-3336, 20759, 10894, 0, -2210, 20759, 11036, 0, -10505, 20284, 2218, 0, -10191, 20284, 4312, 0,
+-9688, 20284, 6258, 0, -9011, 20284, 8028, 0, -8176, 20284, 9597, 0, -7201, 20284, 10939, 0,
+-6101, 20284, 12027, 0, -4891, 20284, 12837, 0, -3589, 20284, 13342, 0, -2210, 20284, 13516, 0,
+-11967, 19810, 2609, 0, -11598, 19810, 5072, 0, -11006, 19810, 7360, 0, -10209, 19810, 9442, 0,
+-9228, 19810, 11288, 0, -8081, 19810, 12866, 0, -6786, 19810, 14147, 0, -5364, 19810, 15100, 0,
+-3832, 19810, 15694, 0, -2210, 19810, 15899, 0, -13272, 19298, 2958, 0, -12853, 19298, 5751, 0,
+-12182, 19298, 8345, 0, -11279, 19298, 10705, 0, -10167, 19298, 12798, 0, -8866, 19298, 14587, 0,
+-7398, 19298, 16039, 0, -5786, 19298, 17120, 0, -4049, 19298, 17793, 0, -2210, 19298, 18025, 0,
+-14324, 18712, 3239, 0, -13865, 18712, 6297, 0, -13130, 18712, 9138, 0, -12141, 18712, 11723, 0,
+-10923, 18712, 14015, 0, -9499, 18712, 15974, 0, -7891, 18712, 17564, 0, -6125, 18712, 18747, 0,
+-4224, 18712, 19485, 0, -2210, 18712, 19739, 0, -15026, 18012, 3426, 0, -14541, 18012, 6662, 0,
+-13763, 18012, 9668, 0, -12717, 18012, 12402, 0, -11428, 18012, 14827, 0, -9921, 18012, 16900, 0,
+-8221, 18012, 18582, 0, -6352, 18012, 19833, 0, -4340, 18012, 20613, 0, -2210, 18012, 20882, 0,
+-15281, 17164, 3495, 0, -14786, 17164, 6795, 0, -13993, 17164, 9860, 0, -12926, 17164, 12650, 0,
+-11612, 17164, 15122, 0, -10075, 17164, 17236, 0, -8340, 17164, 18952, 0, -6435, 17164, 20229, 0,
+-4383, 17164, 21024, 0, -2210, 17164, 21299, 0, -1743, 22556, 4519, 0, -1302, 22556, 4348, 0,
+-893, 22556, 4073, 0, -520, 22556, 3704, 0, -190, 22556, 3250, 0, 93, 22556, 2719, 0,
+322, 22556, 2119, 0, 493, 22556, 1460, 0, 599, 22556, 751, 0, -1556, 21857, 6327, 0,
+-939, 21857, 6087, 0, -366, 21857, 5703, 0, 156, 21857, 5187, 0, 619, 21857, 4551, 0,
+1014, 21857, 3807, 0, 1335, 21857, 2967, 0, 1574, 21857, 2045, 0, 1723, 21857, 1052, 0,
+-1332, 21270, 8504, 0, -502, 21270, 8182, 0, 269, 21270, 7666, 0, 970, 21270, 6972, 0,
+1592, 21270, 6116, 0, 2124, 21270, 5116, 0, 2555, 21270, 3988, 0, 2876, 21270, 2748, 0,
+3076, 21270, 1413, 0, -1085, 20759, 10894, 0, -21, 20759, 10482, 0, 966, 20759, 9820, 0,
+1865, 20759, 8931, 0, 2661, 20759, 7836, 0, 3342, 20759, 6555, 0, 3895, 20759, 5109, 0,
+4306, 20759, 3521, 0, 4562, 20759, 1811, 0, -831, 20284, 13342, 0, 471, 20284, 12837, 0,
+1680, 20284, 12027, 0, 2780, 20284, 10939, 0, 3756, 20284, 9597, 0, 4590, 20284, 8028, 0,
+5267, 20284, 6258, 0, 5771, 20284, 4312, 0, 6085, 20284, 2218, 0, -589, 19810, 15694, 0,
+943, 19810, 15100, 0, 2366, 19810, 14147, 0, 3660, 19810, 12866, 0, 4807, 19810, 11288, 0,
+5789, 19810, 9442, 0, 6585, 19810, 7360, 0, 7177, 19810, 5072, 0, 7546, 19810, 2609, 0,
+-372, 19298, 17793, 0, 1365, 19298, 17120, 0, 2978, 19298, 16039, 0, 4445, 19298, 14587, 0,
+5746, 19298, 12798, 0, 6859, 19298, 10705, 0, 7761, 19298, 8345, 0, 8433, 19298, 5751, 0,
+8852, 19298, 2958, 0, -197, 18712, 19485, 0, 1705, 18712, 18747, 0, 3471, 18712, 17564, 0,
+5078, 18712, 15974, 0, 6503, 18712, 14015, 0, 7721, 18712, 11723, 0, 8709, 18712, 9138, 0,
+9445, 18712, 6297, 0, 9903, 18712, 3239, 0, -80, 18012, 20613, 0, 1932, 18012, 19833, 0,
+3800, 18012, 18582, 0, 5500, 18012, 16900, 0, 7007, 18012, 14827, 0, 8296, 18012, 12402, 0,
+9342, 18012, 9668, 0, 10120, 18012, 6662, 0, 10605, 18012, 3426, 0, -38, 17164, 21024, 0,
+2014, 17164, 20229, 0, 3920, 17164, 18952, 0, 5654, 17164, 17236, 0, 7191, 17164, 15122, 0,
+8506, 17164, 12650, 0, 9572, 17164, 9860, 0, 10366, 17164, 6795, 0, 10860, 17164, 3495, 0,
+-2210, -32767, 0, 0, 1744, -32722, 0, 0, 1694, -32722, 1044, 0, 1546, -32722, 2029, 0,
+1309, -32722, 2945, 0, 990, -32722, 3778, 0, 598, -32722, 4516, 0, 139, -32722, 5148, 0,
+-379, -32722, 5660, 0, -949, -32722, 6042, 0, -1561, -32722, 6279, 0, -2210, -32722, 6361, 0,
+4860, -32592, 1890, 0, 4952, -32592, 0, 0, 4592, -32592, 3676, 0, 4163, -32592, 5334, 0,
+3586, -32592, 6843, 0, 2875, -32592, 8180, 0, 2044, -32592, 9324, 0, 1106, -32592, 10252, 0,
+75, -32592, 10942, 0, -1035, -32592, 11372, 0, -2210, -32592, 11521, 0, 7366, -32388, 2560, 0,
+7491, -32388, 0, 0, 7003, -32388, 4978, 0, 6422, -32388, 7224, 0, 5641, -32388, 9267, 0,
+4677, -32388, 11079, 0, 3551, -32388, 12628, 0, 2281, -32388, 13885, 0, 885, -32388, 14820, 0,
+-619, -32388, 15403, 0, -2210, -32388, 15604, 0, 9288, -32118, 3074, 0, 9438, -32118, 0, 0,
+8853, -32118, 5978, 0, 8155, -32118, 8674, 0, 7216, -32118, 11128, 0, 6060, -32118, 13303, 0,
+4708, -32118, 15163, 0, 3182, -32118, 16672, 0, 1506, -32118, 17795, 0, -299, -32118, 18495, 0,
+-2210, -32118, 18736, 0, 10703, -31792, 3453, 0, 10872, -31792, 0, 0, 10215, -31792, 6713, 0,
+9431, -31792, 9742, 0, 8377, -31792, 12498, 0, 7078, -31792, 14940, 0, 5559, -31792, 17029, 0,
+3846, -31792, 18725, 0, 1963, -31792, 19985, 0, -64, -31792, 20771, 0, -2210, -31792, 21042, 0,
+11689, -31419, 3716, 0, 11870, -31419, 0, 0, 11163, -31419, 7226, 0, 10319, -31419, 10485, 0,
+9185, -31419, 13452, 0, 7787, -31419, 16080, 0, 6152, -31419, 18329, 0, 4308, -31419, 20154, 0,
+2282, -31419, 21511, 0, 100, -31419, 22357, 0, -2210, -31419, 22649, 0, 12322, -31009, 3885, 0,
+12511, -31009, 0, 0, 11772, -31009, 7555, 0, 10890, -31009, 10963, 0, 9703, -31009, 14064, 0,
+8242, -31009, 16812, 0, 6533, -31009, 19163, 0, 4605, -31009, 21071, 0, 2487, -31009, 22490, 0,
+205, -31009, 23375, 0, -2210, -31009, 23680, 0, 12678, -30570, 3981, 0, 12873, -30570, 0, 0,
+12115, -30570, 7740, 0, 11211, -30570, 11232, 0, 9996, -30570, 14409, 0, 8499, -30570, 17225, 0,
+6748, -30570, 19634, 0, 4772, -30570, 21588, 0, 2602, -30570, 23042, 0, 265, -30570, 23948, 0,
+-2210, -30570, 24261, 0, 12836, -30113, 4023, 0, 13032, -30113, 0, 0, 12266, -30113, 7822, 0,
+11353, -30113, 11351, 0, 10125, -30113, 14561, 0, 8612, -30113, 17407, 0, 6843, -30113, 19842, 0,
+4846, -30113, 21817, 0, 2653, -30113, 23286, 0, 291, -30113, 24202, 0, -2210, -30113, 24517, 0,
+-2859, -32722, 6279, 0, -3472, -32722, 6042, 0, -4041, -32722, 5660, 0, -4559, -32722, 5148, 0,
+-5018, -32722, 4516, 0, -5411, -32722, 3778, 0, -5729, -32722, 2945, 0, -5966, -32722, 2029, 0,
+-6114, -32722, 1044, 0, -6165, -32722, 0, 0, -3385, -32592, 11372, 0, -4495, -32592, 10942, 0,
+-5526, -32592, 10252, 0, -6464, -32592, 9324, 0, -7296, -32592, 8180, 0, -8007, -32592, 6843, 0,
+-8584, -32592, 5334, 0, -9013, -32592, 3676, 0, -9280, -32592, 1890, 0, -9373, -32592, 0, 0,
+-3802, -32388, 15403, 0, -5305, -32388, 14820, 0, -6701, -32388, 13885, 0, -7972, -32388, 12628, 0,
+-9098, -32388, 11079, 0, -10061, -32388, 9267, 0, -10843, -32388, 7224, 0, -11424, -32388, 4978, 0,
+-11786, -32388, 2560, 0, -11911, -32388, 0, 0, -4121, -32118, 18495, 0, -5926, -32118, 17795, 0,
+-7603, -32118, 16672, 0, -9128, -32118, 15163, 0, -10481, -32118, 13303, 0, -11637, -32118, 11128, 0,
+-12575, -32118, 8674, 0, -13273, -32118, 5978, 0, -13708, -32118, 3074, 0, -13858, -32118, 0, 0,
+-4357, -31792, 20771, 0, -6384, -31792, 19985, 0, -8267, -31792, 18725, 0, -9980, -31792, 17029, 0,
+-11499, -31792, 14940, 0, -12797, -31792, 12498, 0, -13851, -31792, 9742, 0, -14635, -31792, 6713, 0,
+-15124, -31792, 3453, 0, -15292, -31792, 0, 0, -4521, -31419, 22357, 0, -6703, -31419, 21511, 0,
+-8729, -31419, 20154, 0, -10573, -31419, 18329, 0, -12207, -31419, 16080, 0, -13605, -31419, 13452, 0,
+-14740, -31419, 10485, 0, -15583, -31419, 7226, 0, -16110, -31419, 3716, 0, -16291, -31419, 0, 0,
+-4626, -31009, 23375, 0, -6907, -31009, 22490, 0, -9026, -31009, 21071, 0, -10954, -31009, 19163, 0,
+-12663, -31009, 16812, 0, -14124, -31009, 14064, 0, -15310, -31009, 10963, 0, -16192, -31009, 7555, 0,
+-16742, -31009, 3885, 0, -16932, -31009, 0, 0, -4685, -30570, 23948, 0, -7022, -30570, 23042, 0,
+-9193, -30570, 21588, 0, -11168, -30570, 19634, 0, -12919, -30570, 17225, 0, -14416, -30570, 14409, 0,
+-15631, -30570, 11232, 0, -16535, -30570, 7740, 0, -17099, -30570, 3981, 0, -17293, -30570, 0, 0,
+-4711, -30113, 24202, 0, -7073, -30113, 23286, 0, -9267, -30113, 21817, 0, -11263, -30113, 19842, 0,
+-13032, -30113, 17407, 0, -14546, -30113, 14561, 0, -15774, -30113, 11351, 0, -16687, -30113, 7822, 0,
+-17256, -30113, 4023, 0, -17453, -30113, 0, 0, -6114, -32722, -1044, 0, -5966, -32722, -2029, 0,
+-5729, -32722, -2945, 0, -5411, -32722, -3778, 0, -5018, -32722, -4516, 0, -4559, -32722, -5148, 0,
+-4041, -32722, -5660, 0, -3472, -32722, -6042, 0, -2859, -32722, -6279, 0, -2210, -32722, -6361, 0,
+-9280, -32592, -1890, 0, -9013, -32592, -3676, 0, -8584, -32592, -5334, 0, -8007, -32592, -6843, 0,
+-7296, -32592, -8180, 0, -6464, -32592, -9324, 0, -5526, -32592, -10252, 0, -4495, -32592, -10942, 0,
+-3385, -32592, -11372, 0, -2210, -32592, -11521, 0, -11786, -32388, -2560, 0, -11424, -32388, -4978, 0,
+-10843, -32388, -7224, 0, -10061, -32388, -9267, 0, -9098, -32388, -11079, 0, -7972, -32388, -12628, 0,
+-6701, -32388, -13885, 0, -5305, -32388, -14820, 0, -3802, -32388, -15403, 0, -2210, -32388, -15604, 0,
+-13708, -32118, -3074, 0, -13273, -32118, -5978, 0, -12575, -32118, -8674, 0, -11637, -32118, -11128, 0,
+-10481, -32118, -13303, 0, -9128, -32118, -15163, 0, -7603, -32118, -16672, 0, -5926, -32118, -17795, 0,
+-4121, -32118, -18495, 0, -2210, -32118, -18736, 0, -15124, -31792, -3453, 0, -14635, -31792, -6713, 0,
+-13851, -31792, -9742, 0, -12797, -31792, -12498, 0, -11499, -31792, -14940, 0, -9980, -31792, -17029, 0,
+-8267, -31792, -18725, 0, -6384, -31792, -19985, 0, -4357, -31792, -20771, 0, -2210, -31792, -21042, 0,
+-16110, -31419, -3716, 0, -15583, -31419, -7226, 0, -14740, -31419, -10485, 0, -13605, -31419, -13452, 0,
+-12207, -31419, -16080, 0, -10573, -31419, -18329, 0, -8729, -31419, -20154, 0, -6703, -31419, -21511, 0,
+-4521, -31419, -22357, 0, -2210, -31419, -22649, 0, -16742, -31009, -3885, 0, -16192, -31009, -7555, 0,
+-15310, -31009, -10963, 0, -14124, -31009, -14064, 0, -12663, -31009, -16812, 0, -10954, -31009, -19163, 0,
+-9026, -31009, -21071, 0, -6907, -31009, -22490, 0, -4626, -31009, -23375, 0, -2210, -31009, -23680, 0,
+-17099, -30570, -3981, 0, -16535, -30570, -7740, 0, -15631, -30570, -11232, 0, -14416, -30570, -14409, 0,
+-12919, -30570, -17225, 0, -11168, -30570, -19634, 0, -9193, -30570, -21588, 0, -7022, -30570, -23042, 0,
+-4685, -30570, -23948, 0, -2210, -30570, -24261, 0, -17256, -30113, -4023, 0, -16687, -30113, -7822, 0,
+-15774, -30113, -11351, 0, -14546, -30113, -14561, 0, -13032, -30113, -17407, 0, -11263, -30113, -19842, 0,
+-9267, -30113, -21817, 0, -7073, -30113, -23286, 0, -4711, -30113, -24202, 0, -2210, -30113, -24517, 0,
+-1561, -32722, -6279, 0, -949, -32722, -6042, 0, -379, -32722, -5660, 0, 139, -32722, -5148, 0,
+598, -32722, -4516, 0, 990, -32722, -3778, 0, 1309, -32722, -2945, 0, 1546, -32722, -2029, 0,
+1694, -32722, -1044, 0, -1035, -32592, -11372, 0, 75, -32592, -10942, 0, 1106, -32592, -10252, 0,
+2044, -32592, -9324, 0, 2875, -32592, -8180, 0, 3586, -32592, -6843, 0, 4163, -32592, -5334, 0,
+4592, -32592, -3676, 0, 4860, -32592, -1890, 0, -619, -32388, -15403, 0, 885, -32388, -14820, 0,
+2281, -32388, -13885, 0, 3551, -32388, -12628, 0, 4677, -32388, -11079, 0, 5641, -32388, -9267, 0,
+6422, -32388, -7224, 0, 7003, -32388, -4978, 0, 7366, -32388, -2560, 0, -299, -32118, -18495, 0,
+1506, -32118, -17795, 0, 3182, -32118, -16672, 0, 4708, -32118, -15163, 0, 6060, -32118, -13303, 0,
+7216, -32118, -11128, 0, 8155, -32118, -8674, 0, 8853, -32118, -5978, 0, 9288, -32118, -3074, 0,
+-64, -31792, -20771, 0, 1963, -31792, -19985, 0, 3846, -31792, -18725, 0, 5559, -31792, -17029, 0,
+7078, -31792, -14940, 0, 8377, -31792, -12498, 0, 9431, -31792, -9742, 0, 10215, -31792, -6713, 0,
+10703, -31792, -3453, 0, 100, -31419, -22357, 0, 2282, -31419, -21511, 0, 4308, -31419, -20154, 0,
+6152, -31419, -18329, 0, 7787, -31419, -16080, 0, 9185, -31419, -13452, 0, 10319, -31419, -10485, 0,
+11163, -31419, -7226, 0, 11689, -31419, -3716, 0, 205, -31009, -23375, 0, 2487, -31009, -22490, 0,
+4605, -31009, -21071, 0, 6533, -31009, -19163, 0, 8242, -31009, -16812, 0, 9703, -31009, -14064, 0,
+10890, -31009, -10963, 0, 11772, -31009, -7555, 0, 12322, -31009, -3885, 0, 265, -30570, -23948, 0,
+2602, -30570, -23042, 0, 4772, -30570, -21588, 0, 6748, -30570, -19634, 0, 8499, -30570, -17225, 0,
+9996, -30570, -14409, 0, 11211, -30570, -11232, 0, 12115, -30570, -7740, 0, 12678, -30570, -3981, 0,
+291, -30113, -24202, 0, 2653, -30113, -23286, 0, 4846, -30113, -21817, 0, 6843, -30113, -19842, 0,
+8612, -30113, -17407, 0, 10125, -30113, -14561, 0, 11353, -30113, -11351, 0, 12266, -30113, -7822, 0,
+12836, -30113, -4023, 0
+};
+
+const uint16_t TeapotIndices[] = {
+0, 1, 2, 2, 3, 0, 4, 5, 1, 1, 0, 4, 6, 7, 5, 5, 4, 6, 8, 9, 7, 7, 6, 8,
+10, 11, 9, 9, 8, 10, 12, 13, 11, 11, 10, 12, 14, 15, 13, 13, 12, 14, 16, 17, 15, 15, 14, 16,
+18, 19, 17, 17, 16, 18, 20, 21, 19, 19, 18, 20, 22, 0, 3, 3, 23, 22, 24, 4, 0, 0, 22, 24,
+25, 6, 4, 4, 24, 25, 26, 8, 6, 6, 25, 26, 27, 10, 8, 8, 26, 27, 28, 12, 10, 10, 27, 28,
+29, 14, 12, 12, 28, 29, 30, 16, 14, 14, 29, 30, 31, 18, 16, 16, 30, 31, 32, 20, 18, 18, 31, 32,
+33, 22, 23, 23, 34, 33, 35, 24, 22, 22, 33, 35, 36, 25, 24, 24, 35, 36, 37, 26, 25, 25, 36, 37,
+38, 27, 26, 26, 37, 38, 39, 28, 27, 27, 38, 39, 40, 29, 28, 28, 39, 40, 41, 30, 29, 29, 40, 41,
+42, 31, 30, 30, 41, 42, 43, 32, 31, 31, 42, 43, 44, 33, 34, 34, 45, 44, 46, 35, 33, 33, 44, 46,
+47, 36, 35, 35, 46, 47, 48, 37, 36, 36, 47, 48, 49, 38, 37, 37, 48, 49, 50, 39, 38, 38, 49, 50,
+51, 40, 39, 39, 50, 51, 52, 41, 40, 40, 51, 52, 53, 42, 41, 41, 52, 53, 54, 43, 42, 42, 53, 54,
+55, 44, 45, 45, 56, 55, 57, 46, 44, 44, 55, 57, 58, 47, 46, 46, 57, 58, 59, 48, 47, 47, 58, 59,
+60, 49, 48, 48, 59, 60, 61, 50, 49, 49, 60, 61, 62, 51, 50, 50, 61, 62, 63, 52, 51, 51, 62, 63,
+64, 53, 52, 52, 63, 64, 65, 54, 53, 53, 64, 65, 66, 55, 56, 56, 67, 66, 68, 57, 55, 55, 66, 68,
+69, 58, 57, 57, 68, 69, 70, 59, 58, 58, 69, 70, 71, 60, 59, 59, 70, 71, 72, 61, 60, 60, 71, 72,
+73, 62, 61, 61, 72, 73, 74, 63, 62, 62, 73, 74, 75, 64, 63, 63, 74, 75, 76, 65, 64, 64, 75, 76,
+77, 66, 67, 67, 78, 77, 79, 68, 66, 66, 77, 79, 80, 69, 68, 68, 79, 80, 81, 70, 69, 69, 80, 81,
+82, 71, 70, 70, 81, 82, 83, 72, 71, 71, 82, 83, 84, 73, 72, 72, 83, 84, 85, 74, 73, 73, 84, 85,
+86, 75, 74, 74, 85, 86, 87, 76, 75, 75, 86, 87, 88, 77, 78, 78, 89, 88, 90, 79, 77, 77, 88, 90,
+91, 80, 79, 79, 90, 91, 92, 81, 80, 80, 91, 92, 93, 82, 81, 81, 92, 93, 94, 83, 82, 82, 93, 94,
+95, 84, 83, 83, 94, 95, 96, 85, 84, 84, 95, 96, 97, 86, 85, 85, 96, 97, 98, 87, 86, 86, 97, 98,
+99, 88, 89, 89, 100, 99, 101, 90, 88, 88, 99, 101, 102, 91, 90, 90, 101, 102, 103, 92, 91, 91, 102, 103,
+104, 93, 92, 92, 103, 104, 105, 94, 93, 93, 104, 105, 106, 95, 94, 94, 105, 106, 107, 96, 95, 95, 106, 107,
+108, 97, 96, 96, 107, 108, 109, 98, 97, 97, 108, 109, 110, 99, 100, 100, 111, 110, 112, 101, 99, 99, 110, 112,
+113, 102, 101, 101, 112, 113, 114, 103, 102, 102, 113, 114, 115, 104, 103, 103, 114, 115, 116, 105, 104, 104, 115, 116,
+117, 106, 105, 105, 116, 117, 118, 107, 106, 106, 117, 118, 119, 108, 107, 107, 118, 119, 120, 109, 108, 108, 119, 120,
+121, 122, 21, 21, 20, 121, 123, 124, 122, 122, 121, 123, 125, 126, 124, 124, 123, 125, 127, 128, 126, 126, 125, 127,
+129, 130, 128, 128, 127, 129, 131, 132, 130, 130, 129, 131, 133, 134, 132, 132, 131, 133, 135, 136, 134, 134, 133, 135,
+137, 138, 136, 136, 135, 137, 139, 140, 138, 138, 137, 139, 141, 121, 20, 20, 32, 141, 142, 123, 121, 121, 141, 142,
+143, 125, 123, 123, 142, 143, 144, 127, 125, 125, 143, 144, 145, 129, 127, 127, 144, 145, 146, 131, 129, 129, 145, 146,
+147, 133, 131, 131, 146, 147, 148, 135, 133, 133, 147, 148, 149, 137, 135, 135, 148, 149, 150, 139, 137, 137, 149, 150,
+151, 141, 32, 32, 43, 151, 152, 142, 141, 141, 151, 152, 153, 143, 142, 142, 152, 153, 154, 144, 143, 143, 153, 154,
+155, 145, 144, 144, 154, 155, 156, 146, 145, 145, 155, 156, 157, 147, 146, 146, 156, 157, 158, 148, 147, 147, 157, 158,
+159, 149, 148, 148, 158, 159, 160, 150, 149, 149, 159, 160, 161, 151, 43, 43, 54, 161, 162, 152, 151, 151, 161, 162,
+163, 153, 152, 152, 162, 163, 164, 154, 153, 153, 163, 164, 165, 155, 154, 154, 164, 165, 166, 156, 155, 155, 165, 166,
+167, 157, 156, 156, 166, 167, 168, 158, 157, 157, 167, 168, 169, 159, 158, 158, 168, 169, 170, 160, 159, 159, 169, 170,
+171, 161, 54, 54, 65, 171, 172, 162, 161, 161, 171, 172, 173, 163, 162, 162, 172, 173, 174, 164, 163, 163, 173, 174,
+175, 165, 164, 164, 174, 175, 176, 166, 165, 165, 175, 176, 177, 167, 166, 166, 176, 177, 178, 168, 167, 167, 177, 178,
+179, 169, 168, 168, 178, 179, 180, 170, 169, 169, 179, 180, 181, 171, 65, 65, 76, 181, 182, 172, 171, 171, 181, 182,
+183, 173, 172, 172, 182, 183, 184, 174, 173, 173, 183, 184, 185, 175, 174, 174, 184, 185, 186, 176, 175, 175, 185, 186,
+187, 177, 176, 176, 186, 187, 188, 178, 177, 177, 187, 188, 189, 179, 178, 178, 188, 189, 190, 180, 179, 179, 189, 190,
+191, 181, 76, 76, 87, 191, 192, 182, 181, 181, 191, 192, 193, 183, 182, 182, 192, 193, 194, 184, 183, 183, 193, 194,
+195, 185, 184, 184, 194, 195, 196, 186, 185, 185, 195, 196, 197, 187, 186, 186, 196, 197, 198, 188, 187, 187, 197, 198,
+199, 189, 188, 188, 198, 199, 200, 190, 189, 189, 199, 200, 201, 191, 87, 87, 98, 201, 202, 192, 191, 191, 201, 202,
+203, 193, 192, 192, 202, 203, 204, 194, 193, 193, 203, 204, 205, 195, 194, 194, 204, 205, 206, 196, 195, 195, 205, 206,
+207, 197, 196, 196, 206, 207, 208, 198, 197, 197, 207, 208, 209, 199, 198, 198, 208, 209, 210, 200, 199, 199, 209, 210,
+211, 201, 98, 98, 109, 211, 212, 202, 201, 201, 211, 212, 213, 203, 202, 202, 212, 213, 214, 204, 203, 203, 213, 214,
+215, 205, 204, 204, 214, 215, 216, 206, 205, 205, 215, 216, 217, 207, 206, 206, 216, 217, 218, 208, 207, 207, 217, 218,
+219, 209, 208, 208, 218, 219, 220, 210, 209, 209, 219, 220, 221, 211, 109, 109, 120, 221, 222, 212, 211, 211, 221, 222,
+223, 213, 212, 212, 222, 223, 224, 214, 213, 213, 223, 224, 225, 215, 214, 214, 224, 225, 226, 216, 215, 215, 225, 226,
+227, 217, 216, 216, 226, 227, 228, 218, 217, 217, 227, 228, 229, 219, 218, 218, 228, 229, 230, 220, 219, 219, 229, 230,
+231, 232, 140, 140, 139, 231, 233, 234, 232, 232, 231, 233, 235, 236, 234, 234, 233, 235, 237, 238, 236, 236, 235, 237,
+239, 240, 238, 238, 237, 239, 241, 242, 240, 240, 239, 241, 243, 244, 242, 242, 241, 243, 245, 246, 244, 244, 243, 245,
+247, 248, 246, 246, 245, 247, 249, 250, 248, 248, 247, 249, 251, 231, 139, 139, 150, 251, 252, 233, 231, 231, 251, 252,
+253, 235, 233, 233, 252, 253, 254, 237, 235, 235, 253, 254, 255, 239, 237, 237, 254, 255, 256, 241, 239, 239, 255, 256,
+257, 243, 241, 241, 256, 257, 258, 245, 243, 243, 257, 258, 259, 247, 245, 245, 258, 259, 260, 249, 247, 247, 259, 260,
+261, 251, 150, 150, 160, 261, 262, 252, 251, 251, 261, 262, 263, 253, 252, 252, 262, 263, 264, 254, 253, 253, 263, 264,
+265, 255, 254, 254, 264, 265, 266, 256, 255, 255, 265, 266, 267, 257, 256, 256, 266, 267, 268, 258, 257, 257, 267, 268,
+269, 259, 258, 258, 268, 269, 270, 260, 259, 259, 269, 270, 271, 261, 160, 160, 170, 271, 272, 262, 261, 261, 271, 272,
+273, 263, 262, 262, 272, 273, 274, 264, 263, 263, 273, 274, 275, 265, 264, 264, 274, 275, 276, 266, 265, 265, 275, 276,
+277, 267, 266, 266, 276, 277, 278, 268, 267, 267, 277, 278, 279, 269, 268, 268, 278, 279, 280, 270, 269, 269, 279, 280,
+281, 271, 170, 170, 180, 281, 282, 272, 271, 271, 281, 282, 283, 273, 272, 272, 282, 283, 284, 274, 273, 273, 283, 284,
+285, 275, 274, 274, 284, 285, 286, 276, 275, 275, 285, 286, 287, 277, 276, 276, 286, 287, 288, 278, 277, 277, 287, 288,
+289, 279, 278, 278, 288, 289, 290, 280, 279, 279, 289, 290, 291, 281, 180, 180, 190, 291, 292, 282, 281, 281, 291, 292,
+293, 283, 282, 282, 292, 293, 294, 284, 283, 283, 293, 294, 295, 285, 284, 284, 294, 295, 296, 286, 285, 285, 295, 296,
+297, 287, 286, 286, 296, 297, 298, 288, 287, 287, 297, 298, 299, 289, 288, 288, 298, 299, 300, 290, 289, 289, 299, 300,
+301, 291, 190, 190, 200, 301, 302, 292, 291, 291, 301, 302, 303, 293, 292, 292, 302, 303, 304, 294, 293, 293, 303, 304,
+305, 295, 294, 294, 304, 305, 306, 296, 295, 295, 305, 306, 307, 297, 296, 296, 306, 307, 308, 298, 297, 297, 307, 308,
+309, 299, 298, 298, 308, 309, 310, 300, 299, 299, 309, 310, 311, 301, 200, 200, 210, 311, 312, 302, 301, 301, 311, 312,
+313, 303, 302, 302, 312, 313, 314, 304, 303, 303, 313, 314, 315, 305, 304, 304, 314, 315, 316, 306, 305, 305, 315, 316,
+317, 307, 306, 306, 316, 317, 318, 308, 307, 307, 317, 318, 319, 309, 308, 308, 318, 319, 320, 310, 309, 309, 319, 320,
+321, 311, 210, 210, 220, 321, 322, 312, 311, 311, 321, 322, 323, 313, 312, 312, 322, 323, 324, 314, 313, 313, 323, 324,
+325, 315, 314, 314, 324, 325, 326, 316, 315, 315, 325, 326, 327, 317, 316, 316, 326, 327, 328, 318, 317, 317, 327, 328,
+329, 319, 318, 318, 328, 329, 330, 320, 319, 319, 329, 330, 331, 321, 220, 220, 230, 331, 332, 322, 321, 321, 331, 332,
+333, 323, 322, 322, 332, 333, 334, 324, 323, 323, 333, 334, 335, 325, 324, 324, 334, 335, 336, 326, 325, 325, 335, 336,
+337, 327, 326, 326, 336, 337, 338, 328, 327, 327, 337, 338, 339, 329, 328, 328, 338, 339, 340, 330, 329, 329, 339, 340,
+341, 342, 250, 250, 249, 341, 343, 344, 342, 342, 341, 343, 345, 346, 344, 344, 343, 345, 347, 348, 346, 346, 345, 347,
+349, 350, 348, 348, 347, 349, 351, 352, 350, 350, 349, 351, 353, 354, 352, 352, 351, 353, 355, 356, 354, 354, 353, 355,
+357, 358, 356, 356, 355, 357, 3, 2, 358, 358, 357, 3, 359, 341, 249, 249, 260, 359, 360, 343, 341, 341, 359, 360,
+361, 345, 343, 343, 360, 361, 362, 347, 345, 345, 361, 362, 363, 349, 347, 347, 362, 363, 364, 351, 349, 349, 363, 364,
+365, 353, 351, 351, 364, 365, 366, 355, 353, 353, 365, 366, 367, 357, 355, 355, 366, 367, 23, 3, 357, 357, 367, 23,
+368, 359, 260, 260, 270, 368, 369, 360, 359, 359, 368, 369, 370, 361, 360, 360, 369, 370, 371, 362, 361, 361, 370, 371,
+372, 363, 362, 362, 371, 372, 373, 364, 363, 363, 372, 373, 374, 365, 364, 364, 373, 374, 375, 366, 365, 365, 374, 375,
+376, 367, 366, 366, 375, 376, 34, 23, 367, 367, 376, 34, 377, 368, 270, 270, 280, 377, 378, 369, 368, 368, 377, 378,
+379, 370, 369, 369, 378, 379, 380, 371, 370, 370, 379, 380, 381, 372, 371, 371, 380, 381, 382, 373, 372, 372, 381, 382,
+383, 374, 373, 373, 382, 383, 384, 375, 374, 374, 383, 384, 385, 376, 375, 375, 384, 385, 45, 34, 376, 376, 385, 45,
+386, 377, 280, 280, 290, 386, 387, 378, 377, 377, 386, 387, 388, 379, 378, 378, 387, 388, 389, 380, 379, 379, 388, 389,
+390, 381, 380, 380, 389, 390, 391, 382, 381, 381, 390, 391, 392, 383, 382, 382, 391, 392, 393, 384, 383, 383, 392, 393,
+394, 385, 384, 384, 393, 394, 56, 45, 385, 385, 394, 56, 395, 386, 290, 290, 300, 395, 396, 387, 386, 386, 395, 396,
+397, 388, 387, 387, 396, 397, 398, 389, 388, 388, 397, 398, 399, 390, 389, 389, 398, 399, 400, 391, 390, 390, 399, 400,
+401, 392, 391, 391, 400, 401, 402, 393, 392, 392, 401, 402, 403, 394, 393, 393, 402, 403, 67, 56, 394, 394, 403, 67,
+404, 395, 300, 300, 310, 404, 405, 396, 395, 395, 404, 405, 406, 397, 396, 396, 405, 406, 407, 398, 397, 397, 406, 407,
+408, 399, 398, 398, 407, 408, 409, 400, 399, 399, 408, 409, 410, 401, 400, 400, 409, 410, 411, 402, 401, 401, 410, 411,
+412, 403, 402, 402, 411, 412, 78, 67, 403, 403, 412, 78, 413, 404, 310, 310, 320, 413, 414, 405, 404, 404, 413, 414,
+415, 406, 405, 405, 414, 415, 416, 407, 406, 406, 415, 416, 417, 408, 407, 407, 416, 417, 418, 409, 408, 408, 417, 418,
+419, 410, 409, 409, 418, 419, 420, 411, 410, 410, 419, 420, 421, 412, 411, 411, 420, 421, 89, 78, 412, 412, 421, 89,
+422, 413, 320, 320, 330, 422, 423, 414, 413, 413, 422, 423, 424, 415, 414, 414, 423, 424, 425, 416, 415, 415, 424, 425,
+426, 417, 416, 416, 425, 426, 427, 418, 417, 417, 426, 427, 428, 419, 418, 418, 427, 428, 429, 420, 419, 419, 428, 429,
+430, 421, 420, 420, 429, 430, 100, 89, 421, 421, 430, 100, 431, 422, 330, 330, 340, 431, 432, 423, 422, 422, 431, 432,
+433, 424, 423, 423, 432, 433, 434, 425, 424, 424, 433, 434, 435, 426, 425, 425, 434, 435, 436, 427, 426, 426, 435, 436,
+437, 428, 427, 427, 436, 437, 438, 429, 428, 428, 437, 438, 439, 430, 429, 429, 438, 439, 111, 100, 430, 430, 439, 111,
+440, 110, 111, 111, 441, 440, 442, 112, 110, 110, 440, 442, 443, 113, 112, 112, 442, 443, 444, 114, 113, 113, 443, 444,
+445, 115, 114, 114, 444, 445, 446, 116, 115, 115, 445, 446, 447, 117, 116, 116, 446, 447, 448, 118, 117, 117, 447, 448,
+449, 119, 118, 118, 448, 449, 450, 120, 119, 119, 449, 450, 451, 440, 441, 441, 452, 451, 453, 442, 440, 440, 451, 453,
+454, 443, 442, 442, 453, 454, 455, 444, 443, 443, 454, 455, 456, 445, 444, 444, 455, 456, 457, 446, 445, 445, 456, 457,
+458, 447, 446, 446, 457, 458, 459, 448, 447, 447, 458, 459, 460, 449, 448, 448, 459, 460, 461, 450, 449, 449, 460, 461,
+462, 451, 452, 452, 463, 462, 464, 453, 451, 451, 462, 464, 465, 454, 453, 453, 464, 465, 466, 455, 454, 454, 465, 466,
+467, 456, 455, 455, 466, 467, 468, 457, 456, 456, 467, 468, 469, 458, 457, 457, 468, 469, 470, 459, 458, 458, 469, 470,
+471, 460, 459, 459, 470, 471, 472, 461, 460, 460, 471, 472, 473, 462, 463, 463, 474, 473, 475, 464, 462, 462, 473, 475,
+476, 465, 464, 464, 475, 476, 477, 466, 465, 465, 476, 477, 478, 467, 466, 466, 477, 478, 479, 468, 467, 467, 478, 479,
+480, 469, 468, 468, 479, 480, 481, 470, 469, 469, 480, 481, 482, 471, 470, 470, 481, 482, 483, 472, 471, 471, 482, 483,
+484, 473, 474, 474, 485, 484, 486, 475, 473, 473, 484, 486, 487, 476, 475, 475, 486, 487, 488, 477, 476, 476, 487, 488,
+489, 478, 477, 477, 488, 489, 490, 479, 478, 478, 489, 490, 491, 480, 479, 479, 490, 491, 492, 481, 480, 480, 491, 492,
+493, 482, 481, 481, 492, 493, 494, 483, 482, 482, 493, 494, 495, 484, 485, 485, 496, 495, 497, 486, 484, 484, 495, 497,
+498, 487, 486, 486, 497, 498, 499, 488, 487, 487, 498, 499, 500, 489, 488, 488, 499, 500, 501, 490, 489, 489, 500, 501,
+502, 491, 490, 490, 501, 502, 503, 492, 491, 491, 502, 503, 504, 493, 492, 492, 503, 504, 505, 494, 493, 493, 504, 505,
+506, 495, 496, 496, 507, 506, 508, 497, 495, 495, 506, 508, 509, 498, 497, 497, 508, 509, 510, 499, 498, 498, 509, 510,
+511, 500, 499, 499, 510, 511, 512, 501, 500, 500, 511, 512, 513, 502, 501, 501, 512, 513, 514, 503, 502, 502, 513, 514,
+515, 504, 503, 503, 514, 515, 516, 505, 504, 504, 515, 516, 517, 506, 507, 507, 518, 517, 519, 508, 506, 506, 517, 519,
+520, 509, 508, 508, 519, 520, 521, 510, 509, 509, 520, 521, 522, 511, 510, 510, 521, 522, 523, 512, 511, 511, 522, 523,
+524, 513, 512, 512, 523, 524, 525, 514, 513, 513, 524, 525, 526, 515, 514, 514, 525, 526, 527, 516, 515, 515, 526, 527,
+528, 517, 518, 518, 529, 528, 530, 519, 517, 517, 528, 530, 531, 520, 519, 519, 530, 531, 532, 521, 520, 520, 531, 532,
+533, 522, 521, 521, 532, 533, 534, 523, 522, 522, 533, 534, 535, 524, 523, 523, 534, 535, 536, 525, 524, 524, 535, 536,
+537, 526, 525, 525, 536, 537, 538, 527, 526, 526, 537, 538, 539, 528, 529, 529, 540, 539, 541, 530, 528, 528, 539, 541,
+542, 531, 530, 530, 541, 542, 543, 532, 531, 531, 542, 543, 544, 533, 532, 532, 543, 544, 545, 534, 533, 533, 544, 545,
+546, 535, 534, 534, 545, 546, 547, 536, 535, 535, 546, 547, 548, 537, 536, 536, 547, 548, 549, 538, 537, 537, 548, 549,
+550, 221, 120, 120, 450, 550, 551, 222, 221, 221, 550, 551, 552, 223, 222, 222, 551, 552, 553, 224, 223, 223, 552, 553,
+554, 225, 224, 224, 553, 554, 555, 226, 225, 225, 554, 555, 556, 227, 226, 226, 555, 556, 557, 228, 227, 227, 556, 557,
+558, 229, 228, 228, 557, 558, 559, 230, 229, 229, 558, 559, 560, 550, 450, 450, 461, 560, 561, 551, 550, 550, 560, 561,
+562, 552, 551, 551, 561, 562, 563, 553, 552, 552, 562, 563, 564, 554, 553, 553, 563, 564, 565, 555, 554, 554, 564, 565,
+566, 556, 555, 555, 565, 566, 567, 557, 556, 556, 566, 567, 568, 558, 557, 557, 567, 568, 569, 559, 558, 558, 568, 569,
+570, 560, 461, 461, 472, 570, 571, 561, 560, 560, 570, 571, 572, 562, 561, 561, 571, 572, 573, 563, 562, 562, 572, 573,
+574, 564, 563, 563, 573, 574, 575, 565, 564, 564, 574, 575, 576, 566, 565, 565, 575, 576, 577, 567, 566, 566, 576, 577,
+578, 568, 567, 567, 577, 578, 579, 569, 568, 568, 578, 579, 580, 570, 472, 472, 483, 580, 581, 571, 570, 570, 580, 581,
+582, 572, 571, 571, 581, 582, 583, 573, 572, 572, 582, 583, 584, 574, 573, 573, 583, 584, 585, 575, 574, 574, 584, 585,
+586, 576, 575, 575, 585, 586, 587, 577, 576, 576, 586, 587, 588, 578, 577, 577, 587, 588, 589, 579, 578, 578, 588, 589,
+590, 580, 483, 483, 494, 590, 591, 581, 580, 580, 590, 591, 592, 582, 581, 581, 591, 592, 593, 583, 582, 582, 592, 593,
+594, 584, 583, 583, 593, 594, 595, 585, 584, 584, 594, 595, 596, 586, 585, 585, 595, 596, 597, 587, 586, 586, 596, 597,
+598, 588, 587, 587, 597, 598, 599, 589, 588, 588, 598, 599, 600, 590, 494, 494, 505, 600, 601, 591, 590, 590, 600, 601,
+602, 592, 591, 591, 601, 602, 603, 593, 592, 592, 602, 603, 604, 594, 593, 593, 603, 604, 605, 595, 594, 594, 604, 605,
+606, 596, 595, 595, 605, 606, 607, 597, 596, 596, 606, 607, 608, 598, 597, 597, 607, 608, 609, 599, 598, 598, 608, 609,
+610, 600, 505, 505, 516, 610, 611, 601, 600, 600, 610, 611, 612, 602, 601, 601, 611, 612, 613, 603, 602, 602, 612, 613,
+614, 604, 603, 603, 613, 614, 615, 605, 604, 604, 614, 615, 616, 606, 605, 605, 615, 616, 617, 607, 606, 606, 616, 617,
+618, 608, 607, 607, 617, 618, 619, 609, 608, 608, 618, 619, 620, 610, 516, 516, 527, 620, 621, 611, 610, 610, 620, 621,
+622, 612, 611, 611, 621, 622, 623, 613, 612, 612, 622, 623, 624, 614, 613, 613, 623, 624, 625, 615, 614, 614, 624, 625,
+626, 616, 615, 615, 625, 626, 627, 617, 616, 616, 626, 627, 628, 618, 617, 617, 627, 628, 629, 619, 618, 618, 628, 629,
+630, 620, 527, 527, 538, 630, 631, 621, 620, 620, 630, 631, 632, 622, 621, 621, 631, 632, 633, 623, 622, 622, 632, 633,
+634, 624, 623, 623, 633, 634, 635, 625, 624, 624, 634, 635, 636, 626, 625, 625, 635, 636, 637, 627, 626, 626, 636, 637,
+638, 628, 627, 627, 637, 638, 639, 629, 628, 628, 638, 639, 640, 630, 538, 538, 549, 640, 641, 631, 630, 630, 640, 641,
+642, 632, 631, 631, 641, 642, 643, 633, 632, 632, 642, 643, 644, 634, 633, 633, 643, 644, 645, 635, 634, 634, 644, 645,
+646, 636, 635, 635, 645, 646, 647, 637, 636, 636, 646, 647, 648, 638, 637, 637, 647, 648, 649, 639, 638, 638, 648, 649,
+650, 331, 230, 230, 559, 650, 651, 332, 331, 331, 650, 651, 652, 333, 332, 332, 651, 652, 653, 334, 333, 333, 652, 653,
+654, 335, 334, 334, 653, 654, 655, 336, 335, 335, 654, 655, 656, 337, 336, 336, 655, 656, 657, 338, 337, 337, 656, 657,
+658, 339, 338, 338, 657, 658, 659, 340, 339, 339, 658, 659, 660, 650, 559, 559, 569, 660, 661, 651, 650, 650, 660, 661,
+662, 652, 651, 651, 661, 662, 663, 653, 652, 652, 662, 663, 664, 654, 653, 653, 663, 664, 665, 655, 654, 654, 664, 665,
+666, 656, 655, 655, 665, 666, 667, 657, 656, 656, 666, 667, 668, 658, 657, 657, 667, 668, 669, 659, 658, 658, 668, 669,
+670, 660, 569, 569, 579, 670, 671, 661, 660, 660, 670, 671, 672, 662, 661, 661, 671, 672, 673, 663, 662, 662, 672, 673,
+674, 664, 663, 663, 673, 674, 675, 665, 664, 664, 674, 675, 676, 666, 665, 665, 675, 676, 677, 667, 666, 666, 676, 677,
+678, 668, 667, 667, 677, 678, 679, 669, 668, 668, 678, 679, 680, 670, 579, 579, 589, 680, 681, 671, 670, 670, 680, 681,
+682, 672, 671, 671, 681, 682, 683, 673, 672, 672, 682, 683, 684, 674, 673, 673, 683, 684, 685, 675, 674, 674, 684, 685,
+686, 676, 675, 675, 685, 686, 687, 677, 676, 676, 686, 687, 688, 678, 677, 677, 687, 688, 689, 679, 678, 678, 688, 689,
+690, 680, 589, 589, 599, 690, 691, 681, 680, 680, 690, 691, 692, 682, 681, 681, 691, 692, 693, 683, 682, 682, 692, 693,
+694, 684, 683, 683, 693, 694, 695, 685, 684, 684, 694, 695, 696, 686, 685, 685, 695, 696, 697, 687, 686, 686, 696, 697,
+698, 688, 687, 687, 697, 698, 699, 689, 688, 688, 698, 699, 700, 690, 599, 599, 609, 700, 701, 691, 690, 690, 700, 701,
+702, 692, 691, 691, 701, 702, 703, 693, 692, 692, 702, 703, 704, 694, 693, 693, 703, 704, 705, 695, 694, 694, 704, 705,
+706, 696, 695, 695, 705, 706, 707, 697, 696, 696, 706, 707, 708, 698, 697, 697, 707, 708, 709, 699, 698, 698, 708, 709,
+710, 700, 609, 609, 619, 710, 711, 701, 700, 700, 710, 711, 712, 702, 701, 701, 711, 712, 713, 703, 702, 702, 712, 713,
+714, 704, 703, 703, 713, 714, 715, 705, 704, 704, 714, 715, 716, 706, 705, 705, 715, 716, 717, 707, 706, 706, 716, 717,
+718, 708, 707, 707, 717, 718, 719, 709, 708, 708, 718, 719, 720, 710, 619, 619, 629, 720, 721, 711, 710, 710, 720, 721,
+722, 712, 711, 711, 721, 722, 723, 713, 712, 712, 722, 723, 724, 714, 713, 713, 723, 724, 725, 715, 714, 714, 724, 725,
+726, 716, 715, 715, 725, 726, 727, 717, 716, 716, 726, 727, 728, 718, 717, 717, 727, 728, 729, 719, 718, 718, 728, 729,
+730, 720, 629, 629, 639, 730, 731, 721, 720, 720, 730, 731, 732, 722, 721, 721, 731, 732, 733, 723, 722, 722, 732, 733,
+734, 724, 723, 723, 733, 734, 735, 725, 724, 724, 734, 735, 736, 726, 725, 725, 735, 736, 737, 727, 726, 726, 736, 737,
+738, 728, 727, 727, 737, 738, 739, 729, 728, 728, 738, 739, 740, 730, 639, 639, 649, 740, 741, 731, 730, 730, 740, 741,
+742, 732, 731, 731, 741, 742, 743, 733, 732, 732, 742, 743, 744, 734, 733, 733, 743, 744, 745, 735, 734, 734, 744, 745,
+746, 736, 735, 735, 745, 746, 747, 737, 736, 736, 746, 747, 748, 738, 737, 737, 747, 748, 749, 739, 738, 738, 748, 749,
+750, 431, 340, 340, 659, 750, 751, 432, 431, 431, 750, 751, 752, 433, 432, 432, 751, 752, 753, 434, 433, 433, 752, 753,
+754, 435, 434, 434, 753, 754, 755, 436, 435, 435, 754, 755, 756, 437, 436, 436, 755, 756, 757, 438, 437, 437, 756, 757,
+758, 439, 438, 438, 757, 758, 441, 111, 439, 439, 758, 441, 759, 750, 659, 659, 669, 759, 760, 751, 750, 750, 759, 760,
+761, 752, 751, 751, 760, 761, 762, 753, 752, 752, 761, 762, 763, 754, 753, 753, 762, 763, 764, 755, 754, 754, 763, 764,
+765, 756, 755, 755, 764, 765, 766, 757, 756, 756, 765, 766, 767, 758, 757, 757, 766, 767, 452, 441, 758, 758, 767, 452,
+768, 759, 669, 669, 679, 768, 769, 760, 759, 759, 768, 769, 770, 761, 760, 760, 769, 770, 771, 762, 761, 761, 770, 771,
+772, 763, 762, 762, 771, 772, 773, 764, 763, 763, 772, 773, 774, 765, 764, 764, 773, 774, 775, 766, 765, 765, 774, 775,
+776, 767, 766, 766, 775, 776, 463, 452, 767, 767, 776, 463, 777, 768, 679, 679, 689, 777, 778, 769, 768, 768, 777, 778,
+779, 770, 769, 769, 778, 779, 780, 771, 770, 770, 779, 780, 781, 772, 771, 771, 780, 781, 782, 773, 772, 772, 781, 782,
+783, 774, 773, 773, 782, 783, 784, 775, 774, 774, 783, 784, 785, 776, 775, 775, 784, 785, 474, 463, 776, 776, 785, 474,
+786, 777, 689, 689, 699, 786, 787, 778, 777, 777, 786, 787, 788, 779, 778, 778, 787, 788, 789, 780, 779, 779, 788, 789,
+790, 781, 780, 780, 789, 790, 791, 782, 781, 781, 790, 791, 792, 783, 782, 782, 791, 792, 793, 784, 783, 783, 792, 793,
+794, 785, 784, 784, 793, 794, 485, 474, 785, 785, 794, 485, 795, 786, 699, 699, 709, 795, 796, 787, 786, 786, 795, 796,
+797, 788, 787, 787, 796, 797, 798, 789, 788, 788, 797, 798, 799, 790, 789, 789, 798, 799, 800, 791, 790, 790, 799, 800,
+801, 792, 791, 791, 800, 801, 802, 793, 792, 792, 801, 802, 803, 794, 793, 793, 802, 803, 496, 485, 794, 794, 803, 496,
+804, 795, 709, 709, 719, 804, 805, 796, 795, 795, 804, 805, 806, 797, 796, 796, 805, 806, 807, 798, 797, 797, 806, 807,
+808, 799, 798, 798, 807, 808, 809, 800, 799, 799, 808, 809, 810, 801, 800, 800, 809, 810, 811, 802, 801, 801, 810, 811,
+812, 803, 802, 802, 811, 812, 507, 496, 803, 803, 812, 507, 813, 804, 719, 719, 729, 813, 814, 805, 804, 804, 813, 814,
+815, 806, 805, 805, 814, 815, 816, 807, 806, 806, 815, 816, 817, 808, 807, 807, 816, 817, 818, 809, 808, 808, 817, 818,
+819, 810, 809, 809, 818, 819, 820, 811, 810, 810, 819, 820, 821, 812, 811, 811, 820, 821, 518, 507, 812, 812, 821, 518,
+822, 813, 729, 729, 739, 822, 823, 814, 813, 813, 822, 823, 824, 815, 814, 814, 823, 824, 825, 816, 815, 815, 824, 825,
+826, 817, 816, 816, 825, 826, 827, 818, 817, 817, 826, 827, 828, 819, 818, 818, 827, 828, 829, 820, 819, 819, 828, 829,
+830, 821, 820, 820, 829, 830, 529, 518, 821, 821, 830, 529, 831, 822, 739, 739, 749, 831, 832, 823, 822, 822, 831, 832,
+833, 824, 823, 823, 832, 833, 834, 825, 824, 824, 833, 834, 835, 826, 825, 825, 834, 835, 836, 827, 826, 826, 835, 836,
+837, 828, 827, 827, 836, 837, 838, 829, 828, 828, 837, 838, 839, 830, 829, 829, 838, 839, 540, 529, 830, 830, 839, 540,
+840, 539, 540, 540, 841, 840, 842, 541, 539, 539, 840, 842, 843, 542, 541, 541, 842, 843, 844, 543, 542, 542, 843, 844,
+845, 544, 543, 543, 844, 845, 846, 545, 544, 544, 845, 846, 847, 546, 545, 545, 846, 847, 848, 547, 546, 546, 847, 848,
+849, 548, 547, 547, 848, 849, 850, 549, 548, 548, 849, 850, 851, 840, 841, 841, 852, 851, 853, 842, 840, 840, 851, 853,
+854, 843, 842, 842, 853, 854, 855, 844, 843, 843, 854, 855, 856, 845, 844, 844, 855, 856, 857, 846, 845, 845, 856, 857,
+858, 847, 846, 846, 857, 858, 859, 848, 847, 847, 858, 859, 860, 849, 848, 848, 859, 860, 861, 850, 849, 849, 860, 861,
+862, 851, 852, 852, 863, 862, 864, 853, 851, 851, 862, 864, 865, 854, 853, 853, 864, 865, 866, 855, 854, 854, 865, 866,
+867, 856, 855, 855, 866, 867, 868, 857, 856, 856, 867, 868, 869, 858, 857, 857, 868, 869, 870, 859, 858, 858, 869, 870,
+871, 860, 859, 859, 870, 871, 872, 861, 860, 860, 871, 872, 873, 862, 863, 863, 874, 873, 875, 864, 862, 862, 873, 875,
+876, 865, 864, 864, 875, 876, 877, 866, 865, 865, 876, 877, 878, 867, 866, 866, 877, 878, 879, 868, 867, 867, 878, 879,
+880, 869, 868, 868, 879, 880, 881, 870, 869, 869, 880, 881, 882, 871, 870, 870, 881, 882, 883, 872, 871, 871, 882, 883,
+884, 873, 874, 874, 885, 884, 886, 875, 873, 873, 884, 886, 887, 876, 875, 875, 886, 887, 888, 877, 876, 876, 887, 888,
+889, 878, 877, 877, 888, 889, 890, 879, 878, 878, 889, 890, 891, 880, 879, 879, 890, 891, 892, 881, 880, 880, 891, 892,
+893, 882, 881, 881, 892, 893, 894, 883, 882, 882, 893, 894, 895, 884, 885, 885, 896, 895, 897, 886, 884, 884, 895, 897,
+898, 887, 886, 886, 897, 898, 899, 888, 887, 887, 898, 899, 900, 889, 888, 888, 899, 900, 901, 890, 889, 889, 900, 901,
+902, 891, 890, 890, 901, 902, 903, 892, 891, 891, 902, 903, 904, 893, 892, 892, 903, 904, 905, 894, 893, 893, 904, 905,
+906, 895, 896, 896, 907, 906, 908, 897, 895, 895, 906, 908, 909, 898, 897, 897, 908, 909, 910, 899, 898, 898, 909, 910,
+911, 900, 899, 899, 910, 911, 912, 901, 900, 900, 911, 912, 913, 902, 901, 901, 912, 913, 914, 903, 902, 902, 913, 914,
+915, 904, 903, 903, 914, 915, 916, 905, 904, 904, 915, 916, 917, 906, 907, 907, 918, 917, 919, 908, 906, 906, 917, 919,
+920, 909, 908, 908, 919, 920, 921, 910, 909, 909, 920, 921, 922, 911, 910, 910, 921, 922, 923, 912, 911, 911, 922, 923,
+924, 913, 912, 912, 923, 924, 925, 914, 913, 913, 924, 925, 926, 915, 914, 914, 925, 926, 927, 916, 915, 915, 926, 927,
+928, 917, 918, 918, 929, 928, 930, 919, 917, 917, 928, 930, 931, 920, 919, 919, 930, 931, 932, 921, 920, 920, 931, 932,
+933, 922, 921, 921, 932, 933, 934, 923, 922, 922, 933, 934, 935, 924, 923, 923, 934, 935, 936, 925, 924, 924, 935, 936,
+937, 926, 925, 925, 936, 937, 938, 927, 926, 926, 937, 938, 939, 928, 929, 929, 940, 939, 941, 930, 928, 928, 939, 941,
+942, 931, 930, 930, 941, 942, 943, 932, 931, 931, 942, 943, 944, 933, 932, 932, 943, 944, 945, 934, 933, 933, 944, 945,
+946, 935, 934, 934, 945, 946, 947, 936, 935, 935, 946, 947, 948, 937, 936, 936, 947, 948, 949, 938, 937, 937, 948, 949,
+950, 640, 549, 549, 850, 950, 951, 641, 640, 640, 950, 951, 952, 642, 641, 641, 951, 952, 953, 643, 642, 642, 952, 953,
+954, 644, 643, 643, 953, 954, 955, 645, 644, 644, 954, 955, 956, 646, 645, 645, 955, 956, 957, 647, 646, 646, 956, 957,
+958, 648, 647, 647, 957, 958, 959, 649, 648, 648, 958, 959, 960, 950, 850, 850, 861, 960, 961, 951, 950, 950, 960, 961,
+962, 952, 951, 951, 961, 962, 963, 953, 952, 952, 962, 963, 964, 954, 953, 953, 963, 964, 965, 955, 954, 954, 964, 965,
+966, 956, 955, 955, 965, 966, 967, 957, 956, 956, 966, 967, 968, 958, 957, 957, 967, 968, 969, 959, 958, 958, 968, 969,
+970, 960, 861, 861, 872, 970, 971, 961, 960, 960, 970, 971, 972, 962, 961, 961, 971, 972, 973, 963, 962, 962, 972, 973,
+974, 964, 963, 963, 973, 974, 975, 965, 964, 964, 974, 975, 976, 966, 965, 965, 975, 976, 977, 967, 966, 966, 976, 977,
+978, 968, 967, 967, 977, 978, 979, 969, 968, 968, 978, 979, 980, 970, 872, 872, 883, 980, 981, 971, 970, 970, 980, 981,
+982, 972, 971, 971, 981, 982, 983, 973, 972, 972, 982, 983, 984, 974, 973, 973, 983, 984, 985, 975, 974, 974, 984, 985,
+986, 976, 975, 975, 985, 986, 987, 977, 976, 976, 986, 987, 988, 978, 977, 977, 987, 988, 989, 979, 978, 978, 988, 989,
+990, 980, 883, 883, 894, 990, 991, 981, 980, 980, 990, 991, 992, 982, 981, 981, 991, 992, 993, 983, 982, 982, 992, 993,
+994, 984, 983, 983, 993, 994, 995, 985, 984, 984, 994, 995, 996, 986, 985, 985, 995, 996, 997, 987, 986, 986, 996, 997,
+998, 988, 987, 987, 997, 998, 999, 989, 988, 988, 998, 999, 1000, 990, 894, 894, 905, 1000, 1001, 991, 990, 990, 1000, 1001,
+1002, 992, 991, 991, 1001, 1002, 1003, 993, 992, 992, 1002, 1003, 1004, 994, 993, 993, 1003, 1004, 1005, 995, 994, 994, 1004, 1005,
+1006, 996, 995, 995, 1005, 1006, 1007, 997, 996, 996, 1006, 1007, 1008, 998, 997, 997, 1007, 1008, 1009, 999, 998, 998, 1008, 1009,
+1010, 1000, 905, 905, 916, 1010, 1011, 1001, 1000, 1000, 1010, 1011, 1012, 1002, 1001, 1001, 1011, 1012, 1013, 1003, 1002, 1002, 1012, 1013,
+1014, 1004, 1003, 1003, 1013, 1014, 1015, 1005, 1004, 1004, 1014, 1015, 1016, 1006, 1005, 1005, 1015, 1016, 1017, 1007, 1006, 1006, 1016, 1017,
+1018, 1008, 1007, 1007, 1017, 1018, 1019, 1009, 1008, 1008, 1018, 1019, 1020, 1010, 916, 916, 927, 1020, 1021, 1011, 1010, 1010, 1020, 1021,
+1022, 1012, 1011, 1011, 1021, 1022, 1023, 1013, 1012, 1012, 1022, 1023, 1024, 1014, 1013, 1013, 1023, 1024, 1025, 1015, 1014, 1014, 1024, 1025,
+1026, 1016, 1015, 1015, 1025, 1026, 1027, 1017, 1016, 1016, 1026, 1027, 1028, 1018, 1017, 1017, 1027, 1028, 1029, 1019, 1018, 1018, 1028, 1029,
+1030, 1020, 927, 927, 938, 1030, 1031, 1021, 1020, 1020, 1030, 1031, 1032, 1022, 1021, 1021, 1031, 1032, 1033, 1023, 1022, 1022, 1032, 1033,
+1034, 1024, 1023, 1023, 1033, 1034, 1035, 1025, 1024, 1024, 1034, 1035, 1036, 1026, 1025, 1025, 1035, 1036, 1037, 1027, 1026, 1026, 1036, 1037,
+1038, 1028, 1027, 1027, 1037, 1038, 1039, 1029, 1028, 1028, 1038, 1039, 1040, 1030, 938, 938, 949, 1040, 1041, 1031, 1030, 1030, 1040, 1041,
+1042, 1032, 1031, 1031, 1041, 1042, 1043, 1033, 1032, 1032, 1042, 1043, 1044, 1034, 1033, 1033, 1043, 1044, 1045, 1035, 1034, 1034, 1044, 1045,
+1046, 1036, 1035, 1035, 1045, 1046, 1047, 1037, 1036, 1036, 1046, 1047, 1048, 1038, 1037, 1037, 1047, 1048, 1049, 1039, 1038, 1038, 1048, 1049,
+1050, 740, 649, 649, 959, 1050, 1051, 741, 740, 740, 1050, 1051, 1052, 742, 741, 741, 1051, 1052, 1053, 743, 742, 742, 1052, 1053,
+1054, 744, 743, 743, 1053, 1054, 1055, 745, 744, 744, 1054, 1055, 1056, 746, 745, 745, 1055, 1056, 1057, 747, 746, 746, 1056, 1057,
+1058, 748, 747, 747, 1057, 1058, 1059, 749, 748, 748, 1058, 1059, 1060, 1050, 959, 959, 969, 1060, 1061, 1051, 1050, 1050, 1060, 1061,
+1062, 1052, 1051, 1051, 1061, 1062, 1063, 1053, 1052, 1052, 1062, 1063, 1064, 1054, 1053, 1053, 1063, 1064, 1065, 1055, 1054, 1054, 1064, 1065,
+1066, 1056, 1055, 1055, 1065, 1066, 1067, 1057, 1056, 1056, 1066, 1067, 1068, 1058, 1057, 1057, 1067, 1068, 1069, 1059, 1058, 1058, 1068, 1069,
+1070, 1060, 969, 969, 979, 1070, 1071, 1061, 1060, 1060, 1070, 1071, 1072, 1062, 1061, 1061, 1071, 1072, 1073, 1063, 1062, 1062, 1072, 1073,
+1074, 1064, 1063, 1063, 1073, 1074, 1075, 1065, 1064, 1064, 1074, 1075, 1076, 1066, 1065, 1065, 1075, 1076, 1077, 1067, 1066, 1066, 1076, 1077,
+1078, 1068, 1067, 1067, 1077, 1078, 1079, 1069, 1068, 1068, 1078, 1079, 1080, 1070, 979, 979, 989, 1080, 1081, 1071, 1070, 1070, 1080, 1081,
+1082, 1072, 1071, 1071, 1081, 1082, 1083, 1073, 1072, 1072, 1082, 1083, 1084, 1074, 1073, 1073, 1083, 1084, 1085, 1075, 1074, 1074, 1084, 1085,
+1086, 1076, 1075, 1075, 1085, 1086, 1087, 1077, 1076, 1076, 1086, 1087, 1088, 1078, 1077, 1077, 1087, 1088, 1089, 1079, 1078, 1078, 1088, 1089,
+1090, 1080, 989, 989, 999, 1090, 1091, 1081, 1080, 1080, 1090, 1091, 1092, 1082, 1081, 1081, 1091, 1092, 1093, 1083, 1082, 1082, 1092, 1093,
+1094, 1084, 1083, 1083, 1093, 1094, 1095, 1085, 1084, 1084, 1094, 1095, 1096, 1086, 1085, 1085, 1095, 1096, 1097, 1087, 1086, 1086, 1096, 1097,
+1098, 1088, 1087, 1087, 1097, 1098, 1099, 1089, 1088, 1088, 1098, 1099, 1100, 1090, 999, 999, 1009, 1100, 1101, 1091, 1090, 1090, 1100, 1101,
+1102, 1092, 1091, 1091, 1101, 1102, 1103, 1093, 1092, 1092, 1102, 1103, 1104, 1094, 1093, 1093, 1103, 1104, 1105, 1095, 1094, 1094, 1104, 1105,
+1106, 1096, 1095, 1095, 1105, 1106, 1107, 1097, 1096, 1096, 1106, 1107, 1108, 1098, 1097, 1097, 1107, 1108, 1109, 1099, 1098, 1098, 1108, 1109,
+1110, 1100, 1009, 1009, 1019, 1110, 1111, 1101, 1100, 1100, 1110, 1111, 1112, 1102, 1101, 1101, 1111, 1112, 1113, 1103, 1102, 1102, 1112, 1113,
+1114, 1104, 1103, 1103, 1113, 1114, 1115, 1105, 1104, 1104, 1114, 1115, 1116, 1106, 1105, 1105, 1115, 1116, 1117, 1107, 1106, 1106, 1116, 1117,
+1118, 1108, 1107, 1107, 1117, 1118, 1119, 1109, 1108, 1108, 1118, 1119, 1120, 1110, 1019, 1019, 1029, 1120, 1121, 1111, 1110, 1110, 1120, 1121,
+1122, 1112, 1111, 1111, 1121, 1122, 1123, 1113, 1112, 1112, 1122, 1123, 1124, 1114, 1113, 1113, 1123, 1124, 1125, 1115, 1114, 1114, 1124, 1125,
+1126, 1116, 1115, 1115, 1125, 1126, 1127, 1117, 1116, 1116, 1126, 1127, 1128, 1118, 1117, 1117, 1127, 1128, 1129, 1119, 1118, 1118, 1128, 1129,
+1130, 1120, 1029, 1029, 1039, 1130, 1131, 1121, 1120, 1120, 1130, 1131, 1132, 1122, 1121, 1121, 1131, 1132, 1133, 1123, 1122, 1122, 1132, 1133,
+1134, 1124, 1123, 1123, 1133, 1134, 1135, 1125, 1124, 1124, 1134, 1135, 1136, 1126, 1125, 1125, 1135, 1136, 1137, 1127, 1126, 1126, 1136, 1137,
+1138, 1128, 1127, 1127, 1137, 1138, 1139, 1129, 1128, 1128, 1138, 1139, 1140, 1130, 1039, 1039, 1049, 1140, 1141, 1131, 1130, 1130, 1140, 1141,
+1142, 1132, 1131, 1131, 1141, 1142, 1143, 1133, 1132, 1132, 1142, 1143, 1144, 1134, 1133, 1133, 1143, 1144, 1145, 1135, 1134, 1134, 1144, 1145,
+1146, 1136, 1135, 1135, 1145, 1146, 1147, 1137, 1136, 1136, 1146, 1147, 1148, 1138, 1137, 1137, 1147, 1148, 1149, 1139, 1138, 1138, 1148, 1149,
+1150, 831, 749, 749, 1059, 1150, 1151, 832, 831, 831, 1150, 1151, 1152, 833, 832, 832, 1151, 1152, 1153, 834, 833, 833, 1152, 1153,
+1154, 835, 834, 834, 1153, 1154, 1155, 836, 835, 835, 1154, 1155, 1156, 837, 836, 836, 1155, 1156, 1157, 838, 837, 837, 1156, 1157,
+1158, 839, 838, 838, 1157, 1158, 841, 540, 839, 839, 1158, 841, 1159, 1150, 1059, 1059, 1069, 1159, 1160, 1151, 1150, 1150, 1159, 1160,
+1161, 1152, 1151, 1151, 1160, 1161, 1162, 1153, 1152, 1152, 1161, 1162, 1163, 1154, 1153, 1153, 1162, 1163, 1164, 1155, 1154, 1154, 1163, 1164,
+1165, 1156, 1155, 1155, 1164, 1165, 1166, 1157, 1156, 1156, 1165, 1166, 1167, 1158, 1157, 1157, 1166, 1167, 852, 841, 1158, 1158, 1167, 852,
+1168, 1159, 1069, 1069, 1079, 1168, 1169, 1160, 1159, 1159, 1168, 1169, 1170, 1161, 1160, 1160, 1169, 1170, 1171, 1162, 1161, 1161, 1170, 1171,
+1172, 1163, 1162, 1162, 1171, 1172, 1173, 1164, 1163, 1163, 1172, 1173, 1174, 1165, 1164, 1164, 1173, 1174, 1175, 1166, 1165, 1165, 1174, 1175,
+1176, 1167, 1166, 1166, 1175, 1176, 863, 852, 1167, 1167, 1176, 863, 1177, 1168, 1079, 1079, 1089, 1177, 1178, 1169, 1168, 1168, 1177, 1178,
+1179, 1170, 1169, 1169, 1178, 1179, 1180, 1171, 1170, 1170, 1179, 1180, 1181, 1172, 1171, 1171, 1180, 1181, 1182, 1173, 1172, 1172, 1181, 1182,
+1183, 1174, 1173, 1173, 1182, 1183, 1184, 1175, 1174, 1174, 1183, 1184, 1185, 1176, 1175, 1175, 1184, 1185, 874, 863, 1176, 1176, 1185, 874,
+1186, 1177, 1089, 1089, 1099, 1186, 1187, 1178, 1177, 1177, 1186, 1187, 1188, 1179, 1178, 1178, 1187, 1188, 1189, 1180, 1179, 1179, 1188, 1189,
+1190, 1181, 1180, 1180, 1189, 1190, 1191, 1182, 1181, 1181, 1190, 1191, 1192, 1183, 1182, 1182, 1191, 1192, 1193, 1184, 1183, 1183, 1192, 1193,
+1194, 1185, 1184, 1184, 1193, 1194, 885, 874, 1185, 1185, 1194, 885, 1195, 1186, 1099, 1099, 1109, 1195, 1196, 1187, 1186, 1186, 1195, 1196,
+1197, 1188, 1187, 1187, 1196, 1197, 1198, 1189, 1188, 1188, 1197, 1198, 1199, 1190, 1189, 1189, 1198, 1199, 1200, 1191, 1190, 1190, 1199, 1200,
+1201, 1192, 1191, 1191, 1200, 1201, 1202, 1193, 1192, 1192, 1201, 1202, 1203, 1194, 1193, 1193, 1202, 1203, 896, 885, 1194, 1194, 1203, 896,
+1204, 1195, 1109, 1109, 1119, 1204, 1205, 1196, 1195, 1195, 1204, 1205, 1206, 1197, 1196, 1196, 1205, 1206, 1207, 1198, 1197, 1197, 1206, 1207,
+1208, 1199, 1198, 1198, 1207, 1208, 1209, 1200, 1199, 1199, 1208, 1209, 1210, 1201, 1200, 1200, 1209, 1210, 1211, 1202, 1201, 1201, 1210, 1211,
+1212, 1203, 1202, 1202, 1211, 1212, 907, 896, 1203, 1203, 1212, 907, 1213, 1204, 1119, 1119, 1129, 1213, 1214, 1205, 1204, 1204, 1213, 1214,
+1215, 1206, 1205, 1205, 1214, 1215, 1216, 1207, 1206, 1206, 1215, 1216, 1217, 1208, 1207, 1207, 1216, 1217, 1218, 1209, 1208, 1208, 1217, 1218,
+1219, 1210, 1209, 1209, 1218, 1219, 1220, 1211, 1210, 1210, 1219, 1220, 1221, 1212, 1211, 1211, 1220, 1221, 918, 907, 1212, 1212, 1221, 918,
+1222, 1213, 1129, 1129, 1139, 1222, 1223, 1214, 1213, 1213, 1222, 1223, 1224, 1215, 1214, 1214, 1223, 1224, 1225, 1216, 1215, 1215, 1224, 1225,
+1226, 1217, 1216, 1216, 1225, 1226, 1227, 1218, 1217, 1217, 1226, 1227, 1228, 1219, 1218, 1218, 1227, 1228, 1229, 1220, 1219, 1219, 1228, 1229,
+1230, 1221, 1220, 1220, 1229, 1230, 929, 918, 1221, 1221, 1230, 929, 1231, 1222, 1139, 1139, 1149, 1231, 1232, 1223, 1222, 1222, 1231, 1232,
+1233, 1224, 1223, 1223, 1232, 1233, 1234, 1225, 1224, 1224, 1233, 1234, 1235, 1226, 1225, 1225, 1234, 1235, 1236, 1227, 1226, 1226, 1235, 1236,
+1237, 1228, 1227, 1227, 1236, 1237, 1238, 1229, 1228, 1228, 1237, 1238, 1239, 1230, 1229, 1229, 1238, 1239, 940, 929, 1230, 1230, 1239, 940,
+1240, 1241, 1242, 1242, 1243, 1240, 1244, 1245, 1241, 1241, 1240, 1244, 1246, 1247, 1245, 1245, 1244, 1246, 1248, 1249, 1247, 1247, 1246, 1248,
+1250, 1251, 1249, 1249, 1248, 1250, 1252, 1253, 1251, 1251, 1250, 1252, 1254, 1255, 1253, 1253, 1252, 1254, 1256, 1257, 1255, 1255, 1254, 1256,
+1258, 1259, 1257, 1257, 1256, 1258, 1260, 1261, 1259, 1259, 1258, 1260, 1262, 1240, 1243, 1243, 1263, 1262, 1264, 1244, 1240, 1240, 1262, 1264,
+1265, 1246, 1244, 1244, 1264, 1265, 1266, 1248, 1246, 1246, 1265, 1266, 1267, 1250, 1248, 1248, 1266, 1267, 1268, 1252, 1250, 1250, 1267, 1268,
+1269, 1254, 1252, 1252, 1268, 1269, 1270, 1256, 1254, 1254, 1269, 1270, 1271, 1258, 1256, 1256, 1270, 1271, 1272, 1260, 1258, 1258, 1271, 1272,
+1273, 1262, 1263, 1263, 1274, 1273, 1275, 1264, 1262, 1262, 1273, 1275, 1276, 1265, 1264, 1264, 1275, 1276, 1277, 1266, 1265, 1265, 1276, 1277,
+1278, 1267, 1266, 1266, 1277, 1278, 1279, 1268, 1267, 1267, 1278, 1279, 1280, 1269, 1268, 1268, 1279, 1280, 1281, 1270, 1269, 1269, 1280, 1281,
+1282, 1271, 1270, 1270, 1281, 1282, 1283, 1272, 1271, 1271, 1282, 1283, 1284, 1273, 1274, 1274, 1285, 1284, 1286, 1275, 1273, 1273, 1284, 1286,
+1287, 1276, 1275, 1275, 1286, 1287, 1288, 1277, 1276, 1276, 1287, 1288, 1289, 1278, 1277, 1277, 1288, 1289, 1290, 1279, 1278, 1278, 1289, 1290,
+1291, 1280, 1279, 1279, 1290, 1291, 1292, 1281, 1280, 1280, 1291, 1292, 1293, 1282, 1281, 1281, 1292, 1293, 1294, 1283, 1282, 1282, 1293, 1294,
+1295, 1284, 1285, 1285, 1296, 1295, 1297, 1286, 1284, 1284, 1295, 1297, 1298, 1287, 1286, 1286, 1297, 1298, 1299, 1288, 1287, 1287, 1298, 1299,
+1300, 1289, 1288, 1288, 1299, 1300, 1301, 1290, 1289, 1289, 1300, 1301, 1302, 1291, 1290, 1290, 1301, 1302, 1303, 1292, 1291, 1291, 1302, 1303,
+1304, 1293, 1292, 1292, 1303, 1304, 1305, 1294, 1293, 1293, 1304, 1305, 1306, 1295, 1296, 1296, 1307, 1306, 1308, 1297, 1295, 1295, 1306, 1308,
+1309, 1298, 1297, 1297, 1308, 1309, 1310, 1299, 1298, 1298, 1309, 1310, 1311, 1300, 1299, 1299, 1310, 1311, 1312, 1301, 1300, 1300, 1311, 1312,
+1313, 1302, 1301, 1301, 1312, 1313, 1314, 1303, 1302, 1302, 1313, 1314, 1315, 1304, 1303, 1303, 1314, 1315, 1316, 1305, 1304, 1304, 1315, 1316,
+1317, 1306, 1307, 1307, 1318, 1317, 1319, 1308, 1306, 1306, 1317, 1319, 1320, 1309, 1308, 1308, 1319, 1320, 1321, 1310, 1309, 1309, 1320, 1321,
+1322, 1311, 1310, 1310, 1321, 1322, 1323, 1312, 1311, 1311, 1322, 1323, 1324, 1313, 1312, 1312, 1323, 1324, 1325, 1314, 1313, 1313, 1324, 1325,
+1326, 1315, 1314, 1314, 1325, 1326, 1327, 1316, 1315, 1315, 1326, 1327, 1328, 1317, 1318, 1318, 1329, 1328, 1330, 1319, 1317, 1317, 1328, 1330,
+1331, 1320, 1319, 1319, 1330, 1331, 1332, 1321, 1320, 1320, 1331, 1332, 1333, 1322, 1321, 1321, 1332, 1333, 1334, 1323, 1322, 1322, 1333, 1334,
+1335, 1324, 1323, 1323, 1334, 1335, 1336, 1325, 1324, 1324, 1335, 1336, 1337, 1326, 1325, 1325, 1336, 1337, 1338, 1327, 1326, 1326, 1337, 1338,
+1339, 1328, 1329, 1329, 1340, 1339, 1341, 1330, 1328, 1328, 1339, 1341, 1342, 1331, 1330, 1330, 1341, 1342, 1343, 1332, 1331, 1331, 1342, 1343,
+1344, 1333, 1332, 1332, 1343, 1344, 1345, 1334, 1333, 1333, 1344, 1345, 1346, 1335, 1334, 1334, 1345, 1346, 1347, 1336, 1335, 1335, 1346, 1347,
+1348, 1337, 1336, 1336, 1347, 1348, 1349, 1338, 1337, 1337, 1348, 1349, 1350, 1339, 1340, 1340, 1351, 1350, 1352, 1341, 1339, 1339, 1350, 1352,
+1353, 1342, 1341, 1341, 1352, 1353, 1354, 1343, 1342, 1342, 1353, 1354, 1355, 1344, 1343, 1343, 1354, 1355, 1356, 1345, 1344, 1344, 1355, 1356,
+1357, 1346, 1345, 1345, 1356, 1357, 1358, 1347, 1346, 1346, 1357, 1358, 1359, 1348, 1347, 1347, 1358, 1359, 1360, 1349, 1348, 1348, 1359, 1360,
+1361, 1362, 1261, 1261, 1260, 1361, 1363, 1364, 1362, 1362, 1361, 1363, 1365, 1366, 1364, 1364, 1363, 1365, 1367, 1368, 1366, 1366, 1365, 1367,
+1369, 1370, 1368, 1368, 1367, 1369, 1371, 1372, 1370, 1370, 1369, 1371, 1373, 1374, 1372, 1372, 1371, 1373, 1375, 1376, 1374, 1374, 1373, 1375,
+1377, 1378, 1376, 1376, 1375, 1377, 1243, 1242, 1378, 1378, 1377, 1243, 1379, 1361, 1260, 1260, 1272, 1379, 1380, 1363, 1361, 1361, 1379, 1380,
+1381, 1365, 1363, 1363, 1380, 1381, 1382, 1367, 1365, 1365, 1381, 1382, 1383, 1369, 1367, 1367, 1382, 1383, 1384, 1371, 1369, 1369, 1383, 1384,
+1385, 1373, 1371, 1371, 1384, 1385, 1386, 1375, 1373, 1373, 1385, 1386, 1387, 1377, 1375, 1375, 1386, 1387, 1263, 1243, 1377, 1377, 1387, 1263,
+1388, 1379, 1272, 1272, 1283, 1388, 1389, 1380, 1379, 1379, 1388, 1389, 1390, 1381, 1380, 1380, 1389, 1390, 1391, 1382, 1381, 1381, 1390, 1391,
+1392, 1383, 1382, 1382, 1391, 1392, 1393, 1384, 1383, 1383, 1392, 1393, 1394, 1385, 1384, 1384, 1393, 1394, 1395, 1386, 1385, 1385, 1394, 1395,
+1396, 1387, 1386, 1386, 1395, 1396, 1274, 1263, 1387, 1387, 1396, 1274, 1397, 1388, 1283, 1283, 1294, 1397, 1398, 1389, 1388, 1388, 1397, 1398,
+1399, 1390, 1389, 1389, 1398, 1399, 1400, 1391, 1390, 1390, 1399, 1400, 1401, 1392, 1391, 1391, 1400, 1401, 1402, 1393, 1392, 1392, 1401, 1402,
+1403, 1394, 1393, 1393, 1402, 1403, 1404, 1395, 1394, 1394, 1403, 1404, 1405, 1396, 1395, 1395, 1404, 1405, 1285, 1274, 1396, 1396, 1405, 1285,
+1406, 1397, 1294, 1294, 1305, 1406, 1407, 1398, 1397, 1397, 1406, 1407, 1408, 1399, 1398, 1398, 1407, 1408, 1409, 1400, 1399, 1399, 1408, 1409,
+1410, 1401, 1400, 1400, 1409, 1410, 1411, 1402, 1401, 1401, 1410, 1411, 1412, 1403, 1402, 1402, 1411, 1412, 1413, 1404, 1403, 1403, 1412, 1413,
+1414, 1405, 1404, 1404, 1413, 1414, 1296, 1285, 1405, 1405, 1414, 1296, 1415, 1406, 1305, 1305, 1316, 1415, 1416, 1407, 1406, 1406, 1415, 1416,
+1417, 1408, 1407, 1407, 1416, 1417, 1418, 1409, 1408, 1408, 1417, 1418, 1419, 1410, 1409, 1409, 1418, 1419, 1420, 1411, 1410, 1410, 1419, 1420,
+1421, 1412, 1411, 1411, 1420, 1421, 1422, 1413, 1412, 1412, 1421, 1422, 1423, 1414, 1413, 1413, 1422, 1423, 1307, 1296, 1414, 1414, 1423, 1307,
+1424, 1415, 1316, 1316, 1327, 1424, 1425, 1416, 1415, 1415, 1424, 1425, 1426, 1417, 1416, 1416, 1425, 1426, 1427, 1418, 1417, 1417, 1426, 1427,
+1428, 1419, 1418, 1418, 1427, 1428, 1429, 1420, 1419, 1419, 1428, 1429, 1430, 1421, 1420, 1420, 1429, 1430, 1431, 1422, 1421, 1421, 1430, 1431,
+1432, 1423, 1422, 1422, 1431, 1432, 1318, 1307, 1423, 1423, 1432, 1318, 1433, 1424, 1327, 1327, 1338, 1433, 1434, 1425, 1424, 1424, 1433, 1434,
+1435, 1426, 1425, 1425, 1434, 1435, 1436, 1427, 1426, 1426, 1435, 1436, 1437, 1428, 1427, 1427, 1436, 1437, 1438, 1429, 1428, 1428, 1437, 1438,
+1439, 1430, 1429, 1429, 1438, 1439, 1440, 1431, 1430, 1430, 1439, 1440, 1441, 1432, 1431, 1431, 1440, 1441, 1329, 1318, 1432, 1432, 1441, 1329,
+1442, 1433, 1338, 1338, 1349, 1442, 1443, 1434, 1433, 1433, 1442, 1443, 1444, 1435, 1434, 1434, 1443, 1444, 1445, 1436, 1435, 1435, 1444, 1445,
+1446, 1437, 1436, 1436, 1445, 1446, 1447, 1438, 1437, 1437, 1446, 1447, 1448, 1439, 1438, 1438, 1447, 1448, 1449, 1440, 1439, 1439, 1448, 1449,
+1450, 1441, 1440, 1440, 1449, 1450, 1340, 1329, 1441, 1441, 1450, 1340, 1451, 1442, 1349, 1349, 1360, 1451, 1452, 1443, 1442, 1442, 1451, 1452,
+1453, 1444, 1443, 1443, 1452, 1453, 1454, 1445, 1444, 1444, 1453, 1454, 1455, 1446, 1445, 1445, 1454, 1455, 1456, 1447, 1446, 1446, 1455, 1456,
+1457, 1448, 1447, 1447, 1456, 1457, 1458, 1449, 1448, 1448, 1457, 1458, 1459, 1450, 1449, 1449, 1458, 1459, 1351, 1340, 1450, 1450, 1459, 1351,
+1460, 1350, 1351, 1351, 1461, 1460, 1462, 1352, 1350, 1350, 1460, 1462, 1463, 1353, 1352, 1352, 1462, 1463, 1464, 1354, 1353, 1353, 1463, 1464,
+1465, 1355, 1354, 1354, 1464, 1465, 1466, 1356, 1355, 1355, 1465, 1466, 1467, 1357, 1356, 1356, 1466, 1467, 1468, 1358, 1357, 1357, 1467, 1468,
+1469, 1359, 1358, 1358, 1468, 1469, 1470, 1360, 1359, 1359, 1469, 1470, 1471, 1460, 1461, 1461, 1472, 1471, 1473, 1462, 1460, 1460, 1471, 1473,
+1474, 1463, 1462, 1462, 1473, 1474, 1475, 1464, 1463, 1463, 1474, 1475, 1476, 1465, 1464, 1464, 1475, 1476, 1477, 1466, 1465, 1465, 1476, 1477,
+1478, 1467, 1466, 1466, 1477, 1478, 1479, 1468, 1467, 1467, 1478, 1479, 1480, 1469, 1468, 1468, 1479, 1480, 1481, 1470, 1469, 1469, 1480, 1481,
+1482, 1471, 1472, 1472, 1483, 1482, 1484, 1473, 1471, 1471, 1482, 1484, 1485, 1474, 1473, 1473, 1484, 1485, 1486, 1475, 1474, 1474, 1485, 1486,
+1487, 1476, 1475, 1475, 1486, 1487, 1488, 1477, 1476, 1476, 1487, 1488, 1489, 1478, 1477, 1477, 1488, 1489, 1490, 1479, 1478, 1478, 1489, 1490,
+1491, 1480, 1479, 1479, 1490, 1491, 1492, 1481, 1480, 1480, 1491, 1492, 1493, 1482, 1483, 1483, 1494, 1493, 1495, 1484, 1482, 1482, 1493, 1495,
+1496, 1485, 1484, 1484, 1495, 1496, 1497, 1486, 1485, 1485, 1496, 1497, 1498, 1487, 1486, 1486, 1497, 1498, 1499, 1488, 1487, 1487, 1498, 1499,
+1500, 1489, 1488, 1488, 1499, 1500, 1501, 1490, 1489, 1489, 1500, 1501, 1502, 1491, 1490, 1490, 1501, 1502, 1503, 1492, 1491, 1491, 1502, 1503,
+1504, 1493, 1494, 1494, 1505, 1504, 1506, 1495, 1493, 1493, 1504, 1506, 1507, 1496, 1495, 1495, 1506, 1507, 1508, 1497, 1496, 1496, 1507, 1508,
+1509, 1498, 1497, 1497, 1508, 1509, 1510, 1499, 1498, 1498, 1509, 1510, 1511, 1500, 1499, 1499, 1510, 1511, 1512, 1501, 1500, 1500, 1511, 1512,
+1513, 1502, 1501, 1501, 1512, 1513, 1514, 1503, 1502, 1502, 1513, 1514, 1515, 1504, 1505, 1505, 1516, 1515, 1517, 1506, 1504, 1504, 1515, 1517,
+1518, 1507, 1506, 1506, 1517, 1518, 1519, 1508, 1507, 1507, 1518, 1519, 1520, 1509, 1508, 1508, 1519, 1520, 1521, 1510, 1509, 1509, 1520, 1521,
+1522, 1511, 1510, 1510, 1521, 1522, 1523, 1512, 1511, 1511, 1522, 1523, 1524, 1513, 1512, 1512, 1523, 1524, 1525, 1514, 1513, 1513, 1524, 1525,
+1526, 1515, 1516, 1516, 1527, 1526, 1528, 1517, 1515, 1515, 1526, 1528, 1529, 1518, 1517, 1517, 1528, 1529, 1530, 1519, 1518, 1518, 1529, 1530,
+1531, 1520, 1519, 1519, 1530, 1531, 1532, 1521, 1520, 1520, 1531, 1532, 1533, 1522, 1521, 1521, 1532, 1533, 1534, 1523, 1522, 1522, 1533, 1534,
+1535, 1524, 1523, 1523, 1534, 1535, 1536, 1525, 1524, 1524, 1535, 1536, 1537, 1526, 1527, 1527, 1538, 1537, 1539, 1528, 1526, 1526, 1537, 1539,
+1540, 1529, 1528, 1528, 1539, 1540, 1541, 1530, 1529, 1529, 1540, 1541, 1542, 1531, 1530, 1530, 1541, 1542, 1543, 1532, 1531, 1531, 1542, 1543,
+1544, 1533, 1532, 1532, 1543, 1544, 1545, 1534, 1533, 1533, 1544, 1545, 1546, 1535, 1534, 1534, 1545, 1546, 1547, 1536, 1535, 1535, 1546, 1547,
+1548, 1537, 1538, 1538, 1549, 1548, 1550, 1539, 1537, 1537, 1548, 1550, 1551, 1540, 1539, 1539, 1550, 1551, 1552, 1541, 1540, 1540, 1551, 1552,
+1553, 1542, 1541, 1541, 1552, 1553, 1554, 1543, 1542, 1542, 1553, 1554, 1555, 1544, 1543, 1543, 1554, 1555, 1556, 1545, 1544, 1544, 1555, 1556,
+1557, 1546, 1545, 1545, 1556, 1557, 1558, 1547, 1546, 1546, 1557, 1558, 1559, 1548, 1549, 1549, 649, 1559, 1560, 1550, 1548, 1548, 1559, 1560,
+1561, 1551, 1550, 1550, 1560, 1561, 1562, 1552, 1551, 1551, 1561, 1562, 1563, 1553, 1552, 1552, 1562, 1563, 1564, 1554, 1553, 1553, 1563, 1564,
+1565, 1555, 1554, 1554, 1564, 1565, 1566, 1556, 1555, 1555, 1565, 1566, 1567, 1557, 1556, 1556, 1566, 1567, 1568, 1558, 1557, 1557, 1567, 1568,
+1569, 1451, 1360, 1360, 1470, 1569, 1570, 1452, 1451, 1451, 1569, 1570, 1571, 1453, 1452, 1452, 1570, 1571, 1572, 1454, 1453, 1453, 1571, 1572,
+1573, 1455, 1454, 1454, 1572, 1573, 1574, 1456, 1455, 1455, 1573, 1574, 1575, 1457, 1456, 1456, 1574, 1575, 1576, 1458, 1457, 1457, 1575, 1576,
+1577, 1459, 1458, 1458, 1576, 1577, 1461, 1351, 1459, 1459, 1577, 1461, 1578, 1569, 1470, 1470, 1481, 1578, 1579, 1570, 1569, 1569, 1578, 1579,
+1580, 1571, 1570, 1570, 1579, 1580, 1581, 1572, 1571, 1571, 1580, 1581, 1582, 1573, 1572, 1572, 1581, 1582, 1583, 1574, 1573, 1573, 1582, 1583,
+1584, 1575, 1574, 1574, 1583, 1584, 1585, 1576, 1575, 1575, 1584, 1585, 1586, 1577, 1576, 1576, 1585, 1586, 1472, 1461, 1577, 1577, 1586, 1472,
+1587, 1578, 1481, 1481, 1492, 1587, 1588, 1579, 1578, 1578, 1587, 1588, 1589, 1580, 1579, 1579, 1588, 1589, 1590, 1581, 1580, 1580, 1589, 1590,
+1591, 1582, 1581, 1581, 1590, 1591, 1592, 1583, 1582, 1582, 1591, 1592, 1593, 1584, 1583, 1583, 1592, 1593, 1594, 1585, 1584, 1584, 1593, 1594,
+1595, 1586, 1585, 1585, 1594, 1595, 1483, 1472, 1586, 1586, 1595, 1483, 1596, 1587, 1492, 1492, 1503, 1596, 1597, 1588, 1587, 1587, 1596, 1597,
+1598, 1589, 1588, 1588, 1597, 1598, 1599, 1590, 1589, 1589, 1598, 1599, 1600, 1591, 1590, 1590, 1599, 1600, 1601, 1592, 1591, 1591, 1600, 1601,
+1602, 1593, 1592, 1592, 1601, 1602, 1603, 1594, 1593, 1593, 1602, 1603, 1604, 1595, 1594, 1594, 1603, 1604, 1494, 1483, 1595, 1595, 1604, 1494,
+1605, 1596, 1503, 1503, 1514, 1605, 1606, 1597, 1596, 1596, 1605, 1606, 1607, 1598, 1597, 1597, 1606, 1607, 1608, 1599, 1598, 1598, 1607, 1608,
+1609, 1600, 1599, 1599, 1608, 1609, 1610, 1601, 1600, 1600, 1609, 1610, 1611, 1602, 1601, 1601, 1610, 1611, 1612, 1603, 1602, 1602, 1611, 1612,
+1613, 1604, 1603, 1603, 1612, 1613, 1505, 1494, 1604, 1604, 1613, 1505, 1614, 1605, 1514, 1514, 1525, 1614, 1615, 1606, 1605, 1605, 1614, 1615,
+1616, 1607, 1606, 1606, 1615, 1616, 1617, 1608, 1607, 1607, 1616, 1617, 1618, 1609, 1608, 1608, 1617, 1618, 1619, 1610, 1609, 1609, 1618, 1619,
+1620, 1611, 1610, 1610, 1619, 1620, 1621, 1612, 1611, 1611, 1620, 1621, 1622, 1613, 1612, 1612, 1621, 1622, 1516, 1505, 1613, 1613, 1622, 1516,
+1623, 1614, 1525, 1525, 1536, 1623, 1624, 1615, 1614, 1614, 1623, 1624, 1625, 1616, 1615, 1615, 1624, 1625, 1626, 1617, 1616, 1616, 1625, 1626,
+1627, 1618, 1617, 1617, 1626, 1627, 1628, 1619, 1618, 1618, 1627, 1628, 1629, 1620, 1619, 1619, 1628, 1629, 1630, 1621, 1620, 1620, 1629, 1630,
+1631, 1622, 1621, 1621, 1630, 1631, 1527, 1516, 1622, 1622, 1631, 1527, 1632, 1623, 1536, 1536, 1547, 1632, 1633, 1624, 1623, 1623, 1632, 1633,
+1634, 1625, 1624, 1624, 1633, 1634, 1635, 1626, 1625, 1625, 1634, 1635, 1636, 1627, 1626, 1626, 1635, 1636, 1637, 1628, 1627, 1627, 1636, 1637,
+1638, 1629, 1628, 1628, 1637, 1638, 1639, 1630, 1629, 1629, 1638, 1639, 1640, 1631, 1630, 1630, 1639, 1640, 1538, 1527, 1631, 1631, 1640, 1538,
+1641, 1632, 1547, 1547, 1558, 1641, 1642, 1633, 1632, 1632, 1641, 1642, 1643, 1634, 1633, 1633, 1642, 1643, 1644, 1635, 1634, 1634, 1643, 1644,
+1645, 1636, 1635, 1635, 1644, 1645, 1646, 1637, 1636, 1636, 1645, 1646, 1647, 1638, 1637, 1637, 1646, 1647, 1648, 1639, 1638, 1638, 1647, 1648,
+1649, 1640, 1639, 1639, 1648, 1649, 1549, 1538, 1640, 1640, 1649, 1549, 1650, 1641, 1558, 1558, 1568, 1650, 1651, 1642, 1641, 1641, 1650, 1651,
+1652, 1643, 1642, 1642, 1651, 1652, 1653, 1644, 1643, 1643, 1652, 1653, 1654, 1645, 1644, 1644, 1653, 1654, 1655, 1646, 1645, 1645, 1654, 1655,
+1656, 1647, 1646, 1646, 1655, 1656, 1657, 1648, 1647, 1647, 1656, 1657, 1658, 1649, 1648, 1648, 1657, 1658, 649, 1549, 1649, 1649, 1658, 649,
+1659, 1660, 1661, 1661, 1662, 1659, 1663, 1664, 1660, 1660, 1659, 1663, 1665, 1666, 1664, 1664, 1663, 1665, 1667, 1668, 1666, 1666, 1665, 1667,
+1669, 1670, 1668, 1668, 1667, 1669, 1671, 1672, 1670, 1670, 1669, 1671, 1673, 1674, 1672, 1672, 1671, 1673, 1675, 1676, 1674, 1674, 1673, 1675,
+1677, 1678, 1676, 1676, 1675, 1677, 1679, 1680, 1678, 1678, 1677, 1679, 1681, 1659, 1662, 1662, 1682, 1681, 1683, 1663, 1659, 1659, 1681, 1683,
+1684, 1665, 1663, 1663, 1683, 1684, 1685, 1667, 1665, 1665, 1684, 1685, 1686, 1669, 1667, 1667, 1685, 1686, 1687, 1671, 1669, 1669, 1686, 1687,
+1688, 1673, 1671, 1671, 1687, 1688, 1689, 1675, 1673, 1673, 1688, 1689, 1690, 1677, 1675, 1675, 1689, 1690, 1691, 1679, 1677, 1677, 1690, 1691,
+1692, 1681, 1682, 1682, 1693, 1692, 1694, 1683, 1681, 1681, 1692, 1694, 1695, 1684, 1683, 1683, 1694, 1695, 1696, 1685, 1684, 1684, 1695, 1696,
+1697, 1686, 1685, 1685, 1696, 1697, 1698, 1687, 1686, 1686, 1697, 1698, 1699, 1688, 1687, 1687, 1698, 1699, 1700, 1689, 1688, 1688, 1699, 1700,
+1701, 1690, 1689, 1689, 1700, 1701, 1702, 1691, 1690, 1690, 1701, 1702, 1703, 1692, 1693, 1693, 1704, 1703, 1705, 1694, 1692, 1692, 1703, 1705,
+1706, 1695, 1694, 1694, 1705, 1706, 1707, 1696, 1695, 1695, 1706, 1707, 1708, 1697, 1696, 1696, 1707, 1708, 1709, 1698, 1697, 1697, 1708, 1709,
+1710, 1699, 1698, 1698, 1709, 1710, 1711, 1700, 1699, 1699, 1710, 1711, 1712, 1701, 1700, 1700, 1711, 1712, 1713, 1702, 1701, 1701, 1712, 1713,
+1714, 1703, 1704, 1704, 1715, 1714, 1716, 1705, 1703, 1703, 1714, 1716, 1717, 1706, 1705, 1705, 1716, 1717, 1718, 1707, 1706, 1706, 1717, 1718,
+1719, 1708, 1707, 1707, 1718, 1719, 1720, 1709, 1708, 1708, 1719, 1720, 1721, 1710, 1709, 1709, 1720, 1721, 1722, 1711, 1710, 1710, 1721, 1722,
+1723, 1712, 1711, 1711, 1722, 1723, 1724, 1713, 1712, 1712, 1723, 1724, 1725, 1714, 1715, 1715, 1726, 1725, 1727, 1716, 1714, 1714, 1725, 1727,
+1728, 1717, 1716, 1716, 1727, 1728, 1729, 1718, 1717, 1717, 1728, 1729, 1730, 1719, 1718, 1718, 1729, 1730, 1731, 1720, 1719, 1719, 1730, 1731,
+1732, 1721, 1720, 1720, 1731, 1732, 1733, 1722, 1721, 1721, 1732, 1733, 1734, 1723, 1722, 1722, 1733, 1734, 1735, 1724, 1723, 1723, 1734, 1735,
+1736, 1725, 1726, 1726, 1737, 1736, 1738, 1727, 1725, 1725, 1736, 1738, 1739, 1728, 1727, 1727, 1738, 1739, 1740, 1729, 1728, 1728, 1739, 1740,
+1741, 1730, 1729, 1729, 1740, 1741, 1742, 1731, 1730, 1730, 1741, 1742, 1743, 1732, 1731, 1731, 1742, 1743, 1744, 1733, 1732, 1732, 1743, 1744,
+1745, 1734, 1733, 1733, 1744, 1745, 1746, 1735, 1734, 1734, 1745, 1746, 1747, 1736, 1737, 1737, 1748, 1747, 1749, 1738, 1736, 1736, 1747, 1749,
+1750, 1739, 1738, 1738, 1749, 1750, 1751, 1740, 1739, 1739, 1750, 1751, 1752, 1741, 1740, 1740, 1751, 1752, 1753, 1742, 1741, 1741, 1752, 1753,
+1754, 1743, 1742, 1742, 1753, 1754, 1755, 1744, 1743, 1743, 1754, 1755, 1756, 1745, 1744, 1744, 1755, 1756, 1757, 1746, 1745, 1745, 1756, 1757,
+1758, 1747, 1748, 1748, 1759, 1758, 1760, 1749, 1747, 1747, 1758, 1760, 1761, 1750, 1749, 1749, 1760, 1761, 1762, 1751, 1750, 1750, 1761, 1762,
+1763, 1752, 1751, 1751, 1762, 1763, 1764, 1753, 1752, 1752, 1763, 1764, 1765, 1754, 1753, 1753, 1764, 1765, 1766, 1755, 1754, 1754, 1765, 1766,
+1767, 1756, 1755, 1755, 1766, 1767, 1768, 1757, 1756, 1756, 1767, 1768, 1769, 1758, 1759, 1759, 1770, 1769, 1771, 1760, 1758, 1758, 1769, 1771,
+1772, 1761, 1760, 1760, 1771, 1772, 1773, 1762, 1761, 1761, 1772, 1773, 1774, 1763, 1762, 1762, 1773, 1774, 1775, 1764, 1763, 1763, 1774, 1775,
+1776, 1765, 1764, 1764, 1775, 1776, 1777, 1766, 1765, 1765, 1776, 1777, 1778, 1767, 1766, 1766, 1777, 1778, 1779, 1768, 1767, 1767, 1778, 1779,
+1780, 1781, 1680, 1680, 1679, 1780, 1782, 1783, 1781, 1781, 1780, 1782, 1784, 1785, 1783, 1783, 1782, 1784, 1786, 1787, 1785, 1785, 1784, 1786,
+1788, 1789, 1787, 1787, 1786, 1788, 1790, 1791, 1789, 1789, 1788, 1790, 1792, 1793, 1791, 1791, 1790, 1792, 1794, 1795, 1793, 1793, 1792, 1794,
+1796, 1797, 1795, 1795, 1794, 1796, 1662, 1661, 1797, 1797, 1796, 1662, 1798, 1780, 1679, 1679, 1691, 1798, 1799, 1782, 1780, 1780, 1798, 1799,
+1800, 1784, 1782, 1782, 1799, 1800, 1801, 1786, 1784, 1784, 1800, 1801, 1802, 1788, 1786, 1786, 1801, 1802, 1803, 1790, 1788, 1788, 1802, 1803,
+1804, 1792, 1790, 1790, 1803, 1804, 1805, 1794, 1792, 1792, 1804, 1805, 1806, 1796, 1794, 1794, 1805, 1806, 1682, 1662, 1796, 1796, 1806, 1682,
+1807, 1798, 1691, 1691, 1702, 1807, 1808, 1799, 1798, 1798, 1807, 1808, 1809, 1800, 1799, 1799, 1808, 1809, 1810, 1801, 1800, 1800, 1809, 1810,
+1811, 1802, 1801, 1801, 1810, 1811, 1812, 1803, 1802, 1802, 1811, 1812, 1813, 1804, 1803, 1803, 1812, 1813, 1814, 1805, 1804, 1804, 1813, 1814,
+1815, 1806, 1805, 1805, 1814, 1815, 1693, 1682, 1806, 1806, 1815, 1693, 1816, 1807, 1702, 1702, 1713, 1816, 1817, 1808, 1807, 1807, 1816, 1817,
+1818, 1809, 1808, 1808, 1817, 1818, 1819, 1810, 1809, 1809, 1818, 1819, 1820, 1811, 1810, 1810, 1819, 1820, 1821, 1812, 1811, 1811, 1820, 1821,
+1822, 1813, 1812, 1812, 1821, 1822, 1823, 1814, 1813, 1813, 1822, 1823, 1824, 1815, 1814, 1814, 1823, 1824, 1704, 1693, 1815, 1815, 1824, 1704,
+1825, 1816, 1713, 1713, 1724, 1825, 1826, 1817, 1816, 1816, 1825, 1826, 1827, 1818, 1817, 1817, 1826, 1827, 1828, 1819, 1818, 1818, 1827, 1828,
+1829, 1820, 1819, 1819, 1828, 1829, 1830, 1821, 1820, 1820, 1829, 1830, 1831, 1822, 1821, 1821, 1830, 1831, 1832, 1823, 1822, 1822, 1831, 1832,
+1833, 1824, 1823, 1823, 1832, 1833, 1715, 1704, 1824, 1824, 1833, 1715, 1834, 1825, 1724, 1724, 1735, 1834, 1835, 1826, 1825, 1825, 1834, 1835,
+1836, 1827, 1826, 1826, 1835, 1836, 1837, 1828, 1827, 1827, 1836, 1837, 1838, 1829, 1828, 1828, 1837, 1838, 1839, 1830, 1829, 1829, 1838, 1839,
+1840, 1831, 1830, 1830, 1839, 1840, 1841, 1832, 1831, 1831, 1840, 1841, 1842, 1833, 1832, 1832, 1841, 1842, 1726, 1715, 1833, 1833, 1842, 1726,
+1843, 1834, 1735, 1735, 1746, 1843, 1844, 1835, 1834, 1834, 1843, 1844, 1845, 1836, 1835, 1835, 1844, 1845, 1846, 1837, 1836, 1836, 1845, 1846,
+1847, 1838, 1837, 1837, 1846, 1847, 1848, 1839, 1838, 1838, 1847, 1848, 1849, 1840, 1839, 1839, 1848, 1849, 1850, 1841, 1840, 1840, 1849, 1850,
+1851, 1842, 1841, 1841, 1850, 1851, 1737, 1726, 1842, 1842, 1851, 1737, 1852, 1843, 1746, 1746, 1757, 1852, 1853, 1844, 1843, 1843, 1852, 1853,
+1854, 1845, 1844, 1844, 1853, 1854, 1855, 1846, 1845, 1845, 1854, 1855, 1856, 1847, 1846, 1846, 1855, 1856, 1857, 1848, 1847, 1847, 1856, 1857,
+1858, 1849, 1848, 1848, 1857, 1858, 1859, 1850, 1849, 1849, 1858, 1859, 1860, 1851, 1850, 1850, 1859, 1860, 1748, 1737, 1851, 1851, 1860, 1748,
+1861, 1852, 1757, 1757, 1768, 1861, 1862, 1853, 1852, 1852, 1861, 1862, 1863, 1854, 1853, 1853, 1862, 1863, 1864, 1855, 1854, 1854, 1863, 1864,
+1865, 1856, 1855, 1855, 1864, 1865, 1866, 1857, 1856, 1856, 1865, 1866, 1867, 1858, 1857, 1857, 1866, 1867, 1868, 1859, 1858, 1858, 1867, 1868,
+1869, 1860, 1859, 1859, 1868, 1869, 1759, 1748, 1860, 1860, 1869, 1759, 1870, 1861, 1768, 1768, 1779, 1870, 1871, 1862, 1861, 1861, 1870, 1871,
+1872, 1863, 1862, 1862, 1871, 1872, 1873, 1864, 1863, 1863, 1872, 1873, 1874, 1865, 1864, 1864, 1873, 1874, 1875, 1866, 1865, 1865, 1874, 1875,
+1876, 1867, 1866, 1866, 1875, 1876, 1877, 1868, 1867, 1867, 1876, 1877, 1878, 1869, 1868, 1868, 1877, 1878, 1770, 1759, 1869, 1869, 1878, 1770,
+1879, 1769, 1770, 1770, 1880, 1879, 1881, 1771, 1769, 1769, 1879, 1881, 1882, 1772, 1771, 1771, 1881, 1882, 1883, 1773, 1772, 1772, 1882, 1883,
+1884, 1774, 1773, 1773, 1883, 1884, 1885, 1775, 1774, 1774, 1884, 1885, 1886, 1776, 1775, 1775, 1885, 1886, 1887, 1777, 1776, 1776, 1886, 1887,
+1888, 1778, 1777, 1777, 1887, 1888, 1889, 1779, 1778, 1778, 1888, 1889, 1890, 1879, 1880, 1880, 1891, 1890, 1892, 1881, 1879, 1879, 1890, 1892,
+1893, 1882, 1881, 1881, 1892, 1893, 1894, 1883, 1882, 1882, 1893, 1894, 1895, 1884, 1883, 1883, 1894, 1895, 1896, 1885, 1884, 1884, 1895, 1896,
+1897, 1886, 1885, 1885, 1896, 1897, 1898, 1887, 1886, 1886, 1897, 1898, 1899, 1888, 1887, 1887, 1898, 1899, 1900, 1889, 1888, 1888, 1899, 1900,
+1901, 1890, 1891, 1891, 1902, 1901, 1903, 1892, 1890, 1890, 1901, 1903, 1904, 1893, 1892, 1892, 1903, 1904, 1905, 1894, 1893, 1893, 1904, 1905,
+1906, 1895, 1894, 1894, 1905, 1906, 1907, 1896, 1895, 1895, 1906, 1907, 1908, 1897, 1896, 1896, 1907, 1908, 1909, 1898, 1897, 1897, 1908, 1909,
+1910, 1899, 1898, 1898, 1909, 1910, 1911, 1900, 1899, 1899, 1910, 1911, 1912, 1901, 1902, 1902, 1913, 1912, 1914, 1903, 1901, 1901, 1912, 1914,
+1915, 1904, 1903, 1903, 1914, 1915, 1916, 1905, 1904, 1904, 1915, 1916, 1917, 1906, 1905, 1905, 1916, 1917, 1918, 1907, 1906, 1906, 1917, 1918,
+1919, 1908, 1907, 1907, 1918, 1919, 1920, 1909, 1908, 1908, 1919, 1920, 1921, 1910, 1909, 1909, 1920, 1921, 1922, 1911, 1910, 1910, 1921, 1922,
+1923, 1912, 1913, 1913, 1924, 1923, 1925, 1914, 1912, 1912, 1923, 1925, 1926, 1915, 1914, 1914, 1925, 1926, 1927, 1916, 1915, 1915, 1926, 1927,
+1928, 1917, 1916, 1916, 1927, 1928, 1929, 1918, 1917, 1917, 1928, 1929, 1930, 1919, 1918, 1918, 1929, 1930, 1931, 1920, 1919, 1919, 1930, 1931,
+1932, 1921, 1920, 1920, 1931, 1932, 1933, 1922, 1921, 1921, 1932, 1933, 1934, 1923, 1924, 1924, 1935, 1934, 1936, 1925, 1923, 1923, 1934, 1936,
+1937, 1926, 1925, 1925, 1936, 1937, 1938, 1927, 1926, 1926, 1937, 1938, 1939, 1928, 1927, 1927, 1938, 1939, 1940, 1929, 1928, 1928, 1939, 1940,
+1941, 1930, 1929, 1929, 1940, 1941, 1942, 1931, 1930, 1930, 1941, 1942, 1943, 1932, 1931, 1931, 1942, 1943, 1944, 1933, 1932, 1932, 1943, 1944,
+1945, 1934, 1935, 1935, 1946, 1945, 1947, 1936, 1934, 1934, 1945, 1947, 1948, 1937, 1936, 1936, 1947, 1948, 1949, 1938, 1937, 1937, 1948, 1949,
+1950, 1939, 1938, 1938, 1949, 1950, 1951, 1940, 1939, 1939, 1950, 1951, 1952, 1941, 1940, 1940, 1951, 1952, 1953, 1942, 1941, 1941, 1952, 1953,
+1954, 1943, 1942, 1942, 1953, 1954, 1955, 1944, 1943, 1943, 1954, 1955, 1956, 1945, 1946, 1946, 1957, 1956, 1958, 1947, 1945, 1945, 1956, 1958,
+1959, 1948, 1947, 1947, 1958, 1959, 1960, 1949, 1948, 1948, 1959, 1960, 1961, 1950, 1949, 1949, 1960, 1961, 1962, 1951, 1950, 1950, 1961, 1962,
+1963, 1952, 1951, 1951, 1962, 1963, 1964, 1953, 1952, 1952, 1963, 1964, 1965, 1954, 1953, 1953, 1964, 1965, 1966, 1955, 1954, 1954, 1965, 1966,
+1967, 1956, 1957, 1957, 1968, 1967, 1969, 1958, 1956, 1956, 1967, 1969, 1970, 1959, 1958, 1958, 1969, 1970, 1971, 1960, 1959, 1959, 1970, 1971,
+1972, 1961, 1960, 1960, 1971, 1972, 1973, 1962, 1961, 1961, 1972, 1973, 1974, 1963, 1962, 1962, 1973, 1974, 1975, 1964, 1963, 1963, 1974, 1975,
+1976, 1965, 1964, 1964, 1975, 1976, 1977, 1966, 1965, 1965, 1976, 1977, 1978, 1967, 1968, 1968, 1979, 1978, 1980, 1969, 1967, 1967, 1978, 1980,
+1981, 1970, 1969, 1969, 1980, 1981, 1982, 1971, 1970, 1970, 1981, 1982, 1983, 1972, 1971, 1971, 1982, 1983, 1984, 1973, 1972, 1972, 1983, 1984,
+1985, 1974, 1973, 1973, 1984, 1985, 1986, 1975, 1974, 1974, 1985, 1986, 1987, 1976, 1975, 1975, 1986, 1987, 1988, 1977, 1976, 1976, 1987, 1988,
+1989, 1870, 1779, 1779, 1889, 1989, 1990, 1871, 1870, 1870, 1989, 1990, 1991, 1872, 1871, 1871, 1990, 1991, 1992, 1873, 1872, 1872, 1991, 1992,
+1993, 1874, 1873, 1873, 1992, 1993, 1994, 1875, 1874, 1874, 1993, 1994, 1995, 1876, 1875, 1875, 1994, 1995, 1996, 1877, 1876, 1876, 1995, 1996,
+1997, 1878, 1877, 1877, 1996, 1997, 1880, 1770, 1878, 1878, 1997, 1880, 1998, 1989, 1889, 1889, 1900, 1998, 1999, 1990, 1989, 1989, 1998, 1999,
+2000, 1991, 1990, 1990, 1999, 2000, 2001, 1992, 1991, 1991, 2000, 2001, 2002, 1993, 1992, 1992, 2001, 2002, 2003, 1994, 1993, 1993, 2002, 2003,
+2004, 1995, 1994, 1994, 2003, 2004, 2005, 1996, 1995, 1995, 2004, 2005, 2006, 1997, 1996, 1996, 2005, 2006, 1891, 1880, 1997, 1997, 2006, 1891,
+2007, 1998, 1900, 1900, 1911, 2007, 2008, 1999, 1998, 1998, 2007, 2008, 2009, 2000, 1999, 1999, 2008, 2009, 2010, 2001, 2000, 2000, 2009, 2010,
+2011, 2002, 2001, 2001, 2010, 2011, 2012, 2003, 2002, 2002, 2011, 2012, 2013, 2004, 2003, 2003, 2012, 2013, 2014, 2005, 2004, 2004, 2013, 2014,
+2015, 2006, 2005, 2005, 2014, 2015, 1902, 1891, 2006, 2006, 2015, 1902, 2016, 2007, 1911, 1911, 1922, 2016, 2017, 2008, 2007, 2007, 2016, 2017,
+2018, 2009, 2008, 2008, 2017, 2018, 2019, 2010, 2009, 2009, 2018, 2019, 2020, 2011, 2010, 2010, 2019, 2020, 2021, 2012, 2011, 2011, 2020, 2021,
+2022, 2013, 2012, 2012, 2021, 2022, 2023, 2014, 2013, 2013, 2022, 2023, 2024, 2015, 2014, 2014, 2023, 2024, 1913, 1902, 2015, 2015, 2024, 1913,
+2025, 2016, 1922, 1922, 1933, 2025, 2026, 2017, 2016, 2016, 2025, 2026, 2027, 2018, 2017, 2017, 2026, 2027, 2028, 2019, 2018, 2018, 2027, 2028,
+2029, 2020, 2019, 2019, 2028, 2029, 2030, 2021, 2020, 2020, 2029, 2030, 2031, 2022, 2021, 2021, 2030, 2031, 2032, 2023, 2022, 2022, 2031, 2032,
+2033, 2024, 2023, 2023, 2032, 2033, 1924, 1913, 2024, 2024, 2033, 1924, 2034, 2025, 1933, 1933, 1944, 2034, 2035, 2026, 2025, 2025, 2034, 2035,
+2036, 2027, 2026, 2026, 2035, 2036, 2037, 2028, 2027, 2027, 2036, 2037, 2038, 2029, 2028, 2028, 2037, 2038, 2039, 2030, 2029, 2029, 2038, 2039,
+2040, 2031, 2030, 2030, 2039, 2040, 2041, 2032, 2031, 2031, 2040, 2041, 2042, 2033, 2032, 2032, 2041, 2042, 1935, 1924, 2033, 2033, 2042, 1935,
+2043, 2034, 1944, 1944, 1955, 2043, 2044, 2035, 2034, 2034, 2043, 2044, 2045, 2036, 2035, 2035, 2044, 2045, 2046, 2037, 2036, 2036, 2045, 2046,
+2047, 2038, 2037, 2037, 2046, 2047, 2048, 2039, 2038, 2038, 2047, 2048, 2049, 2040, 2039, 2039, 2048, 2049, 2050, 2041, 2040, 2040, 2049, 2050,
+2051, 2042, 2041, 2041, 2050, 2051, 1946, 1935, 2042, 2042, 2051, 1946, 2052, 2043, 1955, 1955, 1966, 2052, 2053, 2044, 2043, 2043, 2052, 2053,
+2054, 2045, 2044, 2044, 2053, 2054, 2055, 2046, 2045, 2045, 2054, 2055, 2056, 2047, 2046, 2046, 2055, 2056, 2057, 2048, 2047, 2047, 2056, 2057,
+2058, 2049, 2048, 2048, 2057, 2058, 2059, 2050, 2049, 2049, 2058, 2059, 2060, 2051, 2050, 2050, 2059, 2060, 1957, 1946, 2051, 2051, 2060, 1957,
+2061, 2052, 1966, 1966, 1977, 2061, 2062, 2053, 2052, 2052, 2061, 2062, 2063, 2054, 2053, 2053, 2062, 2063, 2064, 2055, 2054, 2054, 2063, 2064,
+2065, 2056, 2055, 2055, 2064, 2065, 2066, 2057, 2056, 2056, 2065, 2066, 2067, 2058, 2057, 2057, 2066, 2067, 2068, 2059, 2058, 2058, 2067, 2068,
+2069, 2060, 2059, 2059, 2068, 2069, 1968, 1957, 2060, 2060, 2069, 1968, 2070, 2061, 1977, 1977, 1988, 2070, 2071, 2062, 2061, 2061, 2070, 2071,
+2072, 2063, 2062, 2062, 2071, 2072, 2073, 2064, 2063, 2063, 2072, 2073, 2074, 2065, 2064, 2064, 2073, 2074, 2075, 2066, 2065, 2065, 2074, 2075,
+2076, 2067, 2066, 2066, 2075, 2076, 2077, 2068, 2067, 2067, 2076, 2077, 2078, 2069, 2068, 2068, 2077, 2078, 1979, 1968, 2069, 2069, 2078, 1979,
+2079, 2080, 2081, 2079, 2081, 2082, 2079, 2082, 2083, 2079, 2083, 2084, 2079, 2084, 2085, 2079, 2085, 2086, 2079, 2086, 2087, 2079, 2087, 2088,
+2079, 2088, 2089, 2079, 2089, 2090, 2091, 2081, 2080, 2080, 2092, 2091, 2093, 2082, 2081, 2081, 2091, 2093, 2094, 2083, 2082, 2082, 2093, 2094,
+2095, 2084, 2083, 2083, 2094, 2095, 2096, 2085, 2084, 2084, 2095, 2096, 2097, 2086, 2085, 2085, 2096, 2097, 2098, 2087, 2086, 2086, 2097, 2098,
+2099, 2088, 2087, 2087, 2098, 2099, 2100, 2089, 2088, 2088, 2099, 2100, 2101, 2090, 2089, 2089, 2100, 2101, 2102, 2091, 2092, 2092, 2103, 2102,
+2104, 2093, 2091, 2091, 2102, 2104, 2105, 2094, 2093, 2093, 2104, 2105, 2106, 2095, 2094, 2094, 2105, 2106, 2107, 2096, 2095, 2095, 2106, 2107,
+2108, 2097, 2096, 2096, 2107, 2108, 2109, 2098, 2097, 2097, 2108, 2109, 2110, 2099, 2098, 2098, 2109, 2110, 2111, 2100, 2099, 2099, 2110, 2111,
+2112, 2101, 2100, 2100, 2111, 2112, 2113, 2102, 2103, 2103, 2114, 2113, 2115, 2104, 2102, 2102, 2113, 2115, 2116, 2105, 2104, 2104, 2115, 2116,
+2117, 2106, 2105, 2105, 2116, 2117, 2118, 2107, 2106, 2106, 2117, 2118, 2119, 2108, 2107, 2107, 2118, 2119, 2120, 2109, 2108, 2108, 2119, 2120,
+2121, 2110, 2109, 2109, 2120, 2121, 2122, 2111, 2110, 2110, 2121, 2122, 2123, 2112, 2111, 2111, 2122, 2123, 2124, 2113, 2114, 2114, 2125, 2124,
+2126, 2115, 2113, 2113, 2124, 2126, 2127, 2116, 2115, 2115, 2126, 2127, 2128, 2117, 2116, 2116, 2127, 2128, 2129, 2118, 2117, 2117, 2128, 2129,
+2130, 2119, 2118, 2118, 2129, 2130, 2131, 2120, 2119, 2119, 2130, 2131, 2132, 2121, 2120, 2120, 2131, 2132, 2133, 2122, 2121, 2121, 2132, 2133,
+2134, 2123, 2122, 2122, 2133, 2134, 2135, 2124, 2125, 2125, 2136, 2135, 2137, 2126, 2124, 2124, 2135, 2137, 2138, 2127, 2126, 2126, 2137, 2138,
+2139, 2128, 2127, 2127, 2138, 2139, 2140, 2129, 2128, 2128, 2139, 2140, 2141, 2130, 2129, 2129, 2140, 2141, 2142, 2131, 2130, 2130, 2141, 2142,
+2143, 2132, 2131, 2131, 2142, 2143, 2144, 2133, 2132, 2132, 2143, 2144, 2145, 2134, 2133, 2133, 2144, 2145, 2146, 2135, 2136, 2136, 2147, 2146,
+2148, 2137, 2135, 2135, 2146, 2148, 2149, 2138, 2137, 2137, 2148, 2149, 2150, 2139, 2138, 2138, 2149, 2150, 2151, 2140, 2139, 2139, 2150, 2151,
+2152, 2141, 2140, 2140, 2151, 2152, 2153, 2142, 2141, 2141, 2152, 2153, 2154, 2143, 2142, 2142, 2153, 2154, 2155, 2144, 2143, 2143, 2154, 2155,
+2156, 2145, 2144, 2144, 2155, 2156, 2157, 2146, 2147, 2147, 2158, 2157, 2159, 2148, 2146, 2146, 2157, 2159, 2160, 2149, 2148, 2148, 2159, 2160,
+2161, 2150, 2149, 2149, 2160, 2161, 2162, 2151, 2150, 2150, 2161, 2162, 2163, 2152, 2151, 2151, 2162, 2163, 2164, 2153, 2152, 2152, 2163, 2164,
+2165, 2154, 2153, 2153, 2164, 2165, 2166, 2155, 2154, 2154, 2165, 2166, 2167, 2156, 2155, 2155, 2166, 2167, 2168, 2157, 2158, 2158, 2169, 2168,
+2170, 2159, 2157, 2157, 2168, 2170, 2171, 2160, 2159, 2159, 2170, 2171, 2172, 2161, 2160, 2160, 2171, 2172, 2173, 2162, 2161, 2161, 2172, 2173,
+2174, 2163, 2162, 2162, 2173, 2174, 2175, 2164, 2163, 2163, 2174, 2175, 2176, 2165, 2164, 2164, 2175, 2176, 2177, 2166, 2165, 2165, 2176, 2177,
+2178, 2167, 2166, 2166, 2177, 2178, 2179, 2168, 2169, 2169, 2180, 2179, 2181, 2170, 2168, 2168, 2179, 2181, 2182, 2171, 2170, 2170, 2181, 2182,
+2183, 2172, 2171, 2171, 2182, 2183, 2184, 2173, 2172, 2172, 2183, 2184, 2185, 2174, 2173, 2173, 2184, 2185, 2186, 2175, 2174, 2174, 2185, 2186,
+2187, 2176, 2175, 2175, 2186, 2187, 2188, 2177, 2176, 2176, 2187, 2188, 2189, 2178, 2177, 2177, 2188, 2189, 2079, 2090, 2190, 2079, 2190, 2191,
+2079, 2191, 2192, 2079, 2192, 2193, 2079, 2193, 2194, 2079, 2194, 2195, 2079, 2195, 2196, 2079, 2196, 2197, 2079, 2197, 2198, 2079, 2198, 2199,
+2200, 2190, 2090, 2090, 2101, 2200, 2201, 2191, 2190, 2190, 2200, 2201, 2202, 2192, 2191, 2191, 2201, 2202, 2203, 2193, 2192, 2192, 2202, 2203,
+2204, 2194, 2193, 2193, 2203, 2204, 2205, 2195, 2194, 2194, 2204, 2205, 2206, 2196, 2195, 2195, 2205, 2206, 2207, 2197, 2196, 2196, 2206, 2207,
+2208, 2198, 2197, 2197, 2207, 2208, 2209, 2199, 2198, 2198, 2208, 2209, 2210, 2200, 2101, 2101, 2112, 2210, 2211, 2201, 2200, 2200, 2210, 2211,
+2212, 2202, 2201, 2201, 2211, 2212, 2213, 2203, 2202, 2202, 2212, 2213, 2214, 2204, 2203, 2203, 2213, 2214, 2215, 2205, 2204, 2204, 2214, 2215,
+2216, 2206, 2205, 2205, 2215, 2216, 2217, 2207, 2206, 2206, 2216, 2217, 2218, 2208, 2207, 2207, 2217, 2218, 2219, 2209, 2208, 2208, 2218, 2219,
+2220, 2210, 2112, 2112, 2123, 2220, 2221, 2211, 2210, 2210, 2220, 2221, 2222, 2212, 2211, 2211, 2221, 2222, 2223, 2213, 2212, 2212, 2222, 2223,
+2224, 2214, 2213, 2213, 2223, 2224, 2225, 2215, 2214, 2214, 2224, 2225, 2226, 2216, 2215, 2215, 2225, 2226, 2227, 2217, 2216, 2216, 2226, 2227,
+2228, 2218, 2217, 2217, 2227, 2228, 2229, 2219, 2218, 2218, 2228, 2229, 2230, 2220, 2123, 2123, 2134, 2230, 2231, 2221, 2220, 2220, 2230, 2231,
+2232, 2222, 2221, 2221, 2231, 2232, 2233, 2223, 2222, 2222, 2232, 2233, 2234, 2224, 2223, 2223, 2233, 2234, 2235, 2225, 2224, 2224, 2234, 2235,
+2236, 2226, 2225, 2225, 2235, 2236, 2237, 2227, 2226, 2226, 2236, 2237, 2238, 2228, 2227, 2227, 2237, 2238, 2239, 2229, 2228, 2228, 2238, 2239,
+2240, 2230, 2134, 2134, 2145, 2240, 2241, 2231, 2230, 2230, 2240, 2241, 2242, 2232, 2231, 2231, 2241, 2242, 2243, 2233, 2232, 2232, 2242, 2243,
+2244, 2234, 2233, 2233, 2243, 2244, 2245, 2235, 2234, 2234, 2244, 2245, 2246, 2236, 2235, 2235, 2245, 2246, 2247, 2237, 2236, 2236, 2246, 2247,
+2248, 2238, 2237, 2237, 2247, 2248, 2249, 2239, 2238, 2238, 2248, 2249, 2250, 2240, 2145, 2145, 2156, 2250, 2251, 2241, 2240, 2240, 2250, 2251,
+2252, 2242, 2241, 2241, 2251, 2252, 2253, 2243, 2242, 2242, 2252, 2253, 2254, 2244, 2243, 2243, 2253, 2254, 2255, 2245, 2244, 2244, 2254, 2255,
+2256, 2246, 2245, 2245, 2255, 2256, 2257, 2247, 2246, 2246, 2256, 2257, 2258, 2248, 2247, 2247, 2257, 2258, 2259, 2249, 2248, 2248, 2258, 2259,
+2260, 2250, 2156, 2156, 2167, 2260, 2261, 2251, 2250, 2250, 2260, 2261, 2262, 2252, 2251, 2251, 2261, 2262, 2263, 2253, 2252, 2252, 2262, 2263,
+2264, 2254, 2253, 2253, 2263, 2264, 2265, 2255, 2254, 2254, 2264, 2265, 2266, 2256, 2255, 2255, 2265, 2266, 2267, 2257, 2256, 2256, 2266, 2267,
+2268, 2258, 2257, 2257, 2267, 2268, 2269, 2259, 2258, 2258, 2268, 2269, 2270, 2260, 2167, 2167, 2178, 2270, 2271, 2261, 2260, 2260, 2270, 2271,
+2272, 2262, 2261, 2261, 2271, 2272, 2273, 2263, 2262, 2262, 2272, 2273, 2274, 2264, 2263, 2263, 2273, 2274, 2275, 2265, 2264, 2264, 2274, 2275,
+2276, 2266, 2265, 2265, 2275, 2276, 2277, 2267, 2266, 2266, 2276, 2277, 2278, 2268, 2267, 2267, 2277, 2278, 2279, 2269, 2268, 2268, 2278, 2279,
+2280, 2270, 2178, 2178, 2189, 2280, 2281, 2271, 2270, 2270, 2280, 2281, 2282, 2272, 2271, 2271, 2281, 2282, 2283, 2273, 2272, 2272, 2282, 2283,
+2284, 2274, 2273, 2273, 2283, 2284, 2285, 2275, 2274, 2274, 2284, 2285, 2286, 2276, 2275, 2275, 2285, 2286, 2287, 2277, 2276, 2276, 2286, 2287,
+2288, 2278, 2277, 2277, 2287, 2288, 2289, 2279, 2278, 2278, 2288, 2289, 2079, 2199, 2290, 2079, 2290, 2291, 2079, 2291, 2292, 2079, 2292, 2293,
+2079, 2293, 2294, 2079, 2294, 2295, 2079, 2295, 2296, 2079, 2296, 2297, 2079, 2297, 2298, 2079, 2298, 2299, 2300, 2290, 2199, 2199, 2209, 2300,
+2301, 2291, 2290, 2290, 2300, 2301, 2302, 2292, 2291, 2291, 2301, 2302, 2303, 2293, 2292, 2292, 2302, 2303, 2304, 2294, 2293, 2293, 2303, 2304,
+2305, 2295, 2294, 2294, 2304, 2305, 2306, 2296, 2295, 2295, 2305, 2306, 2307, 2297, 2296, 2296, 2306, 2307, 2308, 2298, 2297, 2297, 2307, 2308,
+2309, 2299, 2298, 2298, 2308, 2309, 2310, 2300, 2209, 2209, 2219, 2310, 2311, 2301, 2300, 2300, 2310, 2311, 2312, 2302, 2301, 2301, 2311, 2312,
+2313, 2303, 2302, 2302, 2312, 2313, 2314, 2304, 2303, 2303, 2313, 2314, 2315, 2305, 2304, 2304, 2314, 2315, 2316, 2306, 2305, 2305, 2315, 2316,
+2317, 2307, 2306, 2306, 2316, 2317, 2318, 2308, 2307, 2307, 2317, 2318, 2319, 2309, 2308, 2308, 2318, 2319, 2320, 2310, 2219, 2219, 2229, 2320,
+2321, 2311, 2310, 2310, 2320, 2321, 2322, 2312, 2311, 2311, 2321, 2322, 2323, 2313, 2312, 2312, 2322, 2323, 2324, 2314, 2313, 2313, 2323, 2324,
+2325, 2315, 2314, 2314, 2324, 2325, 2326, 2316, 2315, 2315, 2325, 2326, 2327, 2317, 2316, 2316, 2326, 2327, 2328, 2318, 2317, 2317, 2327, 2328,
+2329, 2319, 2318, 2318, 2328, 2329, 2330, 2320, 2229, 2229, 2239, 2330, 2331, 2321, 2320, 2320, 2330, 2331, 2332, 2322, 2321, 2321, 2331, 2332,
+2333, 2323, 2322, 2322, 2332, 2333, 2334, 2324, 2323, 2323, 2333, 2334, 2335, 2325, 2324, 2324, 2334, 2335, 2336, 2326, 2325, 2325, 2335, 2336,
+2337, 2327, 2326, 2326, 2336, 2337, 2338, 2328, 2327, 2327, 2337, 2338, 2339, 2329, 2328, 2328, 2338, 2339, 2340, 2330, 2239, 2239, 2249, 2340,
+2341, 2331, 2330, 2330, 2340, 2341, 2342, 2332, 2331, 2331, 2341, 2342, 2343, 2333, 2332, 2332, 2342, 2343, 2344, 2334, 2333, 2333, 2343, 2344,
+2345, 2335, 2334, 2334, 2344, 2345, 2346, 2336, 2335, 2335, 2345, 2346, 2347, 2337, 2336, 2336, 2346, 2347, 2348, 2338, 2337, 2337, 2347, 2348,
+2349, 2339, 2338, 2338, 2348, 2349, 2350, 2340, 2249, 2249, 2259, 2350, 2351, 2341, 2340, 2340, 2350, 2351, 2352, 2342, 2341, 2341, 2351, 2352,
+2353, 2343, 2342, 2342, 2352, 2353, 2354, 2344, 2343, 2343, 2353, 2354, 2355, 2345, 2344, 2344, 2354, 2355, 2356, 2346, 2345, 2345, 2355, 2356,
+2357, 2347, 2346, 2346, 2356, 2357, 2358, 2348, 2347, 2347, 2357, 2358, 2359, 2349, 2348, 2348, 2358, 2359, 2360, 2350, 2259, 2259, 2269, 2360,
+2361, 2351, 2350, 2350, 2360, 2361, 2362, 2352, 2351, 2351, 2361, 2362, 2363, 2353, 2352, 2352, 2362, 2363, 2364, 2354, 2353, 2353, 2363, 2364,
+2365, 2355, 2354, 2354, 2364, 2365, 2366, 2356, 2355, 2355, 2365, 2366, 2367, 2357, 2356, 2356, 2366, 2367, 2368, 2358, 2357, 2357, 2367, 2368,
+2369, 2359, 2358, 2358, 2368, 2369, 2370, 2360, 2269, 2269, 2279, 2370, 2371, 2361, 2360, 2360, 2370, 2371, 2372, 2362, 2361, 2361, 2371, 2372,
+2373, 2363, 2362, 2362, 2372, 2373, 2374, 2364, 2363, 2363, 2373, 2374, 2375, 2365, 2364, 2364, 2374, 2375, 2376, 2366, 2365, 2365, 2375, 2376,
+2377, 2367, 2366, 2366, 2376, 2377, 2378, 2368, 2367, 2367, 2377, 2378, 2379, 2369, 2368, 2368, 2378, 2379, 2380, 2370, 2279, 2279, 2289, 2380,
+2381, 2371, 2370, 2370, 2380, 2381, 2382, 2372, 2371, 2371, 2381, 2382, 2383, 2373, 2372, 2372, 2382, 2383, 2384, 2374, 2373, 2373, 2383, 2384,
+2385, 2375, 2374, 2374, 2384, 2385, 2386, 2376, 2375, 2375, 2385, 2386, 2387, 2377, 2376, 2376, 2386, 2387, 2388, 2378, 2377, 2377, 2387, 2388,
+2389, 2379, 2378, 2378, 2388, 2389, 2079, 2299, 2390, 2079, 2390, 2391, 2079, 2391, 2392, 2079, 2392, 2393, 2079, 2393, 2394, 2079, 2394, 2395,
+2079, 2395, 2396, 2079, 2396, 2397, 2079, 2397, 2398, 2079, 2398, 2080, 2399, 2390, 2299, 2299, 2309, 2399, 2400, 2391, 2390, 2390, 2399, 2400,
+2401, 2392, 2391, 2391, 2400, 2401, 2402, 2393, 2392, 2392, 2401, 2402, 2403, 2394, 2393, 2393, 2402, 2403, 2404, 2395, 2394, 2394, 2403, 2404,
+2405, 2396, 2395, 2395, 2404, 2405, 2406, 2397, 2396, 2396, 2405, 2406, 2407, 2398, 2397, 2397, 2406, 2407, 2092, 2080, 2398, 2398, 2407, 2092,
+2408, 2399, 2309, 2309, 2319, 2408, 2409, 2400, 2399, 2399, 2408, 2409, 2410, 2401, 2400, 2400, 2409, 2410, 2411, 2402, 2401, 2401, 2410, 2411,
+2412, 2403, 2402, 2402, 2411, 2412, 2413, 2404, 2403, 2403, 2412, 2413, 2414, 2405, 2404, 2404, 2413, 2414, 2415, 2406, 2405, 2405, 2414, 2415,
+2416, 2407, 2406, 2406, 2415, 2416, 2103, 2092, 2407, 2407, 2416, 2103, 2417, 2408, 2319, 2319, 2329, 2417, 2418, 2409, 2408, 2408, 2417, 2418,
+2419, 2410, 2409, 2409, 2418, 2419, 2420, 2411, 2410, 2410, 2419, 2420, 2421, 2412, 2411, 2411, 2420, 2421, 2422, 2413, 2412, 2412, 2421, 2422,
+2423, 2414, 2413, 2413, 2422, 2423, 2424, 2415, 2414, 2414, 2423, 2424, 2425, 2416, 2415, 2415, 2424, 2425, 2114, 2103, 2416, 2416, 2425, 2114,
+2426, 2417, 2329, 2329, 2339, 2426, 2427, 2418, 2417, 2417, 2426, 2427, 2428, 2419, 2418, 2418, 2427, 2428, 2429, 2420, 2419, 2419, 2428, 2429,
+2430, 2421, 2420, 2420, 2429, 2430, 2431, 2422, 2421, 2421, 2430, 2431, 2432, 2423, 2422, 2422, 2431, 2432, 2433, 2424, 2423, 2423, 2432, 2433,
+2434, 2425, 2424, 2424, 2433, 2434, 2125, 2114, 2425, 2425, 2434, 2125, 2435, 2426, 2339, 2339, 2349, 2435, 2436, 2427, 2426, 2426, 2435, 2436,
+2437, 2428, 2427, 2427, 2436, 2437, 2438, 2429, 2428, 2428, 2437, 2438, 2439, 2430, 2429, 2429, 2438, 2439, 2440, 2431, 2430, 2430, 2439, 2440,
+2441, 2432, 2431, 2431, 2440, 2441, 2442, 2433, 2432, 2432, 2441, 2442, 2443, 2434, 2433, 2433, 2442, 2443, 2136, 2125, 2434, 2434, 2443, 2136,
+2444, 2435, 2349, 2349, 2359, 2444, 2445, 2436, 2435, 2435, 2444, 2445, 2446, 2437, 2436, 2436, 2445, 2446, 2447, 2438, 2437, 2437, 2446, 2447,
+2448, 2439, 2438, 2438, 2447, 2448, 2449, 2440, 2439, 2439, 2448, 2449, 2450, 2441, 2440, 2440, 2449, 2450, 2451, 2442, 2441, 2441, 2450, 2451,
+2452, 2443, 2442, 2442, 2451, 2452, 2147, 2136, 2443, 2443, 2452, 2147, 2453, 2444, 2359, 2359, 2369, 2453, 2454, 2445, 2444, 2444, 2453, 2454,
+2455, 2446, 2445, 2445, 2454, 2455, 2456, 2447, 2446, 2446, 2455, 2456, 2457, 2448, 2447, 2447, 2456, 2457, 2458, 2449, 2448, 2448, 2457, 2458,
+2459, 2450, 2449, 2449, 2458, 2459, 2460, 2451, 2450, 2450, 2459, 2460, 2461, 2452, 2451, 2451, 2460, 2461, 2158, 2147, 2452, 2452, 2461, 2158,
+2462, 2453, 2369, 2369, 2379, 2462, 2463, 2454, 2453, 2453, 2462, 2463, 2464, 2455, 2454, 2454, 2463, 2464, 2465, 2456, 2455, 2455, 2464, 2465,
+2466, 2457, 2456, 2456, 2465, 2466, 2467, 2458, 2457, 2457, 2466, 2467, 2468, 2459, 2458, 2458, 2467, 2468, 2469, 2460, 2459, 2459, 2468, 2469,
+2470, 2461, 2460, 2460, 2469, 2470, 2169, 2158, 2461, 2461, 2470, 2169, 2471, 2462, 2379, 2379, 2389, 2471, 2472, 2463, 2462, 2462, 2471, 2472,
+2473, 2464, 2463, 2463, 2472, 2473, 2474, 2465, 2464, 2464, 2473, 2474, 2475, 2466, 2465, 2465, 2474, 2475, 2476, 2467, 2466, 2466, 2475, 2476,
+2477, 2468, 2467, 2467, 2476, 2477, 2478, 2469, 2468, 2468, 2477, 2478, 2479, 2470, 2469, 2469, 2478, 2479, 2180, 2169, 2470, 2470, 2479, 2180,
+2480, 2179, 2180, 2180, 2481, 2480, 2482, 2181, 2179, 2179, 2480, 2482, 2483, 2182, 2181, 2181, 2482, 2483, 2484, 2183, 2182, 2182, 2483, 2484,
+2485, 2184, 2183, 2183, 2484, 2485, 2486, 2185, 2184, 2184, 2485, 2486, 2487, 2186, 2185, 2185, 2486, 2487, 2488, 2187, 2186, 2186, 2487, 2488,
+2489, 2188, 2187, 2187, 2488, 2489, 2490, 2189, 2188, 2188, 2489, 2490, 2491, 2480, 2481, 2481, 2492, 2491, 2493, 2482, 2480, 2480, 2491, 2493,
+2494, 2483, 2482, 2482, 2493, 2494, 2495, 2484, 2483, 2483, 2494, 2495, 2496, 2485, 2484, 2484, 2495, 2496, 2497, 2486, 2485, 2485, 2496, 2497,
+2498, 2487, 2486, 2486, 2497, 2498, 2499, 2488, 2487, 2487, 2498, 2499, 2500, 2489, 2488, 2488, 2499, 2500, 2501, 2490, 2489, 2489, 2500, 2501,
+2502, 2491, 2492, 2492, 2503, 2502, 2504, 2493, 2491, 2491, 2502, 2504, 2505, 2494, 2493, 2493, 2504, 2505, 2506, 2495, 2494, 2494, 2505, 2506,
+2507, 2496, 2495, 2495, 2506, 2507, 2508, 2497, 2496, 2496, 2507, 2508, 2509, 2498, 2497, 2497, 2508, 2509, 2510, 2499, 2498, 2498, 2509, 2510,
+2511, 2500, 2499, 2499, 2510, 2511, 2512, 2501, 2500, 2500, 2511, 2512, 2513, 2502, 2503, 2503, 2514, 2513, 2515, 2504, 2502, 2502, 2513, 2515,
+2516, 2505, 2504, 2504, 2515, 2516, 2517, 2506, 2505, 2505, 2516, 2517, 2518, 2507, 2506, 2506, 2517, 2518, 2519, 2508, 2507, 2507, 2518, 2519,
+2520, 2509, 2508, 2508, 2519, 2520, 2521, 2510, 2509, 2509, 2520, 2521, 2522, 2511, 2510, 2510, 2521, 2522, 2523, 2512, 2511, 2511, 2522, 2523,
+2524, 2513, 2514, 2514, 2525, 2524, 2526, 2515, 2513, 2513, 2524, 2526, 2527, 2516, 2515, 2515, 2526, 2527, 2528, 2517, 2516, 2516, 2527, 2528,
+2529, 2518, 2517, 2517, 2528, 2529, 2530, 2519, 2518, 2518, 2529, 2530, 2531, 2520, 2519, 2519, 2530, 2531, 2532, 2521, 2520, 2520, 2531, 2532,
+2533, 2522, 2521, 2521, 2532, 2533, 2534, 2523, 2522, 2522, 2533, 2534, 2535, 2524, 2525, 2525, 2536, 2535, 2537, 2526, 2524, 2524, 2535, 2537,
+2538, 2527, 2526, 2526, 2537, 2538, 2539, 2528, 2527, 2527, 2538, 2539, 2540, 2529, 2528, 2528, 2539, 2540, 2541, 2530, 2529, 2529, 2540, 2541,
+2542, 2531, 2530, 2530, 2541, 2542, 2543, 2532, 2531, 2531, 2542, 2543, 2544, 2533, 2532, 2532, 2543, 2544, 2545, 2534, 2533, 2533, 2544, 2545,
+2546, 2535, 2536, 2536, 2547, 2546, 2548, 2537, 2535, 2535, 2546, 2548, 2549, 2538, 2537, 2537, 2548, 2549, 2550, 2539, 2538, 2538, 2549, 2550,
+2551, 2540, 2539, 2539, 2550, 2551, 2552, 2541, 2540, 2540, 2551, 2552, 2553, 2542, 2541, 2541, 2552, 2553, 2554, 2543, 2542, 2542, 2553, 2554,
+2555, 2544, 2543, 2543, 2554, 2555, 2556, 2545, 2544, 2544, 2555, 2556, 2557, 2546, 2547, 2547, 2558, 2557, 2559, 2548, 2546, 2546, 2557, 2559,
+2560, 2549, 2548, 2548, 2559, 2560, 2561, 2550, 2549, 2549, 2560, 2561, 2562, 2551, 2550, 2550, 2561, 2562, 2563, 2552, 2551, 2551, 2562, 2563,
+2564, 2553, 2552, 2552, 2563, 2564, 2565, 2554, 2553, 2553, 2564, 2565, 2566, 2555, 2554, 2554, 2565, 2566, 2567, 2556, 2555, 2555, 2566, 2567,
+2568, 2557, 2558, 2558, 2569, 2568, 2570, 2559, 2557, 2557, 2568, 2570, 2571, 2560, 2559, 2559, 2570, 2571, 2572, 2561, 2560, 2560, 2571, 2572,
+2573, 2562, 2561, 2561, 2572, 2573, 2574, 2563, 2562, 2562, 2573, 2574, 2575, 2564, 2563, 2563, 2574, 2575, 2576, 2565, 2564, 2564, 2575, 2576,
+2577, 2566, 2565, 2565, 2576, 2577, 2578, 2567, 2566, 2566, 2577, 2578, 2579, 2568, 2569, 2569, 2580, 2579, 2581, 2570, 2568, 2568, 2579, 2581,
+2582, 2571, 2570, 2570, 2581, 2582, 2583, 2572, 2571, 2571, 2582, 2583, 2584, 2573, 2572, 2572, 2583, 2584, 2585, 2574, 2573, 2573, 2584, 2585,
+2586, 2575, 2574, 2574, 2585, 2586, 2587, 2576, 2575, 2575, 2586, 2587, 2588, 2577, 2576, 2576, 2587, 2588, 2589, 2578, 2577, 2577, 2588, 2589,
+2590, 2280, 2189, 2189, 2490, 2590, 2591, 2281, 2280, 2280, 2590, 2591, 2592, 2282, 2281, 2281, 2591, 2592, 2593, 2283, 2282, 2282, 2592, 2593,
+2594, 2284, 2283, 2283, 2593, 2594, 2595, 2285, 2284, 2284, 2594, 2595, 2596, 2286, 2285, 2285, 2595, 2596, 2597, 2287, 2286, 2286, 2596, 2597,
+2598, 2288, 2287, 2287, 2597, 2598, 2599, 2289, 2288, 2288, 2598, 2599, 2600, 2590, 2490, 2490, 2501, 2600, 2601, 2591, 2590, 2590, 2600, 2601,
+2602, 2592, 2591, 2591, 2601, 2602, 2603, 2593, 2592, 2592, 2602, 2603, 2604, 2594, 2593, 2593, 2603, 2604, 2605, 2595, 2594, 2594, 2604, 2605,
+2606, 2596, 2595, 2595, 2605, 2606, 2607, 2597, 2596, 2596, 2606, 2607, 2608, 2598, 2597, 2597, 2607, 2608, 2609, 2599, 2598, 2598, 2608, 2609,
+2610, 2600, 2501, 2501, 2512, 2610, 2611, 2601, 2600, 2600, 2610, 2611, 2612, 2602, 2601, 2601, 2611, 2612, 2613, 2603, 2602, 2602, 2612, 2613,
+2614, 2604, 2603, 2603, 2613, 2614, 2615, 2605, 2604, 2604, 2614, 2615, 2616, 2606, 2605, 2605, 2615, 2616, 2617, 2607, 2606, 2606, 2616, 2617,
+2618, 2608, 2607, 2607, 2617, 2618, 2619, 2609, 2608, 2608, 2618, 2619, 2620, 2610, 2512, 2512, 2523, 2620, 2621, 2611, 2610, 2610, 2620, 2621,
+2622, 2612, 2611, 2611, 2621, 2622, 2623, 2613, 2612, 2612, 2622, 2623, 2624, 2614, 2613, 2613, 2623, 2624, 2625, 2615, 2614, 2614, 2624, 2625,
+2626, 2616, 2615, 2615, 2625, 2626, 2627, 2617, 2616, 2616, 2626, 2627, 2628, 2618, 2617, 2617, 2627, 2628, 2629, 2619, 2618, 2618, 2628, 2629,
+2630, 2620, 2523, 2523, 2534, 2630, 2631, 2621, 2620, 2620, 2630, 2631, 2632, 2622, 2621, 2621, 2631, 2632, 2633, 2623, 2622, 2622, 2632, 2633,
+2634, 2624, 2623, 2623, 2633, 2634, 2635, 2625, 2624, 2624, 2634, 2635, 2636, 2626, 2625, 2625, 2635, 2636, 2637, 2627, 2626, 2626, 2636, 2637,
+2638, 2628, 2627, 2627, 2637, 2638, 2639, 2629, 2628, 2628, 2638, 2639, 2640, 2630, 2534, 2534, 2545, 2640, 2641, 2631, 2630, 2630, 2640, 2641,
+2642, 2632, 2631, 2631, 2641, 2642, 2643, 2633, 2632, 2632, 2642, 2643, 2644, 2634, 2633, 2633, 2643, 2644, 2645, 2635, 2634, 2634, 2644, 2645,
+2646, 2636, 2635, 2635, 2645, 2646, 2647, 2637, 2636, 2636, 2646, 2647, 2648, 2638, 2637, 2637, 2647, 2648, 2649, 2639, 2638, 2638, 2648, 2649,
+2650, 2640, 2545, 2545, 2556, 2650, 2651, 2641, 2640, 2640, 2650, 2651, 2652, 2642, 2641, 2641, 2651, 2652, 2653, 2643, 2642, 2642, 2652, 2653,
+2654, 2644, 2643, 2643, 2653, 2654, 2655, 2645, 2644, 2644, 2654, 2655, 2656, 2646, 2645, 2645, 2655, 2656, 2657, 2647, 2646, 2646, 2656, 2657,
+2658, 2648, 2647, 2647, 2657, 2658, 2659, 2649, 2648, 2648, 2658, 2659, 2660, 2650, 2556, 2556, 2567, 2660, 2661, 2651, 2650, 2650, 2660, 2661,
+2662, 2652, 2651, 2651, 2661, 2662, 2663, 2653, 2652, 2652, 2662, 2663, 2664, 2654, 2653, 2653, 2663, 2664, 2665, 2655, 2654, 2654, 2664, 2665,
+2666, 2656, 2655, 2655, 2665, 2666, 2667, 2657, 2656, 2656, 2666, 2667, 2668, 2658, 2657, 2657, 2667, 2668, 2669, 2659, 2658, 2658, 2668, 2669,
+2670, 2660, 2567, 2567, 2578, 2670, 2671, 2661, 2660, 2660, 2670, 2671, 2672, 2662, 2661, 2661, 2671, 2672, 2673, 2663, 2662, 2662, 2672, 2673,
+2674, 2664, 2663, 2663, 2673, 2674, 2675, 2665, 2664, 2664, 2674, 2675, 2676, 2666, 2665, 2665, 2675, 2676, 2677, 2667, 2666, 2666, 2676, 2677,
+2678, 2668, 2667, 2667, 2677, 2678, 2679, 2669, 2668, 2668, 2678, 2679, 2680, 2670, 2578, 2578, 2589, 2680, 2681, 2671, 2670, 2670, 2680, 2681,
+2682, 2672, 2671, 2671, 2681, 2682, 2683, 2673, 2672, 2672, 2682, 2683, 2684, 2674, 2673, 2673, 2683, 2684, 2685, 2675, 2674, 2674, 2684, 2685,
+2686, 2676, 2675, 2675, 2685, 2686, 2687, 2677, 2676, 2676, 2686, 2687, 2688, 2678, 2677, 2677, 2687, 2688, 2689, 2679, 2678, 2678, 2688, 2689,
+2690, 2380, 2289, 2289, 2599, 2690, 2691, 2381, 2380, 2380, 2690, 2691, 2692, 2382, 2381, 2381, 2691, 2692, 2693, 2383, 2382, 2382, 2692, 2693,
+2694, 2384, 2383, 2383, 2693, 2694, 2695, 2385, 2384, 2384, 2694, 2695, 2696, 2386, 2385, 2385, 2695, 2696, 2697, 2387, 2386, 2386, 2696, 2697,
+2698, 2388, 2387, 2387, 2697, 2698, 2699, 2389, 2388, 2388, 2698, 2699, 2700, 2690, 2599, 2599, 2609, 2700, 2701, 2691, 2690, 2690, 2700, 2701,
+2702, 2692, 2691, 2691, 2701, 2702, 2703, 2693, 2692, 2692, 2702, 2703, 2704, 2694, 2693, 2693, 2703, 2704, 2705, 2695, 2694, 2694, 2704, 2705,
+2706, 2696, 2695, 2695, 2705, 2706, 2707, 2697, 2696, 2696, 2706, 2707, 2708, 2698, 2697, 2697, 2707, 2708, 2709, 2699, 2698, 2698, 2708, 2709,
+2710, 2700, 2609, 2609, 2619, 2710, 2711, 2701, 2700, 2700, 2710, 2711, 2712, 2702, 2701, 2701, 2711, 2712, 2713, 2703, 2702, 2702, 2712, 2713,
+2714, 2704, 2703, 2703, 2713, 2714, 2715, 2705, 2704, 2704, 2714, 2715, 2716, 2706, 2705, 2705, 2715, 2716, 2717, 2707, 2706, 2706, 2716, 2717,
+2718, 2708, 2707, 2707, 2717, 2718, 2719, 2709, 2708, 2708, 2718, 2719, 2720, 2710, 2619, 2619, 2629, 2720, 2721, 2711, 2710, 2710, 2720, 2721,
+2722, 2712, 2711, 2711, 2721, 2722, 2723, 2713, 2712, 2712, 2722, 2723, 2724, 2714, 2713, 2713, 2723, 2724, 2725, 2715, 2714, 2714, 2724, 2725,
+2726, 2716, 2715, 2715, 2725, 2726, 2727, 2717, 2716, 2716, 2726, 2727, 2728, 2718, 2717, 2717, 2727, 2728, 2729, 2719, 2718, 2718, 2728, 2729,
+2730, 2720, 2629, 2629, 2639, 2730, 2731, 2721, 2720, 2720, 2730, 2731, 2732, 2722, 2721, 2721, 2731, 2732, 2733, 2723, 2722, 2722, 2732, 2733,
+2734, 2724, 2723, 2723, 2733, 2734, 2735, 2725, 2724, 2724, 2734, 2735, 2736, 2726, 2725, 2725, 2735, 2736, 2737, 2727, 2726, 2726, 2736, 2737,
+2738, 2728, 2727, 2727, 2737, 2738, 2739, 2729, 2728, 2728, 2738, 2739, 2740, 2730, 2639, 2639, 2649, 2740, 2741, 2731, 2730, 2730, 2740, 2741,
+2742, 2732, 2731, 2731, 2741, 2742, 2743, 2733, 2732, 2732, 2742, 2743, 2744, 2734, 2733, 2733, 2743, 2744, 2745, 2735, 2734, 2734, 2744, 2745,
+2746, 2736, 2735, 2735, 2745, 2746, 2747, 2737, 2736, 2736, 2746, 2747, 2748, 2738, 2737, 2737, 2747, 2748, 2749, 2739, 2738, 2738, 2748, 2749,
+2750, 2740, 2649, 2649, 2659, 2750, 2751, 2741, 2740, 2740, 2750, 2751, 2752, 2742, 2741, 2741, 2751, 2752, 2753, 2743, 2742, 2742, 2752, 2753,
+2754, 2744, 2743, 2743, 2753, 2754, 2755, 2745, 2744, 2744, 2754, 2755, 2756, 2746, 2745, 2745, 2755, 2756, 2757, 2747, 2746, 2746, 2756, 2757,
+2758, 2748, 2747, 2747, 2757, 2758, 2759, 2749, 2748, 2748, 2758, 2759, 2760, 2750, 2659, 2659, 2669, 2760, 2761, 2751, 2750, 2750, 2760, 2761,
+2762, 2752, 2751, 2751, 2761, 2762, 2763, 2753, 2752, 2752, 2762, 2763, 2764, 2754, 2753, 2753, 2763, 2764, 2765, 2755, 2754, 2754, 2764, 2765,
+2766, 2756, 2755, 2755, 2765, 2766, 2767, 2757, 2756, 2756, 2766, 2767, 2768, 2758, 2757, 2757, 2767, 2768, 2769, 2759, 2758, 2758, 2768, 2769,
+2770, 2760, 2669, 2669, 2679, 2770, 2771, 2761, 2760, 2760, 2770, 2771, 2772, 2762, 2761, 2761, 2771, 2772, 2773, 2763, 2762, 2762, 2772, 2773,
+2774, 2764, 2763, 2763, 2773, 2774, 2775, 2765, 2764, 2764, 2774, 2775, 2776, 2766, 2765, 2765, 2775, 2776, 2777, 2767, 2766, 2766, 2776, 2777,
+2778, 2768, 2767, 2767, 2777, 2778, 2779, 2769, 2768, 2768, 2778, 2779, 2780, 2770, 2679, 2679, 2689, 2780, 2781, 2771, 2770, 2770, 2780, 2781,
+2782, 2772, 2771, 2771, 2781, 2782, 2783, 2773, 2772, 2772, 2782, 2783, 2784, 2774, 2773, 2773, 2783, 2784, 2785, 2775, 2774, 2774, 2784, 2785,
+2786, 2776, 2775, 2775, 2785, 2786, 2787, 2777, 2776, 2776, 2786, 2787, 2788, 2778, 2777, 2777, 2787, 2788, 2789, 2779, 2778, 2778, 2788, 2789,
+2790, 2471, 2389, 2389, 2699, 2790, 2791, 2472, 2471, 2471, 2790, 2791, 2792, 2473, 2472, 2472, 2791, 2792, 2793, 2474, 2473, 2473, 2792, 2793,
+2794, 2475, 2474, 2474, 2793, 2794, 2795, 2476, 2475, 2475, 2794, 2795, 2796, 2477, 2476, 2476, 2795, 2796, 2797, 2478, 2477, 2477, 2796, 2797,
+2798, 2479, 2478, 2478, 2797, 2798, 2481, 2180, 2479, 2479, 2798, 2481, 2799, 2790, 2699, 2699, 2709, 2799, 2800, 2791, 2790, 2790, 2799, 2800,
+2801, 2792, 2791, 2791, 2800, 2801, 2802, 2793, 2792, 2792, 2801, 2802, 2803, 2794, 2793, 2793, 2802, 2803, 2804, 2795, 2794, 2794, 2803, 2804,
+2805, 2796, 2795, 2795, 2804, 2805, 2806, 2797, 2796, 2796, 2805, 2806, 2807, 2798, 2797, 2797, 2806, 2807, 2492, 2481, 2798, 2798, 2807, 2492,
+2808, 2799, 2709, 2709, 2719, 2808, 2809, 2800, 2799, 2799, 2808, 2809, 2810, 2801, 2800, 2800, 2809, 2810, 2811, 2802, 2801, 2801, 2810, 2811,
+2812, 2803, 2802, 2802, 2811, 2812, 2813, 2804, 2803, 2803, 2812, 2813, 2814, 2805, 2804, 2804, 2813, 2814, 2815, 2806, 2805, 2805, 2814, 2815,
+2816, 2807, 2806, 2806, 2815, 2816, 2503, 2492, 2807, 2807, 2816, 2503, 2817, 2808, 2719, 2719, 2729, 2817, 2818, 2809, 2808, 2808, 2817, 2818,
+2819, 2810, 2809, 2809, 2818, 2819, 2820, 2811, 2810, 2810, 2819, 2820, 2821, 2812, 2811, 2811, 2820, 2821, 2822, 2813, 2812, 2812, 2821, 2822,
+2823, 2814, 2813, 2813, 2822, 2823, 2824, 2815, 2814, 2814, 2823, 2824, 2825, 2816, 2815, 2815, 2824, 2825, 2514, 2503, 2816, 2816, 2825, 2514,
+2826, 2817, 2729, 2729, 2739, 2826, 2827, 2818, 2817, 2817, 2826, 2827, 2828, 2819, 2818, 2818, 2827, 2828, 2829, 2820, 2819, 2819, 2828, 2829,
+2830, 2821, 2820, 2820, 2829, 2830, 2831, 2822, 2821, 2821, 2830, 2831, 2832, 2823, 2822, 2822, 2831, 2832, 2833, 2824, 2823, 2823, 2832, 2833,
+2834, 2825, 2824, 2824, 2833, 2834, 2525, 2514, 2825, 2825, 2834, 2525, 2835, 2826, 2739, 2739, 2749, 2835, 2836, 2827, 2826, 2826, 2835, 2836,
+2837, 2828, 2827, 2827, 2836, 2837, 2838, 2829, 2828, 2828, 2837, 2838, 2839, 2830, 2829, 2829, 2838, 2839, 2840, 2831, 2830, 2830, 2839, 2840,
+2841, 2832, 2831, 2831, 2840, 2841, 2842, 2833, 2832, 2832, 2841, 2842, 2843, 2834, 2833, 2833, 2842, 2843, 2536, 2525, 2834, 2834, 2843, 2536,
+2844, 2835, 2749, 2749, 2759, 2844, 2845, 2836, 2835, 2835, 2844, 2845, 2846, 2837, 2836, 2836, 2845, 2846, 2847, 2838, 2837, 2837, 2846, 2847,
+2848, 2839, 2838, 2838, 2847, 2848, 2849, 2840, 2839, 2839, 2848, 2849, 2850, 2841, 2840, 2840, 2849, 2850, 2851, 2842, 2841, 2841, 2850, 2851,
+2852, 2843, 2842, 2842, 2851, 2852, 2547, 2536, 2843, 2843, 2852, 2547, 2853, 2844, 2759, 2759, 2769, 2853, 2854, 2845, 2844, 2844, 2853, 2854,
+2855, 2846, 2845, 2845, 2854, 2855, 2856, 2847, 2846, 2846, 2855, 2856, 2857, 2848, 2847, 2847, 2856, 2857, 2858, 2849, 2848, 2848, 2857, 2858,
+2859, 2850, 2849, 2849, 2858, 2859, 2860, 2851, 2850, 2850, 2859, 2860, 2861, 2852, 2851, 2851, 2860, 2861, 2558, 2547, 2852, 2852, 2861, 2558,
+2862, 2853, 2769, 2769, 2779, 2862, 2863, 2854, 2853, 2853, 2862, 2863, 2864, 2855, 2854, 2854, 2863, 2864, 2865, 2856, 2855, 2855, 2864, 2865,
+2866, 2857, 2856, 2856, 2865, 2866, 2867, 2858, 2857, 2857, 2866, 2867, 2868, 2859, 2858, 2858, 2867, 2868, 2869, 2860, 2859, 2859, 2868, 2869,
+2870, 2861, 2860, 2860, 2869, 2870, 2569, 2558, 2861, 2861, 2870, 2569, 2871, 2862, 2779, 2779, 2789, 2871, 2872, 2863, 2862, 2862, 2871, 2872,
+2873, 2864, 2863, 2863, 2872, 2873, 2874, 2865, 2864, 2864, 2873, 2874, 2875, 2866, 2865, 2865, 2874, 2875, 2876, 2867, 2866, 2866, 2875, 2876,
+2877, 2868, 2867, 2867, 2876, 2877, 2878, 2869, 2868, 2868, 2877, 2878, 2879, 2870, 2869, 2869, 2878, 2879, 2580, 2569, 2870, 2870, 2879, 2580,
+2880, 2881, 2882, 2880, 2882, 2883, 2880, 2883, 2884, 2880, 2884, 2885, 2880, 2885, 2886, 2880, 2886, 2887, 2880, 2887, 2888, 2880, 2888, 2889,
+2880, 2889, 2890, 2880, 2890, 2891, 2892, 2882, 2881, 2881, 2893, 2892, 2894, 2883, 2882, 2882, 2892, 2894, 2895, 2884, 2883, 2883, 2894, 2895,
+2896, 2885, 2884, 2884, 2895, 2896, 2897, 2886, 2885, 2885, 2896, 2897, 2898, 2887, 2886, 2886, 2897, 2898, 2899, 2888, 2887, 2887, 2898, 2899,
+2900, 2889, 2888, 2888, 2899, 2900, 2901, 2890, 2889, 2889, 2900, 2901, 2902, 2891, 2890, 2890, 2901, 2902, 2903, 2892, 2893, 2893, 2904, 2903,
+2905, 2894, 2892, 2892, 2903, 2905, 2906, 2895, 2894, 2894, 2905, 2906, 2907, 2896, 2895, 2895, 2906, 2907, 2908, 2897, 2896, 2896, 2907, 2908,
+2909, 2898, 2897, 2897, 2908, 2909, 2910, 2899, 2898, 2898, 2909, 2910, 2911, 2900, 2899, 2899, 2910, 2911, 2912, 2901, 2900, 2900, 2911, 2912,
+2913, 2902, 2901, 2901, 2912, 2913, 2914, 2903, 2904, 2904, 2915, 2914, 2916, 2905, 2903, 2903, 2914, 2916, 2917, 2906, 2905, 2905, 2916, 2917,
+2918, 2907, 2906, 2906, 2917, 2918, 2919, 2908, 2907, 2907, 2918, 2919, 2920, 2909, 2908, 2908, 2919, 2920, 2921, 2910, 2909, 2909, 2920, 2921,
+2922, 2911, 2910, 2910, 2921, 2922, 2923, 2912, 2911, 2911, 2922, 2923, 2924, 2913, 2912, 2912, 2923, 2924, 2925, 2914, 2915, 2915, 2926, 2925,
+2927, 2916, 2914, 2914, 2925, 2927, 2928, 2917, 2916, 2916, 2927, 2928, 2929, 2918, 2917, 2917, 2928, 2929, 2930, 2919, 2918, 2918, 2929, 2930,
+2931, 2920, 2919, 2919, 2930, 2931, 2932, 2921, 2920, 2920, 2931, 2932, 2933, 2922, 2921, 2921, 2932, 2933, 2934, 2923, 2922, 2922, 2933, 2934,
+2935, 2924, 2923, 2923, 2934, 2935, 2936, 2925, 2926, 2926, 2937, 2936, 2938, 2927, 2925, 2925, 2936, 2938, 2939, 2928, 2927, 2927, 2938, 2939,
+2940, 2929, 2928, 2928, 2939, 2940, 2941, 2930, 2929, 2929, 2940, 2941, 2942, 2931, 2930, 2930, 2941, 2942, 2943, 2932, 2931, 2931, 2942, 2943,
+2944, 2933, 2932, 2932, 2943, 2944, 2945, 2934, 2933, 2933, 2944, 2945, 2946, 2935, 2934, 2934, 2945, 2946, 2947, 2936, 2937, 2937, 2948, 2947,
+2949, 2938, 2936, 2936, 2947, 2949, 2950, 2939, 2938, 2938, 2949, 2950, 2951, 2940, 2939, 2939, 2950, 2951, 2952, 2941, 2940, 2940, 2951, 2952,
+2953, 2942, 2941, 2941, 2952, 2953, 2954, 2943, 2942, 2942, 2953, 2954, 2955, 2944, 2943, 2943, 2954, 2955, 2956, 2945, 2944, 2944, 2955, 2956,
+2957, 2946, 2945, 2945, 2956, 2957, 2958, 2947, 2948, 2948, 2959, 2958, 2960, 2949, 2947, 2947, 2958, 2960, 2961, 2950, 2949, 2949, 2960, 2961,
+2962, 2951, 2950, 2950, 2961, 2962, 2963, 2952, 2951, 2951, 2962, 2963, 2964, 2953, 2952, 2952, 2963, 2964, 2965, 2954, 2953, 2953, 2964, 2965,
+2966, 2955, 2954, 2954, 2965, 2966, 2967, 2956, 2955, 2955, 2966, 2967, 2968, 2957, 2956, 2956, 2967, 2968, 2969, 2958, 2959, 2959, 2970, 2969,
+2971, 2960, 2958, 2958, 2969, 2971, 2972, 2961, 2960, 2960, 2971, 2972, 2973, 2962, 2961, 2961, 2972, 2973, 2974, 2963, 2962, 2962, 2973, 2974,
+2975, 2964, 2963, 2963, 2974, 2975, 2976, 2965, 2964, 2964, 2975, 2976, 2977, 2966, 2965, 2965, 2976, 2977, 2978, 2967, 2966, 2966, 2977, 2978,
+2979, 2968, 2967, 2967, 2978, 2979, 1239, 2969, 2970, 2970, 940, 1239, 1238, 2971, 2969, 2969, 1239, 1238, 1237, 2972, 2971, 2971, 1238, 1237,
+1236, 2973, 2972, 2972, 1237, 1236, 1235, 2974, 2973, 2973, 1236, 1235, 1234, 2975, 2974, 2974, 1235, 1234, 1233, 2976, 2975, 2975, 1234, 1233,
+1232, 2977, 2976, 2976, 1233, 1232, 1231, 2978, 2977, 2977, 1232, 1231, 1149, 2979, 2978, 2978, 1231, 1149, 2880, 2891, 2980, 2880, 2980, 2981,
+2880, 2981, 2982, 2880, 2982, 2983, 2880, 2983, 2984, 2880, 2984, 2985, 2880, 2985, 2986, 2880, 2986, 2987, 2880, 2987, 2988, 2880, 2988, 2989,
+2990, 2980, 2891, 2891, 2902, 2990, 2991, 2981, 2980, 2980, 2990, 2991, 2992, 2982, 2981, 2981, 2991, 2992, 2993, 2983, 2982, 2982, 2992, 2993,
+2994, 2984, 2983, 2983, 2993, 2994, 2995, 2985, 2984, 2984, 2994, 2995, 2996, 2986, 2985, 2985, 2995, 2996, 2997, 2987, 2986, 2986, 2996, 2997,
+2998, 2988, 2987, 2987, 2997, 2998, 2999, 2989, 2988, 2988, 2998, 2999, 3000, 2990, 2902, 2902, 2913, 3000, 3001, 2991, 2990, 2990, 3000, 3001,
+3002, 2992, 2991, 2991, 3001, 3002, 3003, 2993, 2992, 2992, 3002, 3003, 3004, 2994, 2993, 2993, 3003, 3004, 3005, 2995, 2994, 2994, 3004, 3005,
+3006, 2996, 2995, 2995, 3005, 3006, 3007, 2997, 2996, 2996, 3006, 3007, 3008, 2998, 2997, 2997, 3007, 3008, 3009, 2999, 2998, 2998, 3008, 3009,
+3010, 3000, 2913, 2913, 2924, 3010, 3011, 3001, 3000, 3000, 3010, 3011, 3012, 3002, 3001, 3001, 3011, 3012, 3013, 3003, 3002, 3002, 3012, 3013,
+3014, 3004, 3003, 3003, 3013, 3014, 3015, 3005, 3004, 3004, 3014, 3015, 3016, 3006, 3005, 3005, 3015, 3016, 3017, 3007, 3006, 3006, 3016, 3017,
+3018, 3008, 3007, 3007, 3017, 3018, 3019, 3009, 3008, 3008, 3018, 3019, 3020, 3010, 2924, 2924, 2935, 3020, 3021, 3011, 3010, 3010, 3020, 3021,
+3022, 3012, 3011, 3011, 3021, 3022, 3023, 3013, 3012, 3012, 3022, 3023, 3024, 3014, 3013, 3013, 3023, 3024, 3025, 3015, 3014, 3014, 3024, 3025,
+3026, 3016, 3015, 3015, 3025, 3026, 3027, 3017, 3016, 3016, 3026, 3027, 3028, 3018, 3017, 3017, 3027, 3028, 3029, 3019, 3018, 3018, 3028, 3029,
+3030, 3020, 2935, 2935, 2946, 3030, 3031, 3021, 3020, 3020, 3030, 3031, 3032, 3022, 3021, 3021, 3031, 3032, 3033, 3023, 3022, 3022, 3032, 3033,
+3034, 3024, 3023, 3023, 3033, 3034, 3035, 3025, 3024, 3024, 3034, 3035, 3036, 3026, 3025, 3025, 3035, 3036, 3037, 3027, 3026, 3026, 3036, 3037,
+3038, 3028, 3027, 3027, 3037, 3038, 3039, 3029, 3028, 3028, 3038, 3039, 3040, 3030, 2946, 2946, 2957, 3040, 3041, 3031, 3030, 3030, 3040, 3041,
+3042, 3032, 3031, 3031, 3041, 3042, 3043, 3033, 3032, 3032, 3042, 3043, 3044, 3034, 3033, 3033, 3043, 3044, 3045, 3035, 3034, 3034, 3044, 3045,
+3046, 3036, 3035, 3035, 3045, 3046, 3047, 3037, 3036, 3036, 3046, 3047, 3048, 3038, 3037, 3037, 3047, 3048, 3049, 3039, 3038, 3038, 3048, 3049,
+3050, 3040, 2957, 2957, 2968, 3050, 3051, 3041, 3040, 3040, 3050, 3051, 3052, 3042, 3041, 3041, 3051, 3052, 3053, 3043, 3042, 3042, 3052, 3053,
+3054, 3044, 3043, 3043, 3053, 3054, 3055, 3045, 3044, 3044, 3054, 3055, 3056, 3046, 3045, 3045, 3055, 3056, 3057, 3047, 3046, 3046, 3056, 3057,
+3058, 3048, 3047, 3047, 3057, 3058, 3059, 3049, 3048, 3048, 3058, 3059, 3060, 3050, 2968, 2968, 2979, 3060, 3061, 3051, 3050, 3050, 3060, 3061,
+3062, 3052, 3051, 3051, 3061, 3062, 3063, 3053, 3052, 3052, 3062, 3063, 3064, 3054, 3053, 3053, 3063, 3064, 3065, 3055, 3054, 3054, 3064, 3065,
+3066, 3056, 3055, 3055, 3065, 3066, 3067, 3057, 3056, 3056, 3066, 3067, 3068, 3058, 3057, 3057, 3067, 3068, 3069, 3059, 3058, 3058, 3068, 3069,
+1148, 3060, 2979, 2979, 1149, 1148, 1147, 3061, 3060, 3060, 1148, 1147, 1146, 3062, 3061, 3061, 1147, 1146, 1145, 3063, 3062, 3062, 1146, 1145,
+1144, 3064, 3063, 3063, 1145, 1144, 1143, 3065, 3064, 3064, 1144, 1143, 1142, 3066, 3065, 3065, 1143, 1142, 1141, 3067, 3066, 3066, 1142, 1141,
+1140, 3068, 3067, 3067, 1141, 1140, 1049, 3069, 3068, 3068, 1140, 1049, 2880, 2989, 3070, 2880, 3070, 3071, 2880, 3071, 3072, 2880, 3072, 3073,
+2880, 3073, 3074, 2880, 3074, 3075, 2880, 3075, 3076, 2880, 3076, 3077, 2880, 3077, 3078, 2880, 3078, 3079, 3080, 3070, 2989, 2989, 2999, 3080,
+3081, 3071, 3070, 3070, 3080, 3081, 3082, 3072, 3071, 3071, 3081, 3082, 3083, 3073, 3072, 3072, 3082, 3083, 3084, 3074, 3073, 3073, 3083, 3084,
+3085, 3075, 3074, 3074, 3084, 3085, 3086, 3076, 3075, 3075, 3085, 3086, 3087, 3077, 3076, 3076, 3086, 3087, 3088, 3078, 3077, 3077, 3087, 3088,
+3089, 3079, 3078, 3078, 3088, 3089, 3090, 3080, 2999, 2999, 3009, 3090, 3091, 3081, 3080, 3080, 3090, 3091, 3092, 3082, 3081, 3081, 3091, 3092,
+3093, 3083, 3082, 3082, 3092, 3093, 3094, 3084, 3083, 3083, 3093, 3094, 3095, 3085, 3084, 3084, 3094, 3095, 3096, 3086, 3085, 3085, 3095, 3096,
+3097, 3087, 3086, 3086, 3096, 3097, 3098, 3088, 3087, 3087, 3097, 3098, 3099, 3089, 3088, 3088, 3098, 3099, 3100, 3090, 3009, 3009, 3019, 3100,
+3101, 3091, 3090, 3090, 3100, 3101, 3102, 3092, 3091, 3091, 3101, 3102, 3103, 3093, 3092, 3092, 3102, 3103, 3104, 3094, 3093, 3093, 3103, 3104,
+3105, 3095, 3094, 3094, 3104, 3105, 3106, 3096, 3095, 3095, 3105, 3106, 3107, 3097, 3096, 3096, 3106, 3107, 3108, 3098, 3097, 3097, 3107, 3108,
+3109, 3099, 3098, 3098, 3108, 3109, 3110, 3100, 3019, 3019, 3029, 3110, 3111, 3101, 3100, 3100, 3110, 3111, 3112, 3102, 3101, 3101, 3111, 3112,
+3113, 3103, 3102, 3102, 3112, 3113, 3114, 3104, 3103, 3103, 3113, 3114, 3115, 3105, 3104, 3104, 3114, 3115, 3116, 3106, 3105, 3105, 3115, 3116,
+3117, 3107, 3106, 3106, 3116, 3117, 3118, 3108, 3107, 3107, 3117, 3118, 3119, 3109, 3108, 3108, 3118, 3119, 3120, 3110, 3029, 3029, 3039, 3120,
+3121, 3111, 3110, 3110, 3120, 3121, 3122, 3112, 3111, 3111, 3121, 3122, 3123, 3113, 3112, 3112, 3122, 3123, 3124, 3114, 3113, 3113, 3123, 3124,
+3125, 3115, 3114, 3114, 3124, 3125, 3126, 3116, 3115, 3115, 3125, 3126, 3127, 3117, 3116, 3116, 3126, 3127, 3128, 3118, 3117, 3117, 3127, 3128,
+3129, 3119, 3118, 3118, 3128, 3129, 3130, 3120, 3039, 3039, 3049, 3130, 3131, 3121, 3120, 3120, 3130, 3131, 3132, 3122, 3121, 3121, 3131, 3132,
+3133, 3123, 3122, 3122, 3132, 3133, 3134, 3124, 3123, 3123, 3133, 3134, 3135, 3125, 3124, 3124, 3134, 3135, 3136, 3126, 3125, 3125, 3135, 3136,
+3137, 3127, 3126, 3126, 3136, 3137, 3138, 3128, 3127, 3127, 3137, 3138, 3139, 3129, 3128, 3128, 3138, 3139, 3140, 3130, 3049, 3049, 3059, 3140,
+3141, 3131, 3130, 3130, 3140, 3141, 3142, 3132, 3131, 3131, 3141, 3142, 3143, 3133, 3132, 3132, 3142, 3143, 3144, 3134, 3133, 3133, 3143, 3144,
+3145, 3135, 3134, 3134, 3144, 3145, 3146, 3136, 3135, 3135, 3145, 3146, 3147, 3137, 3136, 3136, 3146, 3147, 3148, 3138, 3137, 3137, 3147, 3148,
+3149, 3139, 3138, 3138, 3148, 3149, 3150, 3140, 3059, 3059, 3069, 3150, 3151, 3141, 3140, 3140, 3150, 3151, 3152, 3142, 3141, 3141, 3151, 3152,
+3153, 3143, 3142, 3142, 3152, 3153, 3154, 3144, 3143, 3143, 3153, 3154, 3155, 3145, 3144, 3144, 3154, 3155, 3156, 3146, 3145, 3145, 3155, 3156,
+3157, 3147, 3146, 3146, 3156, 3157, 3158, 3148, 3147, 3147, 3157, 3158, 3159, 3149, 3148, 3148, 3158, 3159, 1048, 3150, 3069, 3069, 1049, 1048,
+1047, 3151, 3150, 3150, 1048, 1047, 1046, 3152, 3151, 3151, 1047, 1046, 1045, 3153, 3152, 3152, 1046, 1045, 1044, 3154, 3153, 3153, 1045, 1044,
+1043, 3155, 3154, 3154, 1044, 1043, 1042, 3156, 3155, 3155, 1043, 1042, 1041, 3157, 3156, 3156, 1042, 1041, 1040, 3158, 3157, 3157, 1041, 1040,
+949, 3159, 3158, 3158, 1040, 949, 2880, 3079, 3160, 2880, 3160, 3161, 2880, 3161, 3162, 2880, 3162, 3163, 2880, 3163, 3164, 2880, 3164, 3165,
+2880, 3165, 3166, 2880, 3166, 3167, 2880, 3167, 3168, 2880, 3168, 2881, 3169, 3160, 3079, 3079, 3089, 3169, 3170, 3161, 3160, 3160, 3169, 3170,
+3171, 3162, 3161, 3161, 3170, 3171, 3172, 3163, 3162, 3162, 3171, 3172, 3173, 3164, 3163, 3163, 3172, 3173, 3174, 3165, 3164, 3164, 3173, 3174,
+3175, 3166, 3165, 3165, 3174, 3175, 3176, 3167, 3166, 3166, 3175, 3176, 3177, 3168, 3167, 3167, 3176, 3177, 2893, 2881, 3168, 3168, 3177, 2893,
+3178, 3169, 3089, 3089, 3099, 3178, 3179, 3170, 3169, 3169, 3178, 3179, 3180, 3171, 3170, 3170, 3179, 3180, 3181, 3172, 3171, 3171, 3180, 3181,
+3182, 3173, 3172, 3172, 3181, 3182, 3183, 3174, 3173, 3173, 3182, 3183, 3184, 3175, 3174, 3174, 3183, 3184, 3185, 3176, 3175, 3175, 3184, 3185,
+3186, 3177, 3176, 3176, 3185, 3186, 2904, 2893, 3177, 3177, 3186, 2904, 3187, 3178, 3099, 3099, 3109, 3187, 3188, 3179, 3178, 3178, 3187, 3188,
+3189, 3180, 3179, 3179, 3188, 3189, 3190, 3181, 3180, 3180, 3189, 3190, 3191, 3182, 3181, 3181, 3190, 3191, 3192, 3183, 3182, 3182, 3191, 3192,
+3193, 3184, 3183, 3183, 3192, 3193, 3194, 3185, 3184, 3184, 3193, 3194, 3195, 3186, 3185, 3185, 3194, 3195, 2915, 2904, 3186, 3186, 3195, 2915,
+3196, 3187, 3109, 3109, 3119, 3196, 3197, 3188, 3187, 3187, 3196, 3197, 3198, 3189, 3188, 3188, 3197, 3198, 3199, 3190, 3189, 3189, 3198, 3199,
+3200, 3191, 3190, 3190, 3199, 3200, 3201, 3192, 3191, 3191, 3200, 3201, 3202, 3193, 3192, 3192, 3201, 3202, 3203, 3194, 3193, 3193, 3202, 3203,
+3204, 3195, 3194, 3194, 3203, 3204, 2926, 2915, 3195, 3195, 3204, 2926, 3205, 3196, 3119, 3119, 3129, 3205, 3206, 3197, 3196, 3196, 3205, 3206,
+3207, 3198, 3197, 3197, 3206, 3207, 3208, 3199, 3198, 3198, 3207, 3208, 3209, 3200, 3199, 3199, 3208, 3209, 3210, 3201, 3200, 3200, 3209, 3210,
+3211, 3202, 3201, 3201, 3210, 3211, 3212, 3203, 3202, 3202, 3211, 3212, 3213, 3204, 3203, 3203, 3212, 3213, 2937, 2926, 3204, 3204, 3213, 2937,
+3214, 3205, 3129, 3129, 3139, 3214, 3215, 3206, 3205, 3205, 3214, 3215, 3216, 3207, 3206, 3206, 3215, 3216, 3217, 3208, 3207, 3207, 3216, 3217,
+3218, 3209, 3208, 3208, 3217, 3218, 3219, 3210, 3209, 3209, 3218, 3219, 3220, 3211, 3210, 3210, 3219, 3220, 3221, 3212, 3211, 3211, 3220, 3221,
+3222, 3213, 3212, 3212, 3221, 3222, 2948, 2937, 3213, 3213, 3222, 2948, 3223, 3214, 3139, 3139, 3149, 3223, 3224, 3215, 3214, 3214, 3223, 3224,
+3225, 3216, 3215, 3215, 3224, 3225, 3226, 3217, 3216, 3216, 3225, 3226, 3227, 3218, 3217, 3217, 3226, 3227, 3228, 3219, 3218, 3218, 3227, 3228,
+3229, 3220, 3219, 3219, 3228, 3229, 3230, 3221, 3220, 3220, 3229, 3230, 3231, 3222, 3221, 3221, 3230, 3231, 2959, 2948, 3222, 3222, 3231, 2959,
+3232, 3223, 3149, 3149, 3159, 3232, 3233, 3224, 3223, 3223, 3232, 3233, 3234, 3225, 3224, 3224, 3233, 3234, 3235, 3226, 3225, 3225, 3234, 3235,
+3236, 3227, 3226, 3226, 3235, 3236, 3237, 3228, 3227, 3227, 3236, 3237, 3238, 3229, 3228, 3228, 3237, 3238, 3239, 3230, 3229, 3229, 3238, 3239,
+3240, 3231, 3230, 3230, 3239, 3240, 2970, 2959, 3231, 3231, 3240, 2970, 948, 3232, 3159, 3159, 949, 948, 947, 3233, 3232, 3232, 948, 947,
+946, 3234, 3233, 3233, 947, 946, 945, 3235, 3234, 3234, 946, 945, 944, 3236, 3235, 3235, 945, 944, 943, 3237, 3236, 3236, 944, 943,
+942, 3238, 3237, 3237, 943, 942, 941, 3239, 3238, 3238, 942, 941, 939, 3240, 3239, 3239, 941, 939, 940, 2970, 3240, 3240, 939, 940
+};
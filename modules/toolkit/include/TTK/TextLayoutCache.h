@@ -0,0 +1,113 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a least-recently-used cache of laid out strings,
+// so that text that does not change between frames (HUDs, menus, labels)
+// only needs to be laid out once
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <GLM/glm.hpp>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace TTK
+{
+	/*
+	 * Stores a string that has been laid out with a font at a given scale
+	 */
+	struct TextLayout {
+		// A single glyph quad, with positions relative to the origin of the text (already scaled)
+		struct Glyph {
+			glm::vec2 Positions[4];
+			glm::vec2 UVs[4];
+			// The slot in the font's atlas that the glyph is stored in
+			uint32_t  Slot;
+		};
+
+		std::vector<Glyph> Glyphs;
+		// The width of the longest line, and the total height of all lines
+		glm::vec2          Size;
+	};
+
+	class TextLayoutCache {
+	public:
+		/*
+		 * Creates a new layout cache
+		 * @param capacity The maximum number of layouts to keep before the least recently used are evicted
+		 */
+		TextLayoutCache(size_t capacity = DefaultCapacity);
+
+		/*
+		 * Gets the layout for the given text and scale, building it if it is not already in the cache
+		 * @param text The null-terminated text to get the layout for
+		 * @param scale The scale that the text will be laid out at
+		 * @param build A callable taking (TextLayout&) that lays out the text into an empty layout
+		 * @returns The layout, which will stay valid until the next call to Get or Clear
+		 */
+		template <typename Builder>
+		const TextLayout& Get(const char* text, float scale, Builder build) {
+			size_t length = 0;
+			uint64_t key = __Hash(text, length, scale);
+
+			auto it = m_Lookup.find(key);
+			if (it != m_Lookup.end()) {
+				Entry& entry = *it->second;
+				// Different strings can hash to the same key, in which case the old layout is simply replaced
+				if (entry.Scale == scale && entry.Text.compare(0, std::string::npos, text, length) == 0) {
+					m_Entries.splice(m_Entries.begin(), m_Entries, it->second);
+					return entry.Layout;
+				}
+				m_Entries.erase(it->second);
+				m_Lookup.erase(it);
+			}
+
+			if (m_Entries.size() >= m_Capacity)
+				__EvictOldest();
+
+			m_Entries.push_front(Entry());
+			Entry& entry = m_Entries.front();
+			entry.Key = key;
+			entry.Text.assign(text, length);
+			entry.Scale = scale;
+			build(entry.Layout);
+			m_Lookup[key] = m_Entries.begin();
+			return entry.Layout;
+		}
+
+		/*
+		 * Removes all layouts from the cache, this should be called if the glyphs for a font have changed
+		 */
+		void Clear();
+
+		size_t GetSize() const { return m_Entries.size(); }
+		size_t GetCapacity() const { return m_Capacity; }
+		void SetCapacity(size_t capacity);
+
+		static const size_t DefaultCapacity = 256;
+
+	private:
+		struct Entry {
+			uint64_t    Key;
+			std::string Text;
+			float       Scale;
+			TextLayout  Layout;
+		};
+
+		// Most recently used entries are at the front
+		std::list<Entry> m_Entries;
+		std::unordered_map<uint64_t, std::list<Entry>::iterator> m_Lookup;
+		size_t m_Capacity;
+
+		void __EvictOldest();
+		static uint64_t __Hash(const char* text, size_t& length, float scale);
+	};
+}
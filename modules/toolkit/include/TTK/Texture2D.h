@@ -16,8 +16,13 @@
 #include <string>
 #include "glad/glad.h"
 #include <memory>
+#include <cstdint>
+#include <functional>
+#include <future>
 
 namespace TTK {
+	class StreamingBuffer;
+
 	class  Texture2D
 	{
 	public:
@@ -33,6 +38,10 @@ namespace TTK {
 		 * CreateTexture and LoadTextureFromFile
 		 */
 		Texture2D(int _id, int _width, int _height, GLenum target);
+
+		// Textures own their GPU storage, so they cannot be copied
+		Texture2D(const Texture2D&) = delete;
+		Texture2D& operator=(const Texture2D&) = delete;
 		/*
 		 * Destroys a texture and cleans up it's underlying data on the GPU
 		 */
@@ -69,12 +78,34 @@ namespace TTK {
 		 * @param filePath The path to the file relative to the current working directory
 		 */
 		void LoadTextureFromFile(const std::string& filePath);
+		/*
+		 * Gets a texture loaded from the given file, which is shared with everyone else that has loaded that file
+		 * through this function. Call ResourceRegistry<Texture2D>::Instance().UnloadUnused() to release textures
+		 * that are no longer in use
+		 * @param filePath The path to the file relative to the current working directory
+		 */
+		static Ptr LoadShared(const std::string& filePath);
 
 		/*
-		 * Creates the texture, allocates memory and uploads data to GPU
+		 * Starts loading a texture file in the background. Until the image has been decoded and uploaded, this
+		 * texture will refer to the shared placeholder texture. Call TTK::Graphics::EndFrame (or pump the
+		 * AsyncTextureLoader yourself) each frame so that the load can make progress
+		 * @param filePath The path to the file relative to the current working directory
+		 * @param onLoaded A callback to invoke once the texture is resident, or has failed to load
+		 * @returns A future that resolves to true when the texture is resident
+		 */
+		std::shared_future<bool> LoadTextureFromFileAsync(const std::string& filePath, const std::function<void(Texture2D&, bool)>& onLoaded = nullptr);
+		/*
+		 * Returns true if this texture is not waiting on a background load
+		 */
+		bool IsLoaded() const { return m_LoadHandle == 0; }
+
+		/*
+		 * Creates the texture, allocates immutable storage and uploads data to GPU
 		 * If you do not want to upload data to the GPU pass in a nullptr for the dataPtr.
+		 * The storage of a texture cannot be resized, calling this again will replace the texture with a new one
 		 * For a description on filtering and edgeBehaviour see https://www.khronos.org/opengles/sdk/docs/man/xhtml/glTexParameter.xml
-		 * For a description on internalFormat, textureFormat and dataType see https://www.opengl.org/sdk/docs/man/html/glTexImage2D.xhtml
+		 * For a description on internalFormat, textureFormat and dataType see https://www.khronos.org/registry/OpenGL-Refpages/gl4/html/glTexStorage2D.xhtml
 		 *
 		 * @param w The width of the texture, in pixels
 		 * @param h The height of the texture, in pixels
@@ -88,11 +119,29 @@ namespace TTK {
 		void CreateTexture(int w, int h, GLenum target, GLenum filtering, GLenum edgeBehaviour, GLenum internalFormat, GLenum textureFormat, GLenum dataType, void* data);
 
 		/*
-		 * Uploads new data to a texture, using it's saved internal format and data types
+		 * Uploads new data to a texture, using it's saved internal format and data types. This copies the data before
+		 * returning, which can stall if the GPU is still using the texture. Use StreamTexture for per-frame updates
 		 * @param newDataPtr The new data to write to the texture
 		 */
 		void UpdateTexture(void* newDataPtr = nullptr);
 
+		/*
+		 * Streams new data to the entire texture, see StreamSubImage
+		 * @param data The new data to write to the texture, in the texture's format and data type
+		 */
+		void StreamTexture(const void* data) { StreamSubImage(0, 0, m_TexWidth, m_TexHeight, data); }
+		/*
+		 * Streams new data to a region of the texture. The data is copied into a ring of persistently mapped pixel
+		 * unpack buffers, and the GPU performs the upload asynchronously, so this will only block if we get more than
+		 * a few texture's worth of updates ahead of the GPU. The data can be reused as soon as this returns
+		 * @param x The left edge of the region to update, in pixels
+		 * @param y The bottom edge of the region to update, in pixels
+		 * @param width The width of the region, in pixels
+		 * @param height The height of the region, in pixels
+		 * @param data The tightly packed pixels of the region, in the texture's format and data type
+		 */
+		void StreamSubImage(int x, int y, int width, int height, const void* data);
+
 		/*
 		 * Returns the underlying OpenGL texture ID for this texture
 		 */
@@ -110,6 +159,13 @@ namespace TTK {
 		GLenum m_DataType;
 
 		GLenum m_Target; // usually GL_TEXTURE_2D
+
+		uint32_t m_LoadHandle; // The handle of our pending async load, or 0
+		bool     m_IsPlaceholder; // True while m_TexID is the loader's shared placeholder, which we must never delete
+
+		std::unique_ptr<StreamingBuffer> m_Stream; // Created the first time the texture is streamed to
+
+		void __ReleaseTexture();
 	};
 }
 
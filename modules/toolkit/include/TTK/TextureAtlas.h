@@ -0,0 +1,145 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a packer that combines many small images into a
+// few large atlas pages, so that sprites and materials that use them can
+// share texture bindings. Pages can be stored as separate 2D textures (to
+// be used with the SpriteBatch) or as the layers of a single 2D array
+// texture. Packed atlases can also be saved to disk and loaded later, so
+// that the packing can be done offline
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <GLM/glm.hpp>
+#include "glad/glad.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace TTK
+{
+	/*
+	 * The area of an atlas that an image was packed into
+	 */
+	struct AtlasRegion {
+		glm::vec4  UVRect; // The normalized area of the page, as (uMin, vMin, uMax, vMax)
+		uint32_t   Layer;  // The page (or array layer) that the image is on
+		glm::ivec2 Size;   // The size of the image in pixels
+	};
+
+	/*
+	 * How the pages of an atlas are stored on the GPU
+	 */
+	enum class AtlasStorage {
+		// Each page is a separate GL_TEXTURE_2D, see GetPageTexture
+		Pages,
+		// All pages are layers of a single GL_TEXTURE_2D_ARRAY, see GetArrayTexture
+		Array
+	};
+
+	class TextureAtlas {
+	public:
+		typedef std::shared_ptr<TextureAtlas> Ptr;
+		typedef uint32_t Handle;
+		static const Handle InvalidHandle = 0xFFFFFFFF;
+
+		/*
+		 * Creates a new empty atlas
+		 * @param pageSize The width and height of each page in pixels
+		 * @param padding The number of pixels around each image, which are filled with the image's edges to avoid bleeding.
+		 *                This also limits the number of mip levels, to log2(padding) + 1 (so 2 levels for the default)
+		 */
+		TextureAtlas(int pageSize = 2048, int padding = 2);
+		~TextureAtlas();
+
+		TextureAtlas(const TextureAtlas&) = delete;
+		TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+		/*
+		 * Adds an image to be packed the next time Build is called
+		 * @param name The name to look the image up by, see Find
+		 * @param fileName The path to the image to load
+		 * @returns A handle to the image, which can be used to get it's region once the atlas has been built
+		 */
+		Handle Add(const std::string& name, const std::string& fileName);
+		/*
+		 * Adds an image from memory to be packed the next time Build is called
+		 * @param name The name to look the image up by, see Find
+		 * @param rgba The image data, with 4 bytes per pixel, this is copied
+		 * @param width The width of the image in pixels
+		 * @param height The height of the image in pixels
+		 */
+		Handle Add(const std::string& name, const uint8_t* rgba, int width, int height);
+
+		/*
+		 * Packs all the images that have been added and uploads the pages to the GPU. The CPU side copies of the
+		 * images are kept, so more images can be added and the atlas rebuilt (which may move existing regions). Anything
+		 * that caches regions should compare GetBuildCount to notice this, Tilemaps do this for you
+		 * @param storage How the pages should be stored on the GPU
+		 * @returns True if every image could be packed. If any region is missing it's image, nothing is repacked
+		 *          and the existing pages are kept
+		 */
+		bool Build(AtlasStorage storage = AtlasStorage::Pages);
+
+		/*
+		 * Saves the packed pages as PNGs (<basePath>_<page>.png) along with a manifest (<basePath>.atlas) that
+		 * describes where each image was packed. This must be called after Build
+		 */
+		bool Save(const std::string& basePath) const;
+		/*
+		 * Loads an atlas that was saved with Save, without needing to repack the images. Each region's image is
+		 * copied back out of it's page, so more images can be added and the atlas rebuilt just like before it was saved
+		 * @param manifestPath The path to the .atlas manifest
+		 * @param storage How the pages should be stored on the GPU
+		 */
+		static Ptr Load(const std::string& manifestPath, AtlasStorage storage = AtlasStorage::Pages);
+
+		const AtlasRegion& GetRegion(Handle handle) const { return m_Regions[handle]; }
+		Handle Find(const std::string& name) const;
+		size_t GetRegionCount() const { return m_Regions.size(); }
+
+		// Gets the number of times the atlas has been built, this changes whenever regions may have moved
+		uint32_t GetBuildCount() const { return m_BuildCount; }
+		uint32_t GetPageCount() const { return m_PageCount; }
+		int GetPageSize() const { return m_PageSize; }
+		AtlasStorage GetStorage() const { return m_Storage; }
+		// Gets the texture for a page, only valid for AtlasStorage::Pages
+		GLuint GetPageTexture(uint32_t page) const { return page < m_PageTextures.size() ? m_PageTextures[page] : 0; }
+		// Gets the array texture containing all pages, only valid for AtlasStorage::Array
+		GLuint GetArrayTexture() const { return m_ArrayTexture; }
+
+	private:
+		struct Image {
+			std::vector<uint8_t> Pixels;
+			int                  Width, Height;
+		};
+
+		int          m_PageSize;
+		int          m_Padding;
+		uint32_t     m_PageCount;
+		uint32_t     m_BuildCount;
+		AtlasStorage m_Storage;
+
+		std::vector<AtlasRegion>                m_Regions;
+		std::vector<std::string>                m_Names;
+		std::unordered_map<std::string, Handle> m_Lookup;
+		// The images waiting to be packed, indexed by handle
+		std::vector<Image>                      m_Images;
+		// The packed pages, kept so that they can be saved
+		std::vector<std::vector<uint8_t>>       m_Pages;
+
+		std::vector<GLuint> m_PageTextures;
+		GLuint              m_ArrayTexture;
+
+		Handle __AddRegion(const std::string& name);
+		void __Upload(AtlasStorage storage);
+		void __ReleaseTextures();
+	};
+}
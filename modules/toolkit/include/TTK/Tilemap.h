@@ -0,0 +1,116 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a renderer for large grids of tiles. Tiles are
+// stored in fixed size chunks, each of which is baked into a static
+// vertex buffer that is only rebuilt when one of it's tiles changes.
+// Chunks that are outside of the camera's view are skipped entirely
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <GLM/glm.hpp>
+#include "glad/glad.h"
+#include "TextureAtlas.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace TTK
+{
+	class Tilemap {
+	public:
+		typedef std::shared_ptr<Tilemap> Ptr;
+
+		// The width and height of each chunk, in tiles
+		static const uint32_t ChunkSize = 32;
+
+		/*
+		 * Creates a new empty tilemap
+		 * @param width The width of the map, in tiles
+		 * @param height The height of the map, in tiles
+		 * @param tileSize The size of a single tile in world units
+		 * @param atlas The atlas that tiles are drawn from, this must use AtlasStorage::Array so that every tile can
+		 *              be drawn with a single binding
+		 */
+		Tilemap(uint32_t width, uint32_t height, const glm::vec2& tileSize, const TextureAtlas::Ptr& atlas);
+		~Tilemap();
+
+		Tilemap(const Tilemap&) = delete;
+		Tilemap& operator=(const Tilemap&) = delete;
+
+		/*
+		 * Sets the atlas region shown by a tile, the tile's chunk will be rebuilt the next time it is drawn
+		 * @param x The column of the tile, with 0 being the left of the map
+		 * @param y The row of the tile, with 0 being the bottom of the map
+		 * @param region The region of the atlas to show, or TextureAtlas::InvalidHandle to clear the tile
+		 */
+		void SetTile(uint32_t x, uint32_t y, TextureAtlas::Handle region);
+		TextureAtlas::Handle GetTile(uint32_t x, uint32_t y) const;
+
+		/*
+		 * Rebuilds every chunk the next time it is drawn. Chunks already notice when their atlas is rebuilt, so this
+		 * is only needed if the atlas is changed in some other way
+		 */
+		void MarkAllDirty();
+
+		// Sets the world position of the bottom left corner of the map
+		void SetOrigin(const glm::vec2& origin) { m_Origin = origin; }
+		const glm::vec2& GetOrigin() const { return m_Origin; }
+
+		uint32_t GetWidth() const { return m_Width; }
+		uint32_t GetHeight() const { return m_Height; }
+		const glm::vec2& GetTileSize() const { return m_TileSize; }
+
+		/*
+		 * Draws every chunk that overlaps the given view rectangle, with one draw call per chunk
+		 * @param viewProjection The matrix that transforms world space into clip space
+		 * @param viewMin The bottom left corner of the visible area, in world space
+		 * @param viewMax The top right corner of the visible area, in world space
+		 */
+		void Draw(const glm::mat4& viewProjection, const glm::vec2& viewMin, const glm::vec2& viewMax);
+
+		/*
+		 * Releases the shader that is shared between all tilemaps, this is called by TTK::Graphics::Cleanup
+		 */
+		static void DestroyContext();
+
+	private:
+		struct TileVert {
+			glm::vec2 Position;
+			glm::vec2 UV;
+			uint16_t  Layer;
+			uint16_t  Padding;
+		};
+
+		struct Chunk {
+			std::vector<TextureAtlas::Handle> Tiles;
+			GLuint  VBO;
+			GLsizei QuadCount;
+			GLsizei QuadCapacity;
+			bool    Dirty;
+		};
+
+		uint32_t  m_Width, m_Height;
+		uint32_t  m_ChunksX, m_ChunksY;
+		glm::vec2 m_TileSize;
+		glm::vec2 m_Origin;
+		TextureAtlas::Ptr  m_Atlas;
+		// The atlas build our chunks were baked from, rebuilding the atlas may move the regions they use
+		uint32_t           m_AtlasBuild;
+		std::vector<Chunk> m_Chunks;
+
+		// Every chunk shares the same quad indices and vertex format, so we only swap the vertex buffer between chunks
+		GLuint m_VAO, m_EBO;
+
+		void __RebuildChunk(uint32_t chunkX, uint32_t chunkY);
+
+		// The shader is shared between every tilemap
+		static GLuint __GetShader();
+		inline static GLuint m_Shader = 0;
+	};
+}
@@ -0,0 +1,167 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This header is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this header in your GDW games.
+//
+// This header contains a descriptor for the layout of vertex data in a
+// buffer, along with helpers for packing data into the compact formats it
+// supports (RGBA8 colors, half floats and 2_10_10_10 vectors). It is header
+// only, so that it can be shared with modules that do not link against TTK
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "glad/glad.h"
+#include <GLM/glm.hpp>
+#include <GLM/gtc/packing.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace TTK
+{
+	/*
+	 * Describes a single attribute within a vertex layout
+	 */
+	struct VertexAttribute {
+		GLuint Location;   // The location relative to where the layout is applied
+		GLint  Components; // The number of components, or 4 for the packed 2_10_10_10 types
+		GLenum Type;       // The GL type of each component
+		bool   Normalized; // Whether integer types should be normalized to [0, 1] or [-1, 1]
+		GLuint Offset;     // The offset in bytes from the start of the vertex
+	};
+
+	/*
+	 * Describes how the attributes of a vertex are laid out in a buffer. Attributes are added in order, and
+	 * will be tightly packed unless an explicit offset is given. The stride defaults to the size of all the
+	 * attributes, but can be given explicitly for interleaved buffers with padding
+	 */
+	class VertexLayout {
+	public:
+		/*
+		 * Creates a new empty vertex layout
+		 * @param stride The stride between vertices in bytes, or 0 to use the tightly packed size
+		 * @param divisor The instance divisor for the layout, 0 for per-vertex data
+		 */
+		VertexLayout(GLsizei stride = 0, GLuint divisor = 0) :
+			m_Attributes(),
+			m_Stride(stride),
+			m_PackedSize(0),
+			m_Divisor(divisor)
+		{ }
+
+		/*
+		 * Adds a generic attribute to the layout
+		 * @param location The attribute location, relative to the location the layout is applied at
+		 * @param components The number of components in the attribute
+		 * @param type The GL type of the components (ex GL_FLOAT, GL_HALF_FLOAT, GL_UNSIGNED_BYTE)
+		 * @param normalized True if integer values should be normalized when read by the shader
+		 * @param offset The offset of the attribute in bytes, or -1 to place it after the previous attribute
+		 */
+		VertexLayout& Add(GLuint location, GLint components, GLenum type, bool normalized = false, GLint offset = -1) {
+			GLuint realOffset = offset < 0 ? m_PackedSize : static_cast<GLuint>(offset);
+			m_Attributes.push_back({ location, components, type, normalized, realOffset });
+			m_PackedSize = glm::max(m_PackedSize, realOffset + GetAttributeSize(type, components));
+			return *this;
+		}
+
+		// Adds an attribute of 1-4 32 bit floats
+		VertexLayout& Float(GLuint location, GLint components, GLint offset = -1) { return Add(location, components, GL_FLOAT, false, offset); }
+		// Adds an attribute of 1-4 16 bit floats, see PackHalf2
+		VertexLayout& Half(GLuint location, GLint components, GLint offset = -1) { return Add(location, components, GL_HALF_FLOAT, false, offset); }
+		// Adds a normalized RGBA8 color, see PackRGBA8
+		VertexLayout& RGBA8(GLuint location, GLint offset = -1) { return Add(location, 4, GL_UNSIGNED_BYTE, true, offset); }
+		// Adds a signed normalized 2_10_10_10 vector (ex a normal or tangent), see PackSnorm1010102
+		VertexLayout& Snorm1010102(GLuint location, GLint offset = -1) { return Add(location, 4, GL_INT_2_10_10_10_REV, true, offset); }
+
+		const std::vector<VertexAttribute>& GetAttributes() const { return m_Attributes; }
+		GLsizei GetStride() const { return m_Stride != 0 ? m_Stride : static_cast<GLsizei>(m_PackedSize); }
+		GLuint GetDivisor() const { return m_Divisor; }
+
+		/*
+		 * Applies this layout to a vertex array object using the direct state access functions. This only sets up the
+		 * formats, so the buffer can be swapped out later with glVertexArrayVertexBuffer
+		 * @param vao The vertex array to set up
+		 * @param binding The buffer binding index that the attributes will source from
+		 * @param baseLocation The location that attribute locations are relative to
+		 */
+		void Apply(GLuint vao, GLuint binding, GLuint baseLocation = 0) const {
+			for (const VertexAttribute& attrib : m_Attributes) {
+				GLuint location = baseLocation + attrib.Location;
+				glEnableVertexArrayAttrib(vao, location);
+				glVertexArrayAttribFormat(vao, location, attrib.Components, attrib.Type, attrib.Normalized, attrib.Offset);
+				glVertexArrayAttribBinding(vao, location, binding);
+			}
+			glVertexArrayBindingDivisor(vao, binding, m_Divisor);
+		}
+
+		/*
+		 * Applies this layout to the currently bound vertex array, sourcing from the buffer bound to GL_ARRAY_BUFFER
+		 * @param bufferOffset The offset in bytes to the first vertex in the buffer
+		 * @param baseLocation The location that attribute locations are relative to
+		 */
+		void ApplyPointer(GLintptr bufferOffset = 0, GLuint baseLocation = 0) const {
+			for (const VertexAttribute& attrib : m_Attributes) {
+				GLuint location = baseLocation + attrib.Location;
+				glEnableVertexAttribArray(location);
+				glVertexAttribPointer(location, attrib.Components, attrib.Type, attrib.Normalized, GetStride(),
+					reinterpret_cast<const void*>(bufferOffset + attrib.Offset));
+				glVertexAttribDivisor(location, m_Divisor);
+			}
+		}
+
+		/*
+		 * Gets the size in bytes of an attribute
+		 * @param type The GL type of the attribute
+		 * @param components The number of components in the attribute
+		 */
+		static GLuint GetAttributeSize(GLenum type, GLint components) {
+			switch (type) {
+				case GL_BYTE:
+				case GL_UNSIGNED_BYTE:
+					return components;
+				case GL_SHORT:
+				case GL_UNSIGNED_SHORT:
+				case GL_HALF_FLOAT:
+					return components * 2;
+				// The packed types store all 4 components in a single 32 bit value
+				case GL_INT_2_10_10_10_REV:
+				case GL_UNSIGNED_INT_2_10_10_10_REV:
+				case GL_UNSIGNED_INT_10F_11F_11F_REV:
+					return 4;
+				case GL_DOUBLE:
+					return components * 8;
+				default:
+					return components * 4;
+			}
+		}
+
+	private:
+		std::vector<VertexAttribute> m_Attributes;
+		GLsizei m_Stride;
+		GLuint  m_PackedSize;
+		GLuint  m_Divisor;
+	};
+
+	/*
+	 * Packs a color into 8 bits per channel, to be read with VertexLayout::RGBA8
+	 */
+	inline uint32_t PackRGBA8(const glm::vec4& color) {
+		return glm::packUnorm4x8(color);
+	}
+
+	/*
+	 * Packs a unit vector into a signed normalized 2_10_10_10 value, to be read with VertexLayout::Snorm1010102
+	 */
+	inline uint32_t PackSnorm1010102(const glm::vec3& value, float w = 0.0f) {
+		return glm::packSnorm3x10_1x2(glm::vec4(value, w));
+	}
+
+	/*
+	 * Packs a pair of floats into 16 bit floats, to be read with VertexLayout::Half
+	 */
+	inline uint32_t PackHalf2(const glm::vec2& value) {
+		return glm::packHalf2x16(value);
+	}
+}
@@ -0,0 +1,285 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this file in your GDW games.
+//
+// This file implements the TTK background texture loader
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#include "TTK/AsyncTextureLoader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include "stb_image.h"
+#include "Logging.h"
+#include "TTK/GLState.h"
+#include "TTK/StreamingBuffer.h"
+
+TTK::AsyncTextureLoader* TTK::AsyncTextureLoader::m_Instance = nullptr;
+
+// Flips an RGBA8 image upside down in place
+static void __FlipRows(uint8_t* pixels, int width, int height) {
+	const size_t rowBytes = (size_t)width * 4;
+	std::vector<uint8_t> temp(rowBytes);
+	for (int row = 0; row < height / 2; row++) {
+		uint8_t* top = pixels + row * rowBytes;
+		uint8_t* bottom = pixels + (height - 1 - row) * rowBytes;
+		memcpy(temp.data(), top, rowBytes);
+		memcpy(top, bottom, rowBytes);
+		memcpy(bottom, temp.data(), rowBytes);
+	}
+}
+
+TTK::AsyncTextureLoader::AsyncTextureLoader() {
+	LOG_INFO("Initializing async texture loader");
+
+	m_Stopping = false;
+
+	// The placeholder is a small magenta and black checkerboard, so that missing textures stand out
+	const uint32_t checker[4] = { 0xFFFF00FF, 0xFF000000, 0xFF000000, 0xFFFF00FF };
+	glCreateTextures(GL_TEXTURE_2D, 1, &m_Placeholder);
+	glTextureStorage2D(m_Placeholder, 1, GL_RGBA8, 2, 2);
+	glTextureSubImage2D(m_Placeholder, 0, 0, 0, 2, 2, GL_RGBA, GL_UNSIGNED_BYTE, checker);
+	glTextureParameteri(m_Placeholder, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTextureParameteri(m_Placeholder, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTextureParameteri(m_Placeholder, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTextureParameteri(m_Placeholder, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+	// Our staging memory is a byte-sized streaming buffer, which gives us a fenced ring of pixel unpack space
+	m_Stream = new StreamingBuffer(1, UploadBytesPerFrame);
+
+	// Leave one core for the main thread, but always have at least one worker
+	unsigned int workerCount = std::thread::hardware_concurrency();
+	workerCount = workerCount > 1 ? workerCount - 1 : 1;
+	for (unsigned int ix = 0; ix < workerCount; ix++)
+		m_Workers.emplace_back(&AsyncTextureLoader::__WorkerMain, this);
+}
+
+TTK::AsyncTextureLoader::~AsyncTextureLoader() {
+	LOG_INFO("Shutting down async texture loader");
+
+	{
+		std::lock_guard<std::mutex> lock(m_QueueLock);
+		m_Stopping = true;
+	}
+	m_QueueSignal.notify_all();
+	for (std::thread& worker : m_Workers)
+		worker.join();
+
+	// Anything still in flight is failed, without invoking the callbacks, since their owners may already be gone
+	for (auto& kvp : m_Jobs) {
+		Job& job = *kvp.second;
+		stbi_image_free(job.Pixels);
+		job.Pixels = nullptr;
+		GLState::DeleteTextures(1, &job.Texture);
+		job.Promise.set_value(false);
+	}
+	for (JobPtr& job : m_Uploads)
+		stbi_image_free(job->Pixels);
+	for (JobPtr& job : m_Decoded)
+		stbi_image_free(job->Pixels);
+	m_Jobs.clear();
+	m_Uploads.clear();
+	m_Decoded.clear();
+	m_DecodeQueue.clear();
+
+	delete m_Stream;
+	GLState::DeleteTextures(1, &m_Placeholder);
+}
+
+TTK::AsyncTextureLoader::Ticket TTK::AsyncTextureLoader::Load(const std::string& filePath, const Callback& onResident, bool flipVertically,
+	GLenum filtering, GLenum edgeBehaviour, const MipGenerator& generateMips) {
+	JobPtr job = std::make_shared<Job>();
+	job->Id = m_NextHandle++;
+	job->Path = filePath;
+	job->Flip = flipVertically;
+	job->Filtering = filtering;
+	job->EdgeBehaviour = edgeBehaviour;
+	job->OnResident = onResident;
+	job->GenerateMips = generateMips;
+	job->Cancelled = false;
+	job->Pixels = nullptr;
+	job->Width = 0;
+	job->Height = 0;
+	job->Texture = 0;
+	job->Level = 0;
+	job->RowsUploaded = 0;
+	job->Uploaded = false;
+
+	Ticket result;
+	result.Id = job->Id;
+	result.Resident = job->Promise.get_future().share();
+
+	m_Jobs[job->Id] = job;
+	{
+		std::lock_guard<std::mutex> lock(m_QueueLock);
+		m_DecodeQueue.push_back(job);
+	}
+	m_QueueSignal.notify_one();
+
+	return result;
+}
+
+void TTK::AsyncTextureLoader::Cancel(Handle handle) {
+	auto it = m_Jobs.find(handle);
+	if (it == m_Jobs.end())
+		return;
+
+	// The worker or upload queue still holds a reference, it will drop the job once it sees the flag
+	Job& job = *it->second;
+	job.Cancelled = true;
+	GLState::DeleteTextures(1, &job.Texture);
+	job.Texture = 0;
+	job.Promise.set_value(false);
+	m_Jobs.erase(it);
+}
+
+void TTK::AsyncTextureLoader::Pump(float budgetMs) {
+	typedef std::chrono::high_resolution_clock Clock;
+	const Clock::time_point start = Clock::now();
+
+	// Take ownership of everything the workers have finished decoding
+	{
+		std::lock_guard<std::mutex> lock(m_QueueLock);
+		for (JobPtr& job : m_Decoded)
+			m_Uploads.push_back(job);
+		m_Decoded.clear();
+	}
+
+	if (m_Uploads.empty())
+		return;
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_Stream->GetHandle());
+
+	while (!m_Uploads.empty()) {
+		JobPtr job = m_Uploads.front();
+
+		if (job->Cancelled) {
+			stbi_image_free(job->Pixels);
+			job->Pixels = nullptr;
+			m_Uploads.pop_front();
+			continue;
+		}
+
+		if (job->Pixels == nullptr) {
+			LOG_WARN("Failed to load texture from \"{}\"", job->Path);
+			m_Uploads.pop_front();
+			__Complete(job, false);
+			continue;
+		}
+
+		if (!__UploadRows(*job, UploadBytesPerFrame - m_Stream->Count()))
+			break; // The staging ring is full for this frame
+
+		if (job->Uploaded) {
+			m_Uploads.pop_front();
+			__Complete(job, true);
+		}
+
+		float elapsedMs = std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+		if (elapsedMs >= budgetMs)
+			break;
+	}
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	m_Stream->EndFrame();
+}
+
+bool TTK::AsyncTextureLoader::__UploadRows(Job& job, size_t available) {
+	// Level 0 is the decoded image, the rest come from the mip generator
+	const int width = job.Level == 0 ? job.Width : job.Mips[job.Level - 1].Width;
+	const int height = job.Level == 0 ? job.Height : job.Mips[job.Level - 1].Height;
+	const uint8_t* pixels = job.Level == 0 ? job.Pixels : job.Mips[job.Level - 1].Pixels.data();
+
+	// We copy at most a chunk at a time so that Pump can check it's time budget, but always at least one row
+	const size_t rowBytes = (size_t)width * 4;
+	const size_t maxBytes = std::min(available, std::max(ChunkBytes, rowBytes));
+	const int count = std::min((int)(maxBytes / rowBytes), height - job.RowsUploaded);
+	if (count <= 0)
+		return false;
+
+	if (job.Texture == 0) {
+		const GLsizei levels = static_cast<GLsizei>(job.Mips.size()) + 1;
+		GLenum minFilter = job.Filtering;
+		if (levels > 1)
+			minFilter = job.Filtering == GL_NEAREST ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR;
+
+		glCreateTextures(GL_TEXTURE_2D, 1, &job.Texture);
+		glTextureStorage2D(job.Texture, levels, GL_RGBA8, job.Width, job.Height);
+		glTextureParameteri(job.Texture, GL_TEXTURE_MIN_FILTER, minFilter);
+		glTextureParameteri(job.Texture, GL_TEXTURE_MAG_FILTER, job.Filtering);
+		glTextureParameteri(job.Texture, GL_TEXTURE_WRAP_S, job.EdgeBehaviour);
+		glTextureParameteri(job.Texture, GL_TEXTURE_WRAP_T, job.EdgeBehaviour);
+	}
+
+	// The worker has already flipped the image (and built the mips from the flipped image), so rows copy straight over
+	const size_t offset = m_Stream->FirstByte() + m_Stream->Count();
+	uint8_t* dest = m_Stream->Reserve<uint8_t>(count * rowBytes);
+	memcpy(dest, pixels + job.RowsUploaded * rowBytes, count * rowBytes);
+
+	// With an unpack buffer bound, the data pointer is an offset into the buffer
+	glTextureSubImage2D(job.Texture, job.Level, 0, job.RowsUploaded, width, count, GL_RGBA, GL_UNSIGNED_BYTE, (const void*)offset);
+	job.RowsUploaded += count;
+
+	if (job.RowsUploaded == height) {
+		if (job.Level < static_cast<int>(job.Mips.size())) {
+			job.Level++;
+			job.RowsUploaded = 0;
+		} else
+			job.Uploaded = true;
+	}
+	return true;
+}
+
+void TTK::AsyncTextureLoader::__Complete(const JobPtr& job, bool success) {
+	stbi_image_free(job->Pixels);
+	job->Pixels = nullptr;
+	job->Mips.clear();
+	m_Jobs.erase(job->Id);
+
+	LoadedTexture result;
+	result.Texture = success ? job->Texture : 0;
+	result.Width = job->Width;
+	result.Height = job->Height;
+	result.Success = success;
+	if (!success)
+		GLState::DeleteTextures(1, &job->Texture);
+	job->Texture = 0;
+
+	job->Promise.set_value(success);
+	if (job->OnResident)
+		job->OnResident(result);
+}
+
+void TTK::AsyncTextureLoader::__WorkerMain() {
+	while (true) {
+		JobPtr job;
+		{
+			std::unique_lock<std::mutex> lock(m_QueueLock);
+			m_QueueSignal.wait(lock, [this]() { return m_Stopping || !m_DecodeQueue.empty(); });
+			if (m_Stopping)
+				return;
+			job = m_DecodeQueue.front();
+			m_DecodeQueue.pop_front();
+		}
+
+		if (!job->Cancelled) {
+			// We always decode to RGBA so that every row is 4 byte aligned, and we can use a single internal format
+			int channels = 0;
+			job->Pixels = stbi_load(job->Path.c_str(), &job->Width, &job->Height, &channels, STBI_rgb_alpha);
+
+			// Flipping is done here rather than by stb, since stb's flip setting is global and not safe to change from the workers
+			if (job->Pixels != nullptr && job->Flip)
+				__FlipRows(job->Pixels, job->Width, job->Height);
+
+			if (job->Pixels != nullptr && job->GenerateMips)
+				job->Mips = job->GenerateMips(job->Pixels, job->Width, job->Height);
+		}
+
+		std::lock_guard<std::mutex> lock(m_QueueLock);
+		m_Decoded.push_back(job);
+	}
+}
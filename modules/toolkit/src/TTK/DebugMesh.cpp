@@ -0,0 +1,100 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this file in your GDW games.
+//
+// This file implements the TTK retained debug mesh
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#include "TTK/DebugMesh.h"
+
+#include <limits>
+#include "Logging.h"
+#include "TTK/GLState.h"
+
+TTK::DebugMesh::DebugMesh() :
+	m_Buffer(0),
+	m_SimpleVAO(0),
+	m_PointVAO(0),
+	m_TriCount(0),
+	m_LineCount(0),
+	m_PointCount(0),
+	m_BoundsCenter(0.0f),
+	m_BoundsRadius(0.0f)
+{ }
+
+TTK::DebugMesh::~DebugMesh() {
+	glDeleteBuffers(1, &m_Buffer);
+	GLState::DeleteVertexArrays(1, &m_SimpleVAO);
+	GLState::DeleteVertexArrays(1, &m_PointVAO);
+}
+
+void TTK::DebugMesh::AddLine(const glm::vec3& a, const glm::vec3& b, const glm::vec4& color) {
+	uint32_t packed = PackRGBA8(color);
+	m_LineVerts.push_back({ a, packed });
+	m_LineVerts.push_back({ b, packed });
+}
+
+void TTK::DebugMesh::AddTri(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c, const glm::vec4& color) {
+	uint32_t packed = PackRGBA8(color);
+	m_TriVerts.push_back({ a, packed });
+	m_TriVerts.push_back({ b, packed });
+	m_TriVerts.push_back({ c, packed });
+}
+
+void TTK::DebugMesh::AddQuad(const glm::vec3& min, const glm::vec3& max, const glm::vec4& color) {
+	glm::vec3 minXmaxY = { min.x, max.y, min.z };
+	glm::vec3 maxXminY = { max.x, min.y, min.z };
+	AddTri(min, maxXminY, minXmaxY, color);
+	AddTri(maxXminY, max, minXmaxY, color);
+}
+
+void TTK::DebugMesh::AddPoint(const glm::vec3& pos, float size, const glm::vec4& color) {
+	m_PointVerts.push_back({ pos, PackRGBA8(color), size });
+}
+
+void TTK::DebugMesh::Bake() {
+	if (IsBaked()) {
+		LOG_WARN("Debug mesh has already been baked, ignoring");
+		return;
+	}
+
+	m_TriCount = static_cast<GLsizei>(m_TriVerts.size());
+	m_LineCount = static_cast<GLsizei>(m_LineVerts.size());
+	m_PointCount = static_cast<GLsizei>(m_PointVerts.size());
+
+	// We bound our geometry with the sphere around it's AABB, which is good enough for culling
+	glm::vec3 min(std::numeric_limits<float>::max()), max(-std::numeric_limits<float>::max());
+	for (const Context::SimpleVert& vert : m_TriVerts) { min = glm::min(min, vert.Position); max = glm::max(max, vert.Position); }
+	for (const Context::SimpleVert& vert : m_LineVerts) { min = glm::min(min, vert.Position); max = glm::max(max, vert.Position); }
+	for (const Context::PointVert& vert : m_PointVerts) { min = glm::min(min, vert.Position); max = glm::max(max, vert.Position); }
+	if (m_TriCount + m_LineCount + m_PointCount > 0) {
+		m_BoundsCenter = (min + max) * 0.5f;
+		m_BoundsRadius = glm::length(max - min) * 0.5f;
+	}
+
+	// Our buffer is laid out as triangles, then lines (so both can share a VAO), then points
+	size_t simpleBytes = (m_TriVerts.size() + m_LineVerts.size()) * sizeof(Context::SimpleVert);
+	size_t pointBytes = m_PointVerts.size() * sizeof(Context::PointVert);
+
+	glCreateBuffers(1, &m_Buffer);
+	glNamedBufferStorage(m_Buffer, simpleBytes + pointBytes + 1, nullptr, GL_DYNAMIC_STORAGE_BIT);
+	glNamedBufferSubData(m_Buffer, 0, m_TriVerts.size() * sizeof(Context::SimpleVert), m_TriVerts.data());
+	glNamedBufferSubData(m_Buffer, m_TriVerts.size() * sizeof(Context::SimpleVert), m_LineVerts.size() * sizeof(Context::SimpleVert), m_LineVerts.data());
+	glNamedBufferSubData(m_Buffer, simpleBytes, pointBytes, m_PointVerts.data());
+
+	glCreateVertexArrays(1, &m_SimpleVAO);
+	Context::SimpleVert::GetLayout().Apply(m_SimpleVAO, 0);
+	glVertexArrayVertexBuffer(m_SimpleVAO, 0, m_Buffer, 0, sizeof(Context::SimpleVert));
+
+	glCreateVertexArrays(1, &m_PointVAO);
+	Context::PointVert::GetLayout().Apply(m_PointVAO, 0);
+	glVertexArrayVertexBuffer(m_PointVAO, 0, m_Buffer, simpleBytes, sizeof(Context::PointVert));
+
+	// We no longer need the CPU side copy of our data
+	m_TriVerts = std::vector<Context::SimpleVert>();
+	m_LineVerts = std::vector<Context::SimpleVert>();
+	m_PointVerts = std::vector<Context::PointVert>();
+}
@@ -11,10 +11,15 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "TTK/FontRenderer.h"
+#include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <sstream>
+#include <vector>
 #include "Logging.h"
 #include <GLM/gtc/matrix_transform.hpp>
 #include "TTK/TTKContext.h"
+#include "TTK/GLState.h"
 
 // Implementaiton of readFile
 char* readFile(const char* filename) {
@@ -52,20 +57,82 @@ char* readFile(const char* filename) {
 }
 
 TTK::FontRenderer* TTK::FontRenderer::m_Instance = nullptr;
+uint64_t TTK::FontRenderer::m_FrameIndex = 1;
+
+// The header for cached font atlases, bump the version whenever the layout of the cache or the rasterizer changes
+struct FontCacheHeader {
+	static const uint32_t MagicValue = 0x4B465454; // TTFK
+	static const uint32_t CurrentVersion = 2;
+
+	uint32_t Magic;
+	uint32_t Version;
+	uint64_t Key;
+	uint32_t CellWidth, CellHeight;
+	uint32_t GlyphCount;
+	uint32_t RowCount;
+	uint32_t KerningCount;
+};
+
+// FNV-1a, which is more than good enough to tell fonts apart
+static uint64_t __HashBytes(const void* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+	for (size_t ix = 0; ix < size; ix++) {
+		hash ^= bytes[ix];
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
 
-TTK::TrueTypeTextureFont::TrueTypeTextureFont(const char* fileName, uint32_t size)
-{
-	myFontSize = size;
-
-	unsigned char* fontData = (unsigned char*)readFile(fileName);
-	uint8_t* atlasData = new uint8_t[static_cast<size_t>(ATLAS_WIDTH) * ATLAS_HEIGHT];
-
-	myCharInfo = new stbtt_packedchar[CHAR_COUNT];
+// Decodes a single code point from a UTF-8 string and advances past it, malformed sequences decode as U+FFFD
+static uint32_t __DecodeUTF8(const char*& text) {
+	const unsigned char* c = reinterpret_cast<const unsigned char*>(text);
+	uint32_t codePoint;
+	int extra;
+	if (c[0] < 0x80)                { codePoint = c[0];        extra = 0; }
+	else if ((c[0] & 0xE0) == 0xC0) { codePoint = c[0] & 0x1F; extra = 1; }
+	else if ((c[0] & 0xF0) == 0xE0) { codePoint = c[0] & 0x0F; extra = 2; }
+	else if ((c[0] & 0xF8) == 0xF0) { codePoint = c[0] & 0x07; extra = 3; }
+	else {
+		text++;
+		return 0xFFFD;
+	}
+	// Note that this will also stop at the null terminator, since it is not a continuation byte
+	for (int ix = 1; ix <= extra; ix++) {
+		if ((c[ix] & 0xC0) != 0x80) {
+			text += ix;
+			return 0xFFFD;
+		}
+		codePoint = (codePoint << 6) | (c[ix] & 0x3F);
+	}
+	text += extra + 1;
+	return codePoint;
+}
 
-	if (!stbtt_InitFont(&myFontInfo, fontData, 0)) {
+TTK::TrueTypeTextureFont::TrueTypeTextureFont(const char* fileName, uint32_t size, FontAtlasMode mode) :
+	myTexture(0),
+	m_TexHandle(0),
+	m_Mode(mode),
+	m_FontData(nullptr),
+	myFontSize(size),
+	myPixelHeightScale(0.0f),
+	myEmToPixel(0.0f),
+	myAscent(0),
+	myDescent(0),
+	myLineGap(0),
+	m_CellWidth(0),
+	m_CellHeight(0),
+	m_CellColumns(0),
+	m_DirtyMin(0),
+	m_DirtyMax(0),
+	m_CacheKey(0),
+	m_LayoutsStale(false)
+{
+	// We keep the font data around for the lifetime of the font, since glyphs are rasterized as they are needed
+	m_FontData = (unsigned char*)readFile(fileName);
+	if (m_FontData == nullptr || !stbtt_InitFont(&myFontInfo, m_FontData, 0)) {
 		LOG_ERROR("Failed to initialize font");
-		delete[] atlasData;
-		delete[] fontData;
+		delete[] m_FontData;
+		m_FontData = nullptr;
 		return;
 	}
 
@@ -75,78 +142,400 @@ TTK::TrueTypeTextureFont::TrueTypeTextureFont(const char* fileName, uint32_t siz
 	myPixelHeightScale = stbtt_ScaleForPixelHeight(&myFontInfo, static_cast<float>(size));
 	myEmToPixel = stbtt_ScaleForMappingEmToPixels(&myFontInfo, 1.0f);
 
-	stbtt_pack_context context;
-	if (!stbtt_PackBegin(&context, atlasData, ATLAS_WIDTH, ATLAS_HEIGHT, 0, 1, nullptr)) {
-		LOG_ERROR("Failed to pack font texture");
-		delete[] atlasData;
-		delete[] fontData;
-		return;
+	// Our cells need to fit the largest glyph in the font, plus a 1 pixel gap so that glyphs don't bleed into each other
+	int boxX0, boxY0, boxX1, boxY1;
+	stbtt_GetFontBoundingBox(&myFontInfo, &boxX0, &boxY0, &boxX1, &boxY1);
+	if (m_Mode == FontAtlasMode::SDF) {
+		m_CellWidth = static_cast<uint32_t>(glm::ceil((boxX1 - boxX0) * myPixelHeightScale)) + SDF_PADDING * 2 + 3;
+		m_CellHeight = static_cast<uint32_t>(glm::ceil((boxY1 - boxY0) * myPixelHeightScale)) + SDF_PADDING * 2 + 3;
+	} else {
+		m_CellWidth = static_cast<uint32_t>(glm::ceil((boxX1 - boxX0) * myPixelHeightScale * FONT_OVERSAMPLE_X)) + FONT_OVERSAMPLE_X + 2;
+		m_CellHeight = static_cast<uint32_t>(glm::ceil((boxY1 - boxY0) * myPixelHeightScale * FONT_OVERSAMPLE_Y)) + FONT_OVERSAMPLE_Y + 2;
 	}
-
-	stbtt_PackSetOversampling(&context, FONT_OVERSAMPLE_X, FONT_OVERSAMPLE_Y);
-	if (!stbtt_PackFontRange(&context, fontData, 0, static_cast<float>(size), FIRST_CHAR, CHAR_COUNT, myCharInfo)) {
-		LOG_ERROR("Failed to pack font range");
-		delete[] atlasData;
-		delete[] fontData;
+	m_CellColumns = ATLAS_WIDTH / m_CellWidth;
+	uint32_t slotCount = m_CellColumns * (ATLAS_HEIGHT / m_CellHeight);
+	if (slotCount == 0) {
+		LOG_ERROR("Font size is too large to fit any glyphs in the atlas");
 		return;
 	}
-	stbtt_PackEnd(&context);
-
-	for (uint32_t ix = FIRST_CHAR; ix < FIRST_CHAR + CHAR_COUNT; ix++) {
-		// TODO: Grab glyph data
-	}
-
-	// Create and upload the texture to store our font in
+	m_Slots.resize(slotCount, { 0, 0 });
+	// Our free list is popped from the back, so we reverse it to fill the atlas from the top left
+	m_FreeSlots.reserve(slotCount);
+	for (uint32_t ix = slotCount; ix > 0; ix--)
+		m_FreeSlots.push_back(ix - 1);
+	m_AtlasData.resize(static_cast<size_t>(ATLAS_WIDTH) * ATLAS_HEIGHT, 0);
+
+	// Create the texture to store our font in, it starts empty and is filled in as glyphs are used
 	LOG_ASSERT(glGetError() == GL_NONE, "Some error has occured!");
 	glCreateTextures(GL_TEXTURE_2D, 1, &myTexture);
 	glTextureParameteri(myTexture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 	glTextureParameteri(myTexture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTextureParameteri(myTexture, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR);
+	// We only have a single level, so we can't use a mipmapped filter (the texture would be incomplete)
+	glTextureParameteri(myTexture, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 	glTextureParameteri(myTexture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 	LOG_ASSERT(glGetError() == GL_NONE, "Some error has occured!");
 	glTextureStorage2D(myTexture, 1, GL_R8, ATLAS_WIDTH, ATLAS_HEIGHT);
 	LOG_ASSERT(glGetError() == GL_NONE, "Internal texture format not supported");
-	glTextureSubImage2D(myTexture, 0, 0, 0, ATLAS_WIDTH, ATLAS_HEIGHT, GL_RED, GL_UNSIGNED_BYTE, atlasData);
-	LOG_ASSERT(glGetError() == GL_NONE, "Texture transfer format not supported");
+	uint8_t zero = 0;
+	glClearTexImage(myTexture, 0, GL_RED, GL_UNSIGNED_BYTE, &zero);
 	m_TexHandle = glGetTextureHandleARB(myTexture);
 	glMakeTextureHandleResidentARB(m_TexHandle);
 
-	delete[] atlasData;
-	delete[] fontData;
+	// The cached atlas depends on the font itself, as well as anything that changes how glyphs are rasterized
+	std::error_code error;
+	uintmax_t fontSize = std::filesystem::file_size(fileName, error);
+	uint32_t settings[] = { size, FONT_OVERSAMPLE_X, FONT_OVERSAMPLE_Y, static_cast<uint32_t>(m_Mode), static_cast<uint32_t>(SDF_PADDING),
+		SDF_ON_EDGE, ATLAS_WIDTH, ATLAS_HEIGHT };
+	m_CacheKey = __HashBytes(settings, sizeof(settings), __HashBytes(m_FontData, static_cast<size_t>(fontSize)));
+
+	// Most of our text is ASCII, so we warm the cache with it to avoid a hitch the first time text is drawn
+	if (!__LoadAtlasCache()) {
+		for (uint32_t codePoint = ' '; codePoint <= '~'; codePoint++)
+			__FindGlyph(codePoint);
+		__BuildKerning();
+		__SaveAtlasCache();
+	}
+	__UploadDirty();
+}
+
+std::string TTK::TrueTypeTextureFont::__GetCachePath() const {
+	std::stringstream path;
+	path << m_CacheDirectory << "/" << std::hex << m_CacheKey << ".ttkfont";
+	return path.str();
+}
+
+bool TTK::TrueTypeTextureFont::__LoadAtlasCache() {
+	if (m_CacheDirectory.empty())
+		return false;
+
+	std::ifstream file(__GetCachePath(), std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	FontCacheHeader header;
+	file.read(reinterpret_cast<char*>(&header), sizeof(FontCacheHeader));
+	if (!file || header.Magic != FontCacheHeader::MagicValue || header.Version != FontCacheHeader::CurrentVersion ||
+		header.Key != m_CacheKey || header.CellWidth != m_CellWidth || header.CellHeight != m_CellHeight ||
+		header.RowCount > ATLAS_HEIGHT || header.GlyphCount > 0x110000 || header.KerningCount != FlatGlyphCount * FlatGlyphCount) {
+		LOG_WARN("Ignoring out of date font atlas cache \"{}\"", __GetCachePath());
+		return false;
+	}
+
+	std::vector<uint32_t>    codePoints(header.GlyphCount);
+	std::vector<CachedGlyph> glyphs(header.GlyphCount);
+	file.read(reinterpret_cast<char*>(codePoints.data()), codePoints.size() * sizeof(uint32_t));
+	file.read(reinterpret_cast<char*>(glyphs.data()), glyphs.size() * sizeof(CachedGlyph));
+	m_FlatKerning.resize(header.KerningCount);
+	file.read(reinterpret_cast<char*>(m_FlatKerning.data()), m_FlatKerning.size() * sizeof(float));
+	file.read(reinterpret_cast<char*>(m_AtlasData.data()), static_cast<std::streamsize>(header.RowCount) * ATLAS_WIDTH);
+	if (!file) {
+		LOG_WARN("Font atlas cache \"{}\" is truncated, ignoring", __GetCachePath());
+		std::fill(m_AtlasData.begin(), m_AtlasData.end(), static_cast<uint8_t>(0));
+		return false;
+	}
+
+	// Claim the slots that the cached glyphs live in, and rebuild our free list from the rest
+	uint64_t frame = FontRenderer::GetFrameIndex();
+	for (size_t ix = 0; ix < glyphs.size(); ix++) {
+		const CachedGlyph& glyph = glyphs[ix];
+		if (glyph.Slot != NoSlot) {
+			if (glyph.Slot >= m_Slots.size()) {
+				LOG_WARN("Font atlas cache \"{}\" is corrupt, ignoring", __GetCachePath());
+				m_Glyphs.clear();
+				m_FlatGlyphValid.reset();
+				m_FlatKerning.clear();
+				std::fill(m_Slots.begin(), m_Slots.end(), AtlasSlot{ 0, 0 });
+				std::fill(m_AtlasData.begin(), m_AtlasData.end(), static_cast<uint8_t>(0));
+				return false;
+			}
+			m_Slots[glyph.Slot] = { codePoints[ix], frame };
+		}
+		__StoreGlyph(codePoints[ix], glyph);
+	}
+	m_FreeSlots.clear();
+	for (uint32_t ix = static_cast<uint32_t>(m_Slots.size()); ix > 0; ix--) {
+		if (m_Slots[ix - 1].LastUsedFrame == 0)
+			m_FreeSlots.push_back(ix - 1);
+	}
+
+	m_DirtyMin = glm::ivec2(0);
+	m_DirtyMax = glm::ivec2(ATLAS_WIDTH, header.RowCount);
+	return true;
+}
+
+void TTK::TrueTypeTextureFont::__SaveAtlasCache() const {
+	if (m_CacheDirectory.empty())
+		return;
+
+	// We only need to store the rows that contain glyphs
+	std::vector<uint32_t>    codePoints;
+	std::vector<CachedGlyph> glyphs;
+	uint32_t rowCount = 0;
+	auto addGlyph = [&](uint32_t codePoint, const CachedGlyph& glyph) {
+		codePoints.push_back(codePoint);
+		glyphs.push_back(glyph);
+		if (glyph.Slot != NoSlot)
+			rowCount = glm::max(rowCount, (glyph.Slot / m_CellColumns + 1) * m_CellHeight);
+	};
+	for (uint32_t codePoint = 0; codePoint < FlatGlyphCount; codePoint++) {
+		if (m_FlatGlyphValid[codePoint])
+			addGlyph(codePoint, m_FlatGlyphs[codePoint]);
+	}
+	for (const auto& [codePoint, glyph] : m_Glyphs)
+		addGlyph(codePoint, glyph);
+
+	std::error_code error;
+	std::filesystem::create_directories(m_CacheDirectory, error);
+	std::ofstream file(__GetCachePath(), std::ios::binary);
+	if (!file.is_open()) {
+		LOG_WARN("Failed to write font atlas cache \"{}\"", __GetCachePath());
+		return;
+	}
+
+	FontCacheHeader header;
+	header.Magic = FontCacheHeader::MagicValue;
+	header.Version = FontCacheHeader::CurrentVersion;
+	header.Key = m_CacheKey;
+	header.CellWidth = m_CellWidth;
+	header.CellHeight = m_CellHeight;
+	header.GlyphCount = static_cast<uint32_t>(glyphs.size());
+	header.RowCount = rowCount;
+	header.KerningCount = static_cast<uint32_t>(m_FlatKerning.size());
+	file.write(reinterpret_cast<const char*>(&header), sizeof(FontCacheHeader));
+	file.write(reinterpret_cast<const char*>(codePoints.data()), codePoints.size() * sizeof(uint32_t));
+	file.write(reinterpret_cast<const char*>(glyphs.data()), glyphs.size() * sizeof(CachedGlyph));
+	file.write(reinterpret_cast<const char*>(m_FlatKerning.data()), m_FlatKerning.size() * sizeof(float));
+	file.write(reinterpret_cast<const char*>(m_AtlasData.data()), static_cast<std::streamsize>(rowCount) * ATLAS_WIDTH);
+}
+
+void TTK::TrueTypeTextureFont::__BuildKerning() {
+	// Looking up kerning means searching the font's kern or GPOS tables, so we do it once for every printable ASCII pair
+	m_FlatKerning.assign(FlatGlyphCount * FlatGlyphCount, 0.0f);
+	int glyphIndices[FlatGlyphCount] = {};
+	for (uint32_t codePoint = ' '; codePoint < FlatGlyphCount; codePoint++)
+		glyphIndices[codePoint] = stbtt_FindGlyphIndex(&myFontInfo, codePoint);
+
+	for (uint32_t first = ' '; first < FlatGlyphCount; first++) {
+		for (uint32_t second = ' '; second < FlatGlyphCount; second++) {
+			int kerning = stbtt_GetGlyphKernAdvance(&myFontInfo, glyphIndices[first], glyphIndices[second]);
+			m_FlatKerning[first * FlatGlyphCount + second] = kerning * myPixelHeightScale;
+		}
+	}
+}
+
+float TTK::TrueTypeTextureFont::__GetKerning(uint32_t first, uint32_t second) const {
+	if (first < FlatGlyphCount && second < FlatGlyphCount)
+		return m_FlatKerning.empty() ? 0.0f : m_FlatKerning[first * FlatGlyphCount + second];
+	if (m_FontData == nullptr)
+		return 0.0f;
+
+	uint64_t key = (static_cast<uint64_t>(first) << 32) | second;
+	auto it = m_KerningPairs.find(key);
+	if (it != m_KerningPairs.end())
+		return it->second;
+	float kerning = stbtt_GetCodepointKernAdvance(&myFontInfo, first, second) * myPixelHeightScale;
+	m_KerningPairs[key] = kerning;
+	return kerning;
+}
+
+const TTK::TrueTypeTextureFont::CachedGlyph* TTK::TrueTypeTextureFont::__LookupGlyph(uint32_t codePoint) const {
+	if (codePoint < FlatGlyphCount)
+		return m_FlatGlyphValid[codePoint] ? &m_FlatGlyphs[codePoint] : nullptr;
+	auto it = m_Glyphs.find(codePoint);
+	return it != m_Glyphs.end() ? &it->second : nullptr;
+}
+
+void TTK::TrueTypeTextureFont::__StoreGlyph(uint32_t codePoint, const CachedGlyph& glyph) const {
+	if (codePoint < FlatGlyphCount) {
+		m_FlatGlyphs[codePoint] = glyph;
+		m_FlatGlyphValid[codePoint] = true;
+	} else {
+		m_Glyphs[codePoint] = glyph;
+	}
+}
+
+void TTK::TrueTypeTextureFont::__EraseGlyph(uint32_t codePoint) const {
+	if (codePoint < FlatGlyphCount)
+		m_FlatGlyphValid[codePoint] = false;
+	else
+		m_Glyphs.erase(codePoint);
 }
 
 TTK::TrueTypeTextureFont::~TrueTypeTextureFont()
 {
-	delete[] myCharInfo;
-	glDeleteTextures(1, &myTexture);
+	// Make sure the renderer doesn't try to draw any text that was queued with us
+	if (FontRenderer::IsCreated())
+		FontRenderer::Instance().__DiscardFont(*this);
+	delete[] m_FontData;
+	if (myTexture != 0) {
+		glMakeTextureHandleNonResidentARB(m_TexHandle);
+		GLState::DeleteTextures(1, &myTexture);
+	}
+}
+
+TTK::TrueTypeTextureFont::CachedGlyph TTK::TrueTypeTextureFont::__FindGlyph(uint32_t codePoint) const {
+	const CachedGlyph* cached = __LookupGlyph(codePoint);
+	if (cached != nullptr) {
+		if (cached->Slot != NoSlot)
+			m_Slots[cached->Slot].LastUsedFrame = FontRenderer::GetFrameIndex();
+		return *cached;
+	}
+
+	CachedGlyph glyph = CachedGlyph();
+	glyph.Slot = NoSlot;
+	if (m_FontData == nullptr || m_Slots.empty())
+		return glyph;
+
+	__RasterizeGlyph(codePoint, glyph);
+	// If there was no room for the glyph, we don't cache it so that we can try again next frame
+	if (glyph.Slot != NoSlot || glyph.Min == glyph.Max)
+		__StoreGlyph(codePoint, glyph);
+	return glyph;
+}
+
+void TTK::TrueTypeTextureFont::__RasterizeGlyph(uint32_t codePoint, CachedGlyph& glyph) const {
+	int advance, leftBearing;
+	stbtt_GetCodepointHMetrics(&myFontInfo, codePoint, &advance, &leftBearing);
+	glyph.Advance = advance * myPixelHeightScale;
+
+	// Work out the size of the glyph's bitmap, this mirrors what stbtt_PackFontRange does for each glyph
+	int width = 0, height = 0;
+	int boxX0, boxY0, boxX1, boxY1;
+	unsigned char* sdf = nullptr;
+	if (m_Mode == FontAtlasMode::SDF) {
+		int offsetX = 0, offsetY = 0;
+		float distanceScale = static_cast<float>(SDF_ON_EDGE) / SDF_PADDING;
+		sdf = stbtt_GetCodepointSDF(&myFontInfo, myPixelHeightScale, codePoint, SDF_PADDING, SDF_ON_EDGE, distanceScale,
+			&width, &height, &offsetX, &offsetY);
+		// Glyphs without any outline (ex space) won't produce a field
+		if (sdf == nullptr)
+			return;
+		glyph.Min = glm::vec2(offsetX, offsetY);
+		glyph.Max = glm::vec2(offsetX + width, offsetY + height);
+	} else {
+		stbtt_GetCodepointBitmapBox(&myFontInfo, codePoint, myPixelHeightScale * FONT_OVERSAMPLE_X, myPixelHeightScale * FONT_OVERSAMPLE_Y,
+			&boxX0, &boxY0, &boxX1, &boxY1);
+		if (boxX1 <= boxX0 || boxY1 <= boxY0)
+			return;
+		width = boxX1 - boxX0 + FONT_OVERSAMPLE_X - 1;
+		height = boxY1 - boxY0 + FONT_OVERSAMPLE_Y - 1;
+	}
+
+	if (static_cast<uint32_t>(width) >= m_CellWidth || static_cast<uint32_t>(height) >= m_CellHeight) {
+		LOG_WARN("Glyph U+{0:X} is larger than the font's atlas cells, skipping", codePoint);
+		stbtt_FreeSDF(sdf, nullptr);
+		glyph.Min = glyph.Max = glm::vec2(0.0f);
+		return;
+	}
+
+	glyph.Slot = __AllocateSlot();
+	if (glyph.Slot == NoSlot) {
+		LOG_WARN_ONCE("Font atlas is full of glyphs that are in use this frame, some text will be missing");
+		stbtt_FreeSDF(sdf, nullptr);
+		return;
+	}
+	m_Slots[glyph.Slot].CodePoint = codePoint;
+
+	// Clear out whatever glyph was in the cell before us, then draw our glyph into it's top left corner
+	glm::ivec2 cell = glm::ivec2((glyph.Slot % m_CellColumns) * m_CellWidth, (glyph.Slot / m_CellColumns) * m_CellHeight);
+	uint8_t* origin = m_AtlasData.data() + static_cast<size_t>(cell.y) * ATLAS_WIDTH + cell.x;
+	for (uint32_t row = 0; row < m_CellHeight; row++)
+		memset(origin + static_cast<size_t>(row) * ATLAS_WIDTH, 0, m_CellWidth);
+
+	if (sdf != nullptr) {
+		for (int row = 0; row < height; row++)
+			memcpy(origin + static_cast<size_t>(row) * ATLAS_WIDTH, sdf + row * width, width);
+		stbtt_FreeSDF(sdf, nullptr);
+	} else {
+		float subX, subY;
+		stbtt_MakeCodepointBitmapSubpixelPrefilter(&myFontInfo, origin, width, height, ATLAS_WIDTH,
+			myPixelHeightScale * FONT_OVERSAMPLE_X, myPixelHeightScale * FONT_OVERSAMPLE_Y, 0.0f, 0.0f,
+			FONT_OVERSAMPLE_X, FONT_OVERSAMPLE_Y, &subX, &subY, codePoint);
+		glyph.Min = glm::vec2(boxX0 / static_cast<float>(FONT_OVERSAMPLE_X) + subX, boxY0 / static_cast<float>(FONT_OVERSAMPLE_Y) + subY);
+		glyph.Max = glm::vec2((boxX0 + width) / static_cast<float>(FONT_OVERSAMPLE_X) + subX, (boxY0 + height) / static_cast<float>(FONT_OVERSAMPLE_Y) + subY);
+	}
+
+	glm::vec2 atlasSize = glm::vec2(ATLAS_WIDTH, ATLAS_HEIGHT);
+	glyph.UVMin = glm::vec2(cell) / atlasSize;
+	glyph.UVMax = glm::vec2(cell + glm::ivec2(width, height)) / atlasSize;
+
+	// Grow the region that needs to be uploaded to include the whole cell
+	glm::ivec2 cellMax = cell + glm::ivec2(m_CellWidth, m_CellHeight);
+	if (m_DirtyMax.x <= m_DirtyMin.x || m_DirtyMax.y <= m_DirtyMin.y) {
+		m_DirtyMin = cell;
+		m_DirtyMax = cellMax;
+	} else {
+		m_DirtyMin = glm::min(m_DirtyMin, cell);
+		m_DirtyMax = glm::max(m_DirtyMax, cellMax);
+	}
+}
+
+uint32_t TTK::TrueTypeTextureFont::__AllocateSlot() const {
+	if (!m_FreeSlots.empty()) {
+		uint32_t slot = m_FreeSlots.back();
+		m_FreeSlots.pop_back();
+		m_Slots[slot].LastUsedFrame = FontRenderer::GetFrameIndex();
+		return slot;
+	}
+
+	// Evict the least recently used glyph, as long as it hasn't been used this frame (we may still be drawing it)
+	uint64_t frame = FontRenderer::GetFrameIndex();
+	uint32_t oldest = NoSlot;
+	for (uint32_t ix = 0; ix < m_Slots.size(); ix++) {
+		if (m_Slots[ix].LastUsedFrame < frame && (oldest == NoSlot || m_Slots[ix].LastUsedFrame < m_Slots[oldest].LastUsedFrame))
+			oldest = ix;
+	}
+	if (oldest != NoSlot) {
+		__EraseGlyph(m_Slots[oldest].CodePoint);
+		m_Slots[oldest].LastUsedFrame = frame;
+		m_LayoutsStale = true;
+	}
+	return oldest;
+}
+
+void TTK::TrueTypeTextureFont::__UploadDirty() const {
+	if (m_DirtyMax.x <= m_DirtyMin.x || m_DirtyMax.y <= m_DirtyMin.y)
+		return;
+
+	// We only send the rows and columns that have changed, reading them straight out of our CPU copy
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, ATLAS_WIDTH);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTextureSubImage2D(myTexture, 0, m_DirtyMin.x, m_DirtyMin.y, m_DirtyMax.x - m_DirtyMin.x, m_DirtyMax.y - m_DirtyMin.y,
+		GL_RED, GL_UNSIGNED_BYTE, m_AtlasData.data() + static_cast<size_t>(m_DirtyMin.y) * ATLAS_WIDTH + m_DirtyMin.x);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+	m_DirtyMin = m_DirtyMax = glm::ivec2(0);
 }
 
 TTK::GlyphInfo TTK::TrueTypeTextureFont::GetGlyph(int codePoint, float offsetX, float offsetY) const {
-	stbtt_aligned_quad quad;
+	return __MakeQuad(__FindGlyph(static_cast<uint32_t>(codePoint)), offsetX, offsetY);
+}
 
-	stbtt_GetPackedQuad(myCharInfo, ATLAS_WIDTH, ATLAS_HEIGHT, codePoint - FIRST_CHAR, &offsetX, &offsetY, &quad, 1);
-	auto xmin = quad.x0;
-	auto xmax = quad.x1;
-	auto ymin = -quad.y1;
-	auto ymax = -quad.y0;
+TTK::GlyphInfo TTK::TrueTypeTextureFont::__MakeQuad(const CachedGlyph& glyph, float offsetX, float offsetY) const {
+	// Snap the glyph to whole pixels, the same as stbtt_GetPackedQuad does
+	float x0 = glm::floor(offsetX + glyph.Min.x + 0.5f);
+	float y0 = glm::floor(offsetY + glyph.Min.y + 0.5f);
+	float x1 = x0 + glyph.Max.x - glyph.Min.x;
+	float y1 = y0 + glyph.Max.y - glyph.Min.y;
 
 	GlyphInfo info = GlyphInfo();
-	info.OffsetX = offsetX;
+	info.OffsetX = offsetX + glyph.Advance;
 	info.OffsetY = offsetY;
-	info.Positions[0] = { xmax, -ymin };
-	info.Positions[1] = { xmax, -ymax };
-	info.Positions[2] = { xmin, -ymax };
-	info.Positions[3] = { xmin, -ymin };
-	info.UVs[0] = { quad.s1, quad.t1 };
-	info.UVs[1] = { quad.s1, quad.t0 };
-	info.UVs[2] = { quad.s0, quad.t0 };
-	info.UVs[3] = { quad.s0, quad.t1 };
+	info.Positions[0] = { x1, y1 };
+	info.Positions[1] = { x1, y0 };
+	info.Positions[2] = { x0, y0 };
+	info.Positions[3] = { x0, y1 };
+	info.UVs[0] = { glyph.UVMax.x, glyph.UVMax.y };
+	info.UVs[1] = { glyph.UVMax.x, glyph.UVMin.y };
+	info.UVs[2] = { glyph.UVMin.x, glyph.UVMin.y };
+	info.UVs[3] = { glyph.UVMin.x, glyph.UVMax.y };
 
 	return info;
 }
 
 float TTK::TrueTypeTextureFont::GetKerning(int char1, int char2) const {
-	return stbtt_GetCodepointKernAdvance(&myFontInfo, char1, char2) * myPixelHeightScale;
+	return __GetKerning(static_cast<uint32_t>(char1), static_cast<uint32_t>(char2));
 }
 
 float TTK::TrueTypeTextureFont::GetLineHeight() const {
@@ -154,175 +543,224 @@ float TTK::TrueTypeTextureFont::GetLineHeight() const {
 }
 
 glm::vec2 TTK::TrueTypeTextureFont::MeausureString(const char* text, const float scale) {
-	float multiplier = scale;
+	return GetLayout(text, scale).Size;
+}
 
-	glm::vec2 originPos = glm::vec2();
+const TTK::TextLayout& TTK::TrueTypeTextureFont::GetLayout(const char* text, float scale) const {
+	// If any glyphs have been evicted, our cached layouts may be pointing at the wrong part of the atlas
+	if (m_LayoutsStale) {
+		m_LayoutCache.Clear();
+		m_LayoutsStale = false;
+	}
+	const TextLayout& layout = m_LayoutCache.Get(text, scale, [&](TextLayout& layout) { __LayoutText(text, scale, layout); });
 
-	GlyphInfo glyph;
+	// Cached layouts skip the glyph lookup, so we need to mark their glyphs as used to keep them out of eviction
+	uint64_t frame = FontRenderer::GetFrameIndex();
+	for (const TextLayout::Glyph& glyph : layout.Glyphs)
+		m_Slots[glyph.Slot].LastUsedFrame = frame;
+	return layout;
+}
 
-	size_t length = strlen(text);
+void TTK::TrueTypeTextureFont::__LayoutText(const char* text, float scale, TextLayout& layout) const {
+	// We lay out in the font's pixel space, and only apply the scale when we store the quads
 	float xOff{ 0 }, yOff{ 0 };
-	float lineHeight = 0.0f;
 	float maxWidth = 0.0f;
-	float totalHeight = 0.0f;
-
-	for (size_t i = 0; i < length; i++) {
-		glyph = GetGlyph(text[i], xOff, yOff);
-		xOff = glyph.OffsetX;
-		yOff = glyph.OffsetY;
-
-		lineHeight = glm::max(lineHeight, -glyph.Positions[1].y);
-		maxWidth = glm::max(maxWidth, xOff);
-
-		if (text[i] == '\n')
-		{
-			yOff += GetLineHeight() * multiplier;
-			totalHeight += lineHeight;
-			lineHeight = 0.0f;
+	int   lineCount = 1;
+	const float lineHeight = GetLineHeight();
+	// Kerning is only applied between two glyphs on the same line, 0 means there is no previous glyph
+	uint32_t previous = 0;
+
+	layout.Glyphs.reserve(strlen(text));
+	const char* c = text;
+	while (*c != '\0') {
+		uint32_t codePoint = __DecodeUTF8(c);
+		if (codePoint == '\n') {
+			maxWidth = glm::max(maxWidth, xOff);
+			yOff += lineHeight;
 			xOff = 0;
+			lineCount++;
+			previous = 0;
 		}
-		else if (text[i] == '\r') {
+		else if (codePoint == '\r') {
 			xOff = 0;
+			previous = 0;
 		}
-		else if (text[i] == '\t') {
-			float xOffTemp{ 0 }, yOffTemp{ 0 };
-			glyph = GetGlyph(' ', xOffTemp, yOffTemp);
-			xOff += glyph.OffsetX * 4;
+		else if (codePoint == '\t') {
+			xOff += __FindGlyph(' ').Advance * 4;
+			previous = 0;
+		}
+		else {
+			if (previous != 0)
+				xOff += __GetKerning(previous, codePoint);
+			previous = codePoint;
+
+			CachedGlyph cached = __FindGlyph(codePoint);
+			// Whitespace (and glyphs that didn't fit in the atlas) don't have anything to draw
+			if (cached.Slot != NoSlot) {
+				GlyphInfo glyph = __MakeQuad(cached, xOff, yOff);
+				TextLayout::Glyph quad;
+				for (int corner = 0; corner < 4; corner++) {
+					quad.Positions[corner] = glyph.Positions[corner] * scale;
+					quad.UVs[corner] = glyph.UVs[corner];
+				}
+				quad.Slot = cached.Slot;
+				layout.Glyphs.push_back(quad);
+			}
+			xOff += cached.Advance;
 		}
 	}
-	GlyphInfo space = GetGlyph('|', xOff, yOff);
-	yOff += -(space.Positions[1].y - space.Positions[0].y);
-	return glm::vec2(xOff, yOff);
+
+	maxWidth = glm::max(maxWidth, xOff);
+	layout.Size = glm::vec2(maxWidth, lineCount * lineHeight) * scale;
 }
 
 TTK::FontRenderer::~FontRenderer()
 {
-	glDeleteShader(m_ShaderHandle);
-	glDeleteVertexArrays(1, &m_VAO);
+	delete m_Stream;
+	glDeleteBuffers(1, &m_EBO);
+	glDeleteProgram(m_ShaderHandle);
+	GLState::DeleteVertexArrays(1, &m_VAO);
 }
 
 void TTK::FontRenderer::Render(const TrueTypeTextureFont& font, const char* text, const glm::vec2& pos, const glm::vec4& color, float scale)
 {
-	size_t length = strlen(text);
-	
-	float multiplier = scale;
-
-	// The number of quads ACTUALLY drawn Shit-For-Brains
-	int quads = 0;
-
-	glm::vec2 originPos = glm::vec2(pos.x, pos.y);
-
-	static GlyphInfo glyph;
-
-	Col8 gpuCol;
-	gpuCol.R = static_cast<char>(color.r * 255);
-	gpuCol.G = static_cast<char>(color.g * 255);
-	gpuCol.B = static_cast<char>(color.b * 255);
-	gpuCol.A = static_cast<char>(color.a * 255);
-
-	float xOff{ 0 }, yOff{ 0 };
-
-	for (int i = 0; i < length; i++) {
-		glyph = font.GetGlyph(text[i], xOff, yOff);
-		xOff = glyph.OffsetX;
-		yOff = glyph.OffsetY;
-
-		if (text[i] == '\n')
-		{
-			yOff += font.GetLineHeight() * multiplier;
-			xOff = 0;
-		}
-		else if (text[i] == '\r') {
-			xOff = 0;
+	const TextLayout& layout = font.GetLayout(text, scale);
+	uint32_t gpuCol = PackRGBA8(color);
+
+	// The layout is relative to the origin, so all we need to do is offset it and add our color
+	std::vector<Vert>& verts = __GetBatch(font).Verts;
+	size_t first = verts.size();
+	verts.resize(first + layout.Glyphs.size() * 4);
+	Vert* out = verts.data() + first;
+	for (const TextLayout::Glyph& glyph : layout.Glyphs) {
+		for (int corner = 0; corner < 4; corner++, out++) {
+			out->Position = pos + glyph.Positions[corner];
+			out->Color = gpuCol;
+			out->UV = glyph.UVs[corner];
 		}
-		else if (text[i] == '\t') {
-			float xOffTemp{ 0 }, yOffTemp{ 0 };
-			glyph = font.GetGlyph(' ', xOffTemp, yOffTemp);
-			xOff += glyph.OffsetX * 4;
-		}
-		else {
-			m_MeshData[quads * 4 + 0].Position = originPos + glyph.Positions[0] * multiplier;
-			m_MeshData[quads * 4 + 0].UV = glyph.UVs[0];
-			m_MeshData[quads * 4 + 0].Color = gpuCol;
+	}
+}
 
-			m_MeshData[quads * 4 + 1].Position = originPos + glyph.Positions[1] * multiplier;
-			m_MeshData[quads * 4 + 1].UV = glyph.UVs[1];
-			m_MeshData[quads * 4 + 1].Color = gpuCol;
+void TTK::FontRenderer::Flush()
+{
+	size_t totalVerts = 0;
+	size_t maxQuads = 0;
+	for (const Batch& batch : m_Batches) {
+		totalVerts += batch.Verts.size();
+		maxQuads = glm::max(maxQuads, batch.Verts.size() / 4);
+	}
+	if (totalVerts == 0) {
+		m_FrameIndex++;
+		return;
+	}
 
-			m_MeshData[quads * 4 + 2].Position = originPos + glyph.Positions[2] * multiplier;
-			m_MeshData[quads * 4 + 2].UV = glyph.UVs[2];
-			m_MeshData[quads * 4 + 2].Color = gpuCol;
+	// Our index buffer only needs to cover the largest batch, since each batch is drawn with it's own base vertex
+	if (maxQuads > m_IndexQuadCapacity)
+		__GrowIndices(maxQuads);
 
-			m_MeshData[quads * 4 + 3].Position = originPos + glyph.Positions[3] * multiplier;
-			m_MeshData[quads * 4 + 3].UV = glyph.UVs[3];
-			m_MeshData[quads * 4 + 3].Color = gpuCol;
+	// We copy all of our batches into the stream at once, so that we only ever wait on one region per frame
+	Vert* data = m_Stream->Reserve<Vert>(totalVerts);
+	if (m_BoundVBO != m_Stream->GetHandle()) {
+		m_BoundVBO = m_Stream->GetHandle();
+		glVertexArrayVertexBuffer(m_VAO, 0, m_BoundVBO, 0, sizeof(Vert));
+	}
 
+	// We restore the blend and depth state that were set before us, which we can get from the cache for free
+	bool blendState = GLState::IsBlendEnabled();
+	bool depthMaskEnabled = GLState::GetDepthMask();
+	GLState::SetDepthMask(false);
+	GLState::SetBlendEnabled(true);
+	GLState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
+	glm::mat4 proj = TTK::Context::Instance().GetOrthoProjection();
+	GLState::UseProgram(m_ShaderHandle);
+	glProgramUniformMatrix4fv(m_ShaderHandle, 0, 1, false, &proj[0][0]);
+	GLState::BindVertexArray(m_VAO);
+
+	size_t baseVertex = m_Stream->FirstElement();
+	for (Batch& batch : m_Batches) {
+		if (batch.Verts.empty())
+			continue;
+		memcpy(data, batch.Verts.data(), batch.Verts.size() * sizeof(Vert));
+		// Any glyphs that were rasterized while laying out this frame's text need to be sent up before we draw
+		batch.Font->__UploadDirty();
+		glProgramUniformHandleui64ARB(m_ShaderHandle, 1, batch.Font->m_TexHandle);
+		glProgramUniform1i(m_ShaderHandle, 2, batch.Font->m_Mode == FontAtlasMode::SDF ? 1 : 0);
+		glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(batch.Verts.size() / 4 * 6), GL_UNSIGNED_INT, nullptr, static_cast<GLint>(baseVertex));
+
+		data += batch.Verts.size();
+		baseVertex += batch.Verts.size();
+		batch.Verts.clear();
+	}
+	m_Stream->EndFrame();
+	m_FrameIndex++;
 
-			m_IndexData[quads * 6 + 0] = quads * 4 + 0;
-			m_IndexData[quads * 6 + 1] = quads * 4 + 1;
-			m_IndexData[quads * 6 + 2] = quads * 4 + 2;
+	GLState::SetBlendEnabled(blendState);
+	GLState::SetDepthMask(depthMaskEnabled);
+}
 
-			m_IndexData[quads * 6 + 3] = quads * 4 + 0;
-			m_IndexData[quads * 6 + 4] = quads * 4 + 2;
-			m_IndexData[quads * 6 + 5] = quads * 4 + 3;
+TTK::FontRenderer::Batch& TTK::FontRenderer::__GetBatch(const TrueTypeTextureFont& font) {
+	// We will only ever have a handful of fonts, so a linear search is plenty
+	for (Batch& batch : m_Batches) {
+		if (batch.Font == &font)
+			return batch;
+	}
+	m_Batches.push_back({ &font, std::vector<Vert>() });
+	return m_Batches.back();
+}
 
-			quads++;
+void TTK::FontRenderer::__DiscardFont(const TrueTypeTextureFont& font) {
+	for (auto it = m_Batches.begin(); it != m_Batches.end(); ++it) {
+		if (it->Font == &font) {
+			m_Batches.erase(it);
+			return;
 		}
 	}
+}
 
-	length = quads;
+void TTK::FontRenderer::__GrowIndices(size_t quadCount) {
+	size_t capacity = glm::max(m_IndexQuadCapacity, InitialQuads);
+	while (capacity < quadCount)
+		capacity *= 2;
+
+	// Every quad uses the same pattern, so our indices never change once they've been generated
+	std::vector<GLuint> indices(capacity * 6);
+	for (size_t quad = 0; quad < capacity; quad++) {
+		GLuint base = static_cast<GLuint>(quad * 4);
+		indices[quad * 6 + 0] = base + 0;
+		indices[quad * 6 + 1] = base + 1;
+		indices[quad * 6 + 2] = base + 2;
+		indices[quad * 6 + 3] = base + 0;
+		indices[quad * 6 + 4] = base + 2;
+		indices[quad * 6 + 5] = base + 3;
+	}
 
-	// Update and render our meshes
-	bool blendState = glIsEnabled(GL_BLEND);
-	GLboolean depthMaskEnabled = false;
-	glGetBooleanv(GL_DEPTH_WRITEMASK, &depthMaskEnabled);
-	glDepthMask(GL_FALSE);
-	glEnable(GL_BLEND);
-	glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
-	glGetError();
-	glm::mat4 proj = TTK::Context::Instance().GetOrthoProjection();
-	glUseProgram(m_ShaderHandle);
-	glProgramUniformMatrix4fv(m_ShaderHandle, 0, 1, false, &proj[0][0]);
-	glProgramUniformHandleui64ARB(m_ShaderHandle, 1, font.m_TexHandle);	
-	glBindVertexArray(m_VAO);
-	glNamedBufferSubData(m_VBO, 0, length * 4 * sizeof(Vert), m_MeshData);
-	glNamedBufferSubData(m_EBO, 0, length * 6 * sizeof(GLuint), m_IndexData);
-	glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(length * 6), GL_UNSIGNED_INT, nullptr);
-	glBindVertexArray(0);
-	LOG_ASSERT(glGetError() == GL_NONE, "Failed to draw our text mesh!");
-	if (!blendState) glDisable(GL_BLEND);
-	glDepthMask(depthMaskEnabled);
+	// The GL will keep the old buffer alive until any draws that use it are done
+	if (m_EBO != 0)
+		glDeleteBuffers(1, &m_EBO);
+	glCreateBuffers(1, &m_EBO);
+	glNamedBufferStorage(m_EBO, indices.size() * sizeof(GLuint), indices.data(), 0);
+	glVertexArrayElementBuffer(m_VAO, m_EBO);
+	m_IndexQuadCapacity = capacity;
 }
 
 TTK::FontRenderer::FontRenderer() {
 	LOG_INFO("Initializing font renderer");
 
-	memset(m_MeshData, 0, sizeof(m_MeshData));
-	memset(m_IndexData, 0, sizeof(m_IndexData));
-
+	// We set up our VAO with DSA, so that we don't disturb the currently bound VAO
 	glCreateVertexArrays(1, &m_VAO);
-	glBindVertexArray(m_VAO);
-	GLuint buffers[2];
-	glCreateBuffers(2, buffers);
-	glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
-	glNamedBufferData(buffers[0], 256 * 4 * sizeof(Vert), m_MeshData, GL_DYNAMIC_DRAW);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
-	glNamedBufferData(buffers[1], 256 * 6 * sizeof(GLuint), m_IndexData, GL_DYNAMIC_DRAW);
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glEnableVertexAttribArray(2);
-	#pragma warning(push)
-	#pragma warning(disable: 6011)
-	Vert* v = nullptr;
-	glVertexAttribPointer(0, 3, GL_FLOAT, false, sizeof(Vert), &v->Position);
-	glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, false, sizeof(Vert), &v->Color);
-	glVertexAttribPointer(2, 2, GL_FLOAT, false, sizeof(Vert), &v->UV);
-	#pragma warning(pop)
-	
-	glBindVertexArray(0);
+	VertexLayout(sizeof(Vert))
+		.Float(0, 2, offsetof(Vert, Position))
+		.RGBA8(1, offsetof(Vert, Color))
+		.Float(2, 2, offsetof(Vert, UV))
+		.Apply(m_VAO, 0);
+
+	m_Stream = new StreamingBuffer(sizeof(Vert), InitialQuads * 4);
+	m_BoundVBO = m_Stream->GetHandle();
+	glVertexArrayVertexBuffer(m_VAO, 0, m_BoundVBO, 0, sizeof(Vert));
 
-	m_VBO = buffers[0];
-	m_EBO = buffers[1];
+	m_EBO = 0;
+	m_IndexQuadCapacity = 0;
+	__GrowIndices(InitialQuads);
 
 	const char* vsSource = R"LIT(#version 430
             layout (location = 0) in vec2 vertexPosition;
@@ -340,12 +778,19 @@ TTK::FontRenderer::FontRenderer() {
 	const char* fsSource = R"LIT(#version 430
 			#extension GL_ARB_bindless_texture : enable
             layout(bindless_sampler, location = 1) uniform sampler2D xSampler;
+            layout (location = 2) uniform int xDistanceField;
             layout (location = 0) in vec4 fragColor;
             layout (location = 1) in vec2 fragUv;            	
             out vec4 frag_color;            	
             void main() {
-                frag_color = fragColor;
-				frag_color.a = texture2D(xSampler, fragUv).r;
+                float value = texture(xSampler, fragUv).r;
+                float alpha = value;
+                // For distance fields, we anti-alias across roughly one screen pixel around the edge (0.5)
+                if (xDistanceField != 0) {
+                    float width = max(fwidth(value), 0.0001);
+                    alpha = smoothstep(0.5 - width, 0.5 + width, value);
+                }
+                frag_color = vec4(fragColor.rgb, fragColor.a * alpha);
             })LIT";
 
 	m_ShaderHandle = glCreateProgram();
@@ -370,8 +815,6 @@ TTK::FontRenderer::FontRenderer() {
 	glDeleteShader(programs[0]);
 	glDetachShader(m_ShaderHandle, programs[1]);
 	glDeleteShader(programs[1]);
-
-	glBindVertexArray(0);
 	
 	LOG_INFO("Done initilaizing font renderer");
 }
@@ -0,0 +1,92 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this file in your GDW games.
+//
+// This file implements the TTK view frustum
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#include "TTK/Frustum.h"
+
+#ifdef TTK_FRUSTUM_SSE
+#include <xmmintrin.h>
+#endif
+
+TTK::Frustum::Frustum() :
+	Frustum(glm::mat4(1.0f))
+{ }
+
+TTK::Frustum::Frustum(const glm::mat4& viewProjection) {
+	Update(viewProjection);
+}
+
+void TTK::Frustum::Update(const glm::mat4& viewProjection) {
+	// GLM is column major, so we need to pull out the rows ourselves
+	glm::vec4 rows[4];
+	for (int ix = 0; ix < 4; ix++)
+		rows[ix] = glm::vec4(viewProjection[0][ix], viewProjection[1][ix], viewProjection[2][ix], viewProjection[3][ix]);
+
+	// Left, right, bottom, top, near, far
+	glm::vec4 planes[6] = {
+		rows[3] + rows[0], rows[3] - rows[0],
+		rows[3] + rows[1], rows[3] - rows[1],
+		rows[3] + rows[2], rows[3] - rows[2]
+	};
+
+	for (int ix = 0; ix < 8; ix++) {
+		glm::vec4 plane = planes[ix % 6];
+		// Normalizing lets us compare distances against radii directly
+		float length = glm::length(glm::vec3(plane));
+		if (length > 0.0f)
+			plane /= length;
+		m_NormalX[ix] = plane.x;
+		m_NormalY[ix] = plane.y;
+		m_NormalZ[ix] = plane.z;
+		m_Distance[ix] = plane.w;
+	}
+}
+
+bool TTK::Frustum::TestSphere(const glm::vec3& center, float radius) const {
+	return __TestCenterExtents(center, glm::vec3(0.0f), radius);
+}
+
+bool TTK::Frustum::TestAABB(const glm::vec3& min, const glm::vec3& max) const {
+	return __TestCenterExtents((min + max) * 0.5f, (max - min) * 0.5f, 0.0f);
+}
+
+bool TTK::Frustum::__TestCenterExtents(const glm::vec3& center, const glm::vec3& extents, float radius) const {
+	// For each plane, the volume is outside if dot(n, c) + d + dot(|n|, e) + r < 0
+#ifdef TTK_FRUSTUM_SSE
+	const __m128 signMask = _mm_set1_ps(-0.0f);
+	const __m128 cx = _mm_set1_ps(center.x), cy = _mm_set1_ps(center.y), cz = _mm_set1_ps(center.z);
+	const __m128 ex = _mm_set1_ps(extents.x), ey = _mm_set1_ps(extents.y), ez = _mm_set1_ps(extents.z);
+	const __m128 r = _mm_set1_ps(radius);
+
+	int outside = 0;
+	for (int ix = 0; ix < 8; ix += 4) {
+		__m128 nx = _mm_load_ps(m_NormalX + ix);
+		__m128 ny = _mm_load_ps(m_NormalY + ix);
+		__m128 nz = _mm_load_ps(m_NormalZ + ix);
+		__m128 dist = _mm_add_ps(_mm_load_ps(m_Distance + ix), r);
+		dist = _mm_add_ps(dist, _mm_mul_ps(nx, cx));
+		dist = _mm_add_ps(dist, _mm_mul_ps(ny, cy));
+		dist = _mm_add_ps(dist, _mm_mul_ps(nz, cz));
+		dist = _mm_add_ps(dist, _mm_mul_ps(_mm_andnot_ps(signMask, nx), ex));
+		dist = _mm_add_ps(dist, _mm_mul_ps(_mm_andnot_ps(signMask, ny), ey));
+		dist = _mm_add_ps(dist, _mm_mul_ps(_mm_andnot_ps(signMask, nz), ez));
+		outside |= _mm_movemask_ps(_mm_cmplt_ps(dist, _mm_setzero_ps()));
+	}
+	return outside == 0;
+#else
+	for (int ix = 0; ix < 6; ix++) {
+		float dist = m_Distance[ix] + radius +
+			m_NormalX[ix] * center.x + m_NormalY[ix] * center.y + m_NormalZ[ix] * center.z +
+			glm::abs(m_NormalX[ix]) * extents.x + glm::abs(m_NormalY[ix]) * extents.y + glm::abs(m_NormalZ[ix]) * extents.z;
+		if (dist < 0.0f)
+			return false;
+	}
+	return true;
+#endif
+}
@@ -13,6 +13,11 @@
 
 #include "TTK/GraphicsUtils.h"
 #include "TTK/TTKContext.h"
+#include "TTK/GLState.h"
+#include "TTK/SpriteBatch.h"
+#include "TTK/Tilemap.h"
+#include "TTK/AsyncTextureLoader.h"
+#include "TTK/ResourceRegistry.h"
 #include <GLM/gtc/matrix_transform.inl>
 
 #include "imgui.h"
@@ -46,10 +51,11 @@ void TTK::Graphics::SetViewport(int x, int y, int w, int h)
 }
 
 void TTK::Graphics::SetDepthEnabled(bool isEnabled) {
-	if (isEnabled)
-		glEnable(GL_DEPTH_TEST);
-	else
-		glDisable(GL_DEPTH_TEST);
+	GLState::SetDepthTestEnabled(isEnabled);
+}
+
+void TTK::Graphics::SetCullingEnabled(bool isEnabled) {
+	TTK::Context::Instance().SetCullingEnabled(isEnabled);
 }
 
 void TTK::Graphics::SetCameraMatrix(const glm::mat4& view) {
@@ -70,30 +76,42 @@ void TTK::Graphics::ClearScreen() {
 
 void TTK::Graphics::EndFrame() {
 	TTK::Context::Instance().Flush();
+	// Background texture loads are streamed in after the frame's draws have been submitted
+	if (TTK::AsyncTextureLoader::IsCreated())
+		TTK::AsyncTextureLoader::Instance().Pump();
 }
 
 void TTK::Graphics::DrawGrid(float gridWidth, AlignMode mode) {
-	// Note: since we want to support both Y-Up and Z-Up, our points are a little
-	// more complex. We set the y in z-up mode, or z in y-up mode. We use ternary
-	// operators to keep the code from getting large
-	const float gridMin{ -10.0f * gridWidth }, gridMax{ 10.0f * gridWidth };
-	for(int x = -10; x <= 10; x++) {
-		TTK::Context::Instance().AddLine(
-			{ x * gridWidth, mode == TTK::AlignMode::ZUp ? gridMin : 0, mode == AlignMode::YUp ? gridMin : 0 },
-			{ x * gridWidth, mode == AlignMode::ZUp ? gridMax : 0, mode == AlignMode::YUp ? gridMax : 0 },
-			x == 0 ? glm::vec4(0.0f, 0.0f, 1.0f, 1.0f) : glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-		for(int y = -10; y <= 10; y++) {
-			TTK::Context::Instance().AddLine(
-				{ gridMin, mode == AlignMode::ZUp ? y * gridWidth : 0, mode == AlignMode::YUp ? y * gridWidth : 0 },
-				{ gridMax, mode == AlignMode::ZUp ? y * gridWidth : 0, mode == AlignMode::YUp ? y * gridWidth : 0 },
-				y == 0 ? glm::vec4(1.0f, 0.0f, 0.0f, 1.0f) : glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+	// We bake a unit grid in the XZ plane once, and then scale it (and rotate it into the XY plane for Z-up)
+	if (_gridMesh == nullptr) {
+		_gridMesh = std::make_shared<DebugMesh>();
+		for (int ix = -10; ix <= 10; ix++) {
+			float offset = static_cast<float>(ix);
+			_gridMesh->AddLine({ offset, 0.0f, -10.0f }, { offset, 0.0f, 10.0f }, ix == 0 ? glm::vec4(0.0f, 0.0f, 1.0f, 1.0f) : glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+			_gridMesh->AddLine({ -10.0f, 0.0f, offset }, { 10.0f, 0.0f, offset }, ix == 0 ? glm::vec4(1.0f, 0.0f, 0.0f, 1.0f) : glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
 		}
+		_gridMesh->Bake();
 	}
+
+	glm::mat4 transform = glm::scale(glm::mat4(1.0f), glm::vec3(gridWidth));
+	if (mode == AlignMode::ZUp)
+		transform = glm::rotate(transform, glm::radians(90.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+	TTK::Context::Instance().DrawDebugMesh(_gridMesh, transform);
+}
+
+void TTK::Graphics::DrawDebugMesh(const DebugMesh::Ptr& mesh, const glm::mat4& transform) {
+	TTK::Context::Instance().DrawDebugMesh(mesh, transform);
 }
 
 void TTK::Graphics::Cleanup() {
+	// Our cached meshes need to be released while we still have a GL context
+	_gridMesh = nullptr;
 	TTK::Context::DestroyContext();
 	TTK::FontRenderer::DestroyContext();
+	TTK::SpriteBatch::DestroyContext();
+	TTK::Tilemap::DestroyContext();
+	TTK::AsyncTextureLoader::DestroyContext();
+	TTK::ResourceRegistry<TTK::Texture2D>::DestroyContext();
 }
 
 void TTK::Graphics::DrawText2D(const std::string& text, float posX, float posY, float fontSize) {
@@ -101,7 +119,9 @@ void TTK::Graphics::DrawText2D(const std::string& text, float posX, float posY,
 }
 
 void TTK::Graphics::DrawText2D(const std::string& text, float posX, float posY, const glm::vec4& color, float fontSize) {
-	TTK::Context::Instance().RenderText(text.c_str(), { posX, posY }, color, fontSize / 32.0f);
+	// The default font uses a distance field, so we can scale it to any size without it blurring
+	TTK::Context& context = TTK::Context::Instance();
+	context.RenderText(text.c_str(), { posX, posY }, color, fontSize / static_cast<float>(context.GetDefaultFont()->GetSize()));
 }
 
 void TTK::Graphics::InitImGUI(GLFWwindow* window) {
@@ -252,3 +272,11 @@ void TTK::Graphics::DrawSphere(float* p0, float size, float* colour) {
 	glm::mat4 transform = glm::translate(glm::mat4(1.0f), *(glm::vec3*)p0) * glm::scale(glm::mat4(1.0f), glm::vec3(size));
 	TTK::Context::Instance().DrawSphere(transform, DEFAULT_BLACK(colour));
 }
+
+void TTK::Graphics::DrawCylinder(const glm::mat4& transform, const glm::vec4& colour) {
+	TTK::Context::Instance().DrawCylinder(transform, colour);
+}
+
+void TTK::Graphics::DrawCapsule(const glm::mat4& transform, const glm::vec4& colour) {
+	TTK::Context::Instance().DrawCapsule(transform, colour);
+}
\ No newline at end of file
@@ -11,82 +11,113 @@
 //////////////////////////////////////////////////////////////////////////
 #include "TTK/MeshHelper.h"
 
-#include "TTK/Teapot.h"
-#include "TTK/Sphere.h"
-#include "TTK/Cube.h"
 #include "Logging.h"
+#include "TTK/GLState.h"
 
 
 TTK::Impl::MeshHelper::~MeshHelper() {
-	glDeleteBuffers(1, &m_Teapot.VBO);
-	glDeleteBuffers(1, &m_Sphere.VBO);
-	glDeleteBuffers(1, &m_Cube.VBO);
-	glDeleteVertexArrays(1, &m_Teapot.VAO);
-	glDeleteVertexArrays(1, &m_Sphere.VAO);
-	glDeleteVertexArrays(1, &m_Cube.VAO);
+	for (mesh& m : m_Meshes)
+		__FreeMesh(m);
 	glDeleteProgram(m_Shader);
 }
 
-void TTK::Impl::MeshHelper::RenderTeapot(const glm::mat4& transform, const glm::vec4& color) const {
-	glUseProgram(m_Shader);
-	glm::mat4 t = Context::Instance().GetViewProjection() * transform;
-	glProgramUniformMatrix4fv(m_Shader, 0, 1, FALSE, &t[0][0]);
-	glProgramUniform4fv(m_Shader, 1, 1, &color[0]);
-	glBindVertexArray(m_Teapot.VAO);
-	glDrawArrays(GL_TRIANGLES, 0, sizeof(TeapotData) / (sizeof(float) * 6));
+void TTK::Impl::MeshHelper::SetTessellation(int slices, int stacks) {
+	// Our meshes use 16 bit indices, a sphere has slices * (stacks - 1) + 2 vertices, and the other shapes have fewer
+	const int maxVertices = 0xFFFF;
+	const int maxSlices = (maxVertices - 2) / 2;
+	const int maxStacks = (maxVertices - 2) / glm::clamp(slices, 3, maxSlices);
+	if (slices > maxSlices || stacks > maxStacks)
+		LOG_WARN("Primitive tessellation of {}x{} is too fine for 16 bit indices, it will be clamped", slices, stacks);
+	slices = glm::clamp(slices, 3, maxSlices);
+	stacks = glm::clamp(stacks, 2, maxStacks);
+
+	mesh* sphere = &m_Meshes[static_cast<size_t>(MeshShape::Sphere)];
+	mesh* cylinder = &m_Meshes[static_cast<size_t>(MeshShape::Cylinder)];
+	mesh* capsule = &m_Meshes[static_cast<size_t>(MeshShape::Capsule)];
+	__FreeMesh(*sphere);
+	__FreeMesh(*cylinder);
+	__FreeMesh(*capsule);
+	*sphere = __MakeMesh(Primitives::Sphere(slices, stacks));
+	*cylinder = __MakeMesh(Primitives::Cylinder(slices));
+	*capsule = __MakeMesh(Primitives::Capsule(slices, glm::max(stacks / 2, 1)));
 }
 
-void TTK::Impl::MeshHelper::RenderSphere(const glm::mat4& transform, const glm::vec4& color) const {
-	glUseProgram(m_Shader);
-	glm::mat4 t = Context::Instance().GetViewProjection() * transform;
-	glProgramUniformMatrix4fv(m_Shader, 0, 1, FALSE, &t[0][0]);
-	glProgramUniform4fv(m_Shader, 1, 1, &color[0]);
-	glBindVertexArray(m_Sphere.VAO);
-	glDrawArrays(GL_TRIANGLES, 0, sizeof(SphereData) / (sizeof(float) * 6));
+void TTK::Impl::MeshHelper::__FreeMesh(mesh& m) const {
+	glDeleteBuffers(1, &m.VBO);
+	glDeleteBuffers(1, &m.EBO);
+	GLState::DeleteVertexArrays(1, &m.VAO);
+	m.VBO = m.EBO = m.VAO = 0;
 }
 
-void TTK::Impl::MeshHelper::RenderCube(const glm::mat4& transform, const glm::vec4& color) const
-{
-	glUseProgram(m_Shader);
-	glm::mat4 t = Context::Instance().GetViewProjection() * transform;
-	glProgramUniformMatrix4fv(m_Shader, 0, 1, FALSE, &t[0][0]);
-	glProgramUniform4fv(m_Shader, 1, 1, &color[0]);
-	glBindVertexArray(m_Cube.VAO);
-	glDrawArrays(GL_TRIANGLES, 0, sizeof(CubeData) / (sizeof(float) * 6));
+void TTK::Impl::MeshHelper::RenderInstanced(MeshShape shape, const glm::mat4& viewProjection, const StreamingBuffer& instances) {
+	mesh& m = m_Meshes[static_cast<size_t>(shape)];
+
+	// The instance stream may have grown since we last drew, so we may need to re-point our VAO
+	if (m.InstanceVBO != instances.GetHandle()) {
+		m.InstanceVBO = instances.GetHandle();
+		glVertexArrayVertexBuffer(m.VAO, 1, m.InstanceVBO, 0, sizeof(Context::MeshInstance));
+	}
+
+	GLState::UseProgram(m_Shader);
+	glProgramUniformMatrix4fv(m_Shader, 0, 1, GL_FALSE, &viewProjection[0][0]);
+	glProgramUniform3fv(m_Shader, 1, 1, &m.Offset[0]);
+	glProgramUniform3fv(m_Shader, 2, 1, &m.Scale[0]);
+	GLState::BindVertexArray(m.VAO);
+	glDrawElementsInstancedBaseInstance(GL_TRIANGLES, m.IndexCount, GL_UNSIGNED_SHORT, nullptr,
+		static_cast<GLsizei>(instances.Count()), static_cast<GLuint>(instances.FirstElement()));
 }
 
-TTK::Impl::MeshHelper::mesh TTK::Impl::MeshHelper::__MakeMesh(const float* data, size_t size) const {
+TTK::Impl::MeshHelper::mesh TTK::Impl::MeshHelper::__MakeMesh(const Primitives::MeshData& data) const {
 	mesh result;
+	result.IndexCount = static_cast<GLsizei>(data.Indices.size());
+	result.Offset = data.Offset;
+	result.Scale = data.Scale;
+	result.InstanceVBO = 0;
 	glCreateVertexArrays(1, &result.VAO);
-	glBindVertexArray(result.VAO);
+
+	// Our meshes never change, so we can use immutable storage
 	glCreateBuffers(1, &result.VBO);
-	glBindBuffer(GL_ARRAY_BUFFER, result.VBO);
-	glNamedBufferData(result.VBO, size, data, GL_DYNAMIC_DRAW);
-	glEnableVertexAttribArray(0);
-	glVertexAttribPointer(0, 3, GL_FLOAT, false, sizeof(float) * 6, 0);
+	glNamedBufferStorage(result.VBO, data.Vertices.size() * sizeof(Primitives::PackedPosition), data.Vertices.data(), 0);
+	glCreateBuffers(1, &result.EBO);
+	glNamedBufferStorage(result.EBO, data.Indices.size() * sizeof(uint16_t), data.Indices.data(), 0);
+	glVertexArrayElementBuffer(result.VAO, result.EBO);
+
+	// Binding 0 holds our packed vertex positions, these get expanded back to model space in the shader
+	glVertexArrayVertexBuffer(result.VAO, 0, result.VBO, 0, sizeof(Primitives::PackedPosition));
+	VertexLayout(sizeof(Primitives::PackedPosition)).Add(0, 3, GL_SHORT, true).Apply(result.VAO, 0);
+
+	// Binding 1 holds our per-instance data, starting at location 1
+	Context::MeshInstance::GetLayout().Apply(result.VAO, 1, 1);
 	return result;
 }
 
 TTK::Impl::MeshHelper::MeshHelper()
 {
-	m_Teapot = __MakeMesh(TeapotData, sizeof(TeapotData));
-	m_Sphere = __MakeMesh(SphereData, sizeof(SphereData));
-	m_Cube   = __MakeMesh(CubeData, sizeof(CubeData));
-	
-	glBindVertexArray(0);
+	m_Meshes[static_cast<size_t>(MeshShape::Teapot)]   = __MakeMesh(Primitives::Teapot());
+	m_Meshes[static_cast<size_t>(MeshShape::Sphere)]   = __MakeMesh(Primitives::Sphere());
+	m_Meshes[static_cast<size_t>(MeshShape::Cube)]     = __MakeMesh(Primitives::Cube());
+	m_Meshes[static_cast<size_t>(MeshShape::Cylinder)] = __MakeMesh(Primitives::Cylinder());
+	m_Meshes[static_cast<size_t>(MeshShape::Capsule)]  = __MakeMesh(Primitives::Capsule());
 	
 	const char* vsSource = R"LIT(#version 430
             layout (location = 0) in vec3 vertexPosition;
-            layout (location = 0) uniform mat4 xTransform;	
+            layout (location = 1) in mat4 instanceTransform;
+            layout (location = 5) in vec4 instanceColor;
+            layout (location = 0) uniform mat4 xViewProjection;
+            layout (location = 1) uniform vec3 xPositionOffset;
+            layout (location = 2) uniform vec3 xPositionScale;
+            layout (location = 0) out vec4 fragmentColor;
             void main() {
-                gl_Position = xTransform * vec4(vertexPosition, 1);
+                vec3 position = xPositionOffset + vertexPosition * xPositionScale;
+                gl_Position = xViewProjection * instanceTransform * vec4(position, 1);
+                fragmentColor = instanceColor;
             })LIT";
 
-	const char* fsSource = R"LIT(#version 430   
-            layout (location = 1) uniform vec4 xColor;		
+	const char* fsSource = R"LIT(#version 430
+            layout (location = 0) in vec4 fragColor;
             out vec4 frag_color;            	
             void main() {
-                frag_color = xColor;
+                frag_color = fragColor;
             })LIT";
 
 	m_Shader = glCreateProgram();
@@ -0,0 +1,173 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this file in your GDW games.
+//
+// This file implements the TTK primitive geometry generators
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#include "TTK/PrimitiveGeometry.h"
+
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <unordered_map>
+#include <GLM/gtc/constants.hpp>
+#include <GLM/gtc/type_precision.hpp>
+#include "TTK/TeapotMesh.h"
+#include "Logging.h"
+
+namespace TTK::Primitives
+{
+	// A single ring of vertices around the Y axis, rings with a radius of zero collapse into a single pole vertex
+	struct Ring {
+		float Radius;
+		float Y;
+	};
+
+	// Builds a surface of revolution from a list of rings, ordered from top (+Y) to bottom (-Y)
+	static MeshData __Lathe(const std::vector<Ring>& rings, int slices) {
+		std::vector<glm::vec3> positions;
+		std::vector<uint32_t>  indices;
+		std::vector<uint32_t>  ringStarts;
+
+		for (const Ring& ring : rings) {
+			ringStarts.push_back(static_cast<uint32_t>(positions.size()));
+			if (ring.Radius == 0.0f) {
+				positions.push_back({ 0.0f, ring.Y, 0.0f });
+			} else {
+				for (int ix = 0; ix < slices; ix++) {
+					float angle = glm::two_pi<float>() * ix / slices;
+					positions.push_back({ glm::cos(angle) * ring.Radius, ring.Y, glm::sin(angle) * ring.Radius });
+				}
+			}
+		}
+
+		// Stitch each ring to the one below it, pole vertices are shared by every slice
+		for (size_t r = 0; r + 1 < rings.size(); r++) {
+			bool topPole = rings[r].Radius == 0.0f;
+			bool bottomPole = rings[r + 1].Radius == 0.0f;
+			for (int ix = 0; ix < slices; ix++) {
+				int next = (ix + 1) % slices;
+				uint32_t a0 = ringStarts[r] + (topPole ? 0 : ix);
+				uint32_t a1 = ringStarts[r] + (topPole ? 0 : next);
+				uint32_t b0 = ringStarts[r + 1] + (bottomPole ? 0 : ix);
+				uint32_t b1 = ringStarts[r + 1] + (bottomPole ? 0 : next);
+				if (!topPole)
+					indices.insert(indices.end(), { b0, a0, a1 });
+				if (!bottomPole)
+					indices.insert(indices.end(), { b0, a1, b1 });
+			}
+		}
+
+		return Pack(positions, indices);
+	}
+
+	MeshData Pack(const std::vector<glm::vec3>& positions, const std::vector<uint32_t>& indices) {
+		MeshData result;
+
+		glm::vec3 min(std::numeric_limits<float>::max()), max(-std::numeric_limits<float>::max());
+		for (const glm::vec3& pos : positions) {
+			min = glm::min(min, pos);
+			max = glm::max(max, pos);
+		}
+		result.Offset = (min + max) * 0.5f;
+		result.Scale = (max - min) * 0.5f;
+		for (int ix = 0; ix < 3; ix++) {
+			if (result.Scale[ix] == 0.0f)
+				result.Scale[ix] = 1.0f;
+		}
+
+		// Quantize our positions, and then merge any that land on the same packed value
+		LOG_ASSERT(positions.size() <= 0xFFFF, "Primitive meshes are limited to 65535 vertices, since they use 16 bit indices");
+		std::unordered_map<uint64_t, uint16_t> lookup;
+		std::vector<uint16_t> remap(positions.size());
+		for (size_t ix = 0; ix < positions.size(); ix++) {
+			glm::vec3 normalized = glm::clamp((positions[ix] - result.Offset) / result.Scale, -1.0f, 1.0f);
+			glm::i16vec3 packed = glm::i16vec3(glm::round(normalized * 32767.0f));
+			uint64_t key = (static_cast<uint64_t>(static_cast<uint16_t>(packed.x)) << 32) |
+				(static_cast<uint64_t>(static_cast<uint16_t>(packed.y)) << 16) |
+				static_cast<uint64_t>(static_cast<uint16_t>(packed.z));
+
+			auto it = lookup.find(key);
+			if (it == lookup.end()) {
+				it = lookup.emplace(key, static_cast<uint16_t>(result.Vertices.size())).first;
+				result.Vertices.push_back({ packed.x, packed.y, packed.z, 0 });
+			}
+			remap[ix] = it->second;
+		}
+
+		result.Indices.reserve(indices.size());
+		for (uint32_t index : indices)
+			result.Indices.push_back(remap[index]);
+
+		return result;
+	}
+
+	MeshData Sphere(int slices, int stacks) {
+		slices = glm::max(slices, 3);
+		stacks = glm::max(stacks, 2);
+
+		std::vector<Ring> rings;
+		for (int ix = 0; ix <= stacks; ix++) {
+			float angle = glm::pi<float>() * ix / stacks;
+			rings.push_back({ ix == 0 || ix == stacks ? 0.0f : glm::sin(angle), glm::cos(angle) });
+		}
+		return __Lathe(rings, slices);
+	}
+
+	MeshData Cube() {
+		// Corners are indexed by their sign bits, with X in bit 0, Y in bit 1 and Z in bit 2
+		std::vector<glm::vec3> positions;
+		for (int ix = 0; ix < 8; ix++)
+			positions.push_back({ ix & 1 ? 0.5f : -0.5f, ix & 2 ? 0.5f : -0.5f, ix & 4 ? 0.5f : -0.5f });
+
+		// Each face as a counter-clockwise quad when viewed from outside the cube
+		const uint32_t faces[6][4] = {
+			{ 1, 3, 7, 5 }, // +X
+			{ 0, 4, 6, 2 }, // -X
+			{ 2, 6, 7, 3 }, // +Y
+			{ 0, 1, 5, 4 }, // -Y
+			{ 4, 5, 7, 6 }, // +Z
+			{ 0, 2, 3, 1 }  // -Z
+		};
+		std::vector<uint32_t> indices;
+		for (const auto& face : faces)
+			indices.insert(indices.end(), { face[0], face[1], face[2], face[0], face[2], face[3] });
+
+		return Pack(positions, indices);
+	}
+
+	MeshData Cylinder(int slices) {
+		return __Lathe({ { 0.0f, 1.0f }, { 1.0f, 1.0f }, { 1.0f, -1.0f }, { 0.0f, -1.0f } }, glm::max(slices, 3));
+	}
+
+	MeshData Capsule(int slices, int stacks) {
+		slices = glm::max(slices, 3);
+		stacks = glm::max(stacks, 1);
+
+		// Each hemisphere gets it's own set of rings, with the equators forming the cylindrical section
+		std::vector<Ring> rings;
+		for (int ix = 0; ix <= stacks; ix++) {
+			float angle = glm::half_pi<float>() * ix / stacks;
+			rings.push_back({ ix == 0 ? 0.0f : glm::sin(angle), 1.0f + glm::cos(angle) });
+		}
+		for (int ix = stacks; ix >= 0; ix--) {
+			float angle = glm::half_pi<float>() * ix / stacks;
+			rings.push_back({ ix == 0 ? 0.0f : glm::sin(angle), -1.0f - glm::cos(angle) });
+		}
+		return __Lathe(rings, slices);
+	}
+
+	MeshData Teapot() {
+		MeshData result;
+		result.Offset = glm::vec3(TeapotOffset[0], TeapotOffset[1], TeapotOffset[2]);
+		result.Scale = glm::vec3(TeapotScale[0], TeapotScale[1], TeapotScale[2]);
+		result.Vertices.resize(std::size(TeapotVertices) / 4);
+		memcpy(result.Vertices.data(), TeapotVertices, sizeof(TeapotVertices));
+		result.Indices.assign(std::begin(TeapotIndices), std::end(TeapotIndices));
+		return result;
+	}
+}
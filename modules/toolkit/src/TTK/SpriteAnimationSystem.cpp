@@ -0,0 +1,220 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this file in your GDW games.
+//
+// This file implements the TTK sprite sheets and sprite animation system
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#include "TTK/SpriteAnimationSystem.h"
+
+#include <algorithm>
+#include <thread>
+#include <unordered_map>
+#include "Logging.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define TTK_SPRITE_ANIMATION_SSE 1
+#include <xmmintrin.h>
+#endif
+
+TTK::SpriteSheet::SpriteSheet() :
+	m_Texture(std::make_shared<Texture2D>()),
+	m_FrameRects(),
+	m_FrameLengths()
+{ }
+
+void TTK::SpriteSheet::Slice(const char* fileName, int numSpritesPerRow, int numRows, float animTime) {
+	m_Texture = Texture2D::LoadShared(fileName);
+	m_FrameRects.clear();
+	m_FrameLengths.clear();
+
+	float frameTime = animTime == 0.0f ? 1.0f / 60.0f : animTime / (numSpritesPerRow * numRows);
+	glm::vec2 spriteSize = glm::vec2(1.0f / numSpritesPerRow, 1.0f / numRows);
+	for (int row = 0; row < numRows; row++) {
+		for (int col = 0; col < numSpritesPerRow; col++) {
+			glm::vec2 min = glm::vec2(col, row) * spriteSize;
+			m_FrameRects.push_back(glm::vec4(min, min + spriteSize));
+			m_FrameLengths.push_back(frameTime);
+		}
+	}
+}
+
+void TTK::SpriteSheet::SetFrameLength(int frameNumber, float time) {
+	if (frameNumber >= 0 && frameNumber < static_cast<int>(m_FrameLengths.size()))
+		m_FrameLengths[frameNumber] = time;
+	else
+		LOG_ERROR("Sprite sheet frame {} does not exist!", frameNumber);
+}
+
+TTK::SpriteAnimationSystem::SpriteAnimationSystem() { }
+
+TTK::SpriteAnimationSystem::Handle TTK::SpriteAnimationSystem::Add(const SpriteSheet::Ptr& sheet, bool looping) {
+	LOG_ASSERT(sheet != nullptr && sheet->GetNumberOfFrames() > 0, "Animators require a sprite sheet with at least one frame");
+
+	// We will only ever have a handful of sheets, so a linear search is plenty
+	auto it = std::find(m_Sheets.begin(), m_Sheets.end(), sheet);
+	uint16_t sheetIndex = static_cast<uint16_t>(it - m_Sheets.begin());
+	if (it == m_Sheets.end())
+		m_Sheets.push_back(sheet);
+
+	Handle handle;
+	if (!m_FreeHandles.empty()) {
+		handle = m_FreeHandles.back();
+		m_FreeHandles.pop_back();
+	} else {
+		handle = static_cast<Handle>(m_HandleToIndex.size());
+		m_HandleToIndex.push_back(0);
+	}
+	m_HandleToIndex[handle] = static_cast<uint32_t>(m_Frames.size());
+	m_IndexToHandle.push_back(handle);
+
+	m_FrameTimes.push_back(0.0f);
+	m_FrameLengths.push_back(sheet->GetFrameLength(0));
+	m_Frames.push_back(0);
+	m_SheetIndices.push_back(sheetIndex);
+	m_Looping.push_back(looping ? 1 : 0);
+	m_Transforms.push_back(glm::mat4(1.0f));
+	m_Colors.push_back(PackRGBA8(glm::vec4(1.0f)));
+	return handle;
+}
+
+void TTK::SpriteAnimationSystem::Remove(Handle handle) {
+	// Move the last animator into the removed one's place, so that our arrays stay tightly packed
+	uint32_t index = m_HandleToIndex[handle];
+	uint32_t last = static_cast<uint32_t>(m_Frames.size() - 1);
+	if (index != last) {
+		m_FrameTimes[index] = m_FrameTimes[last];
+		m_FrameLengths[index] = m_FrameLengths[last];
+		m_Frames[index] = m_Frames[last];
+		m_SheetIndices[index] = m_SheetIndices[last];
+		m_Looping[index] = m_Looping[last];
+		m_Transforms[index] = m_Transforms[last];
+		m_Colors[index] = m_Colors[last];
+		m_IndexToHandle[index] = m_IndexToHandle[last];
+		m_HandleToIndex[m_IndexToHandle[index]] = index;
+	}
+	m_FrameTimes.pop_back();
+	m_FrameLengths.pop_back();
+	m_Frames.pop_back();
+	m_SheetIndices.pop_back();
+	m_Looping.pop_back();
+	m_Transforms.pop_back();
+	m_Colors.pop_back();
+	m_IndexToHandle.pop_back();
+	m_FreeHandles.push_back(handle);
+}
+
+void TTK::SpriteAnimationSystem::ResetAnimation(Handle handle) {
+	uint32_t index = m_HandleToIndex[handle];
+	m_FrameTimes[index] = 0.0f;
+	m_Frames[index] = 0;
+	m_FrameLengths[index] = m_Sheets[m_SheetIndices[index]]->GetFrameLength(0);
+}
+
+void TTK::SpriteAnimationSystem::Update(float deltaTime, size_t threadCount) {
+	size_t count = GetCount();
+	threadCount = glm::min(threadCount, count / MinAnimatorsPerThread);
+	if (threadCount <= 1) {
+		UpdateRange(0, count, deltaTime);
+		return;
+	}
+
+	// Ranges are kept to multiples of 4, so that only the last range needs to handle a partial SSE group
+	size_t perThread = ((count + threadCount - 1) / threadCount + 3) & ~static_cast<size_t>(3);
+	std::vector<std::thread> workers;
+	workers.reserve(threadCount - 1);
+	for (size_t ix = 1; ix < threadCount; ix++)
+		workers.emplace_back(&SpriteAnimationSystem::UpdateRange, this, ix * perThread, (ix + 1) * perThread, deltaTime);
+	UpdateRange(0, perThread, deltaTime);
+	for (std::thread& worker : workers)
+		worker.join();
+}
+
+void TTK::SpriteAnimationSystem::UpdateRange(size_t begin, size_t end, float deltaTime) {
+	end = glm::min(end, GetCount());
+	size_t ix = begin;
+
+	#ifdef TTK_SPRITE_ANIMATION_SSE
+	// Advance 4 timers at a time, and only drop to scalar code for the animators that need to change frames
+	__m128 delta = _mm_set1_ps(deltaTime);
+	for (; ix + 4 <= end; ix += 4) {
+		__m128 time = _mm_add_ps(_mm_loadu_ps(&m_FrameTimes[ix]), delta);
+		_mm_storeu_ps(&m_FrameTimes[ix], time);
+		int mask = _mm_movemask_ps(_mm_cmpgt_ps(time, _mm_loadu_ps(&m_FrameLengths[ix])));
+		if (mask != 0) {
+			for (int lane = 0; lane < 4; lane++) {
+				if (mask & (1 << lane))
+					__Advance(ix + lane);
+			}
+		}
+	}
+	#endif
+
+	for (; ix < end; ix++) {
+		m_FrameTimes[ix] += deltaTime;
+		if (m_FrameTimes[ix] > m_FrameLengths[ix])
+			__Advance(ix);
+	}
+}
+
+void TTK::SpriteAnimationSystem::__Advance(size_t index) {
+	const SpriteSheet& sheet = *m_Sheets[m_SheetIndices[index]];
+	uint32_t frameCount = static_cast<uint32_t>(sheet.GetNumberOfFrames());
+
+	// Large time steps may skip over several frames
+	while (m_FrameTimes[index] > m_FrameLengths[index]) {
+		if (!m_Looping[index] && m_Frames[index] + 1 >= frameCount) {
+			// Non looping animations hold on their last frame
+			m_FrameTimes[index] = m_FrameLengths[index];
+			return;
+		}
+		m_FrameTimes[index] -= m_FrameLengths[index];
+		m_Frames[index] = (m_Frames[index] + 1) % frameCount;
+		m_FrameLengths[index] = sheet.GetFrameLength(m_Frames[index]);
+		// Guard against frames with no length, which would otherwise never finish advancing
+		if (m_FrameLengths[index] <= 0.0f) {
+			m_FrameTimes[index] = 0.0f;
+			return;
+		}
+	}
+}
+
+void TTK::SpriteAnimationSystem::Submit(SpriteBatch& batch) const {
+	// Reserve one block in the batch for each texture, then give each sheet it's own range within it's texture's block.
+	// Sheets sliced from the same file share a texture, so reserving per sheet would resize a block we had already
+	// handed out. Blocks for different textures live in different batches, so reserving one can't move another
+	std::vector<size_t> counts(m_Sheets.size(), 0);
+	for (uint16_t sheet : m_SheetIndices)
+		counts[sheet]++;
+
+	std::unordered_map<GLuint, size_t> textureCounts;
+	for (size_t ix = 0; ix < m_Sheets.size(); ix++) {
+		if (counts[ix] > 0)
+			textureCounts[m_Sheets[ix]->GetTexture().GetID()] += counts[ix];
+	}
+
+	// We reserve in sheet order, so that the order textures are drawn in doesn't depend on the map
+	std::unordered_map<GLuint, SpriteBatch::SpriteInstance*> blocks;
+	std::vector<SpriteBatch::SpriteInstance*> cursors(m_Sheets.size(), nullptr);
+	for (size_t ix = 0; ix < m_Sheets.size(); ix++) {
+		if (counts[ix] > 0) {
+			GLuint texture = m_Sheets[ix]->GetTexture().GetID();
+			auto it = blocks.find(texture);
+			if (it == blocks.end())
+				it = blocks.emplace(texture, batch.Reserve(texture, textureCounts[texture])).first;
+			cursors[ix] = it->second;
+			it->second += counts[ix];
+		}
+	}
+
+	for (size_t ix = 0; ix < m_Frames.size(); ix++) {
+		uint16_t sheet = m_SheetIndices[ix];
+		SpriteBatch::SpriteInstance* out = cursors[sheet]++;
+		out->Transform = m_Transforms[ix];
+		out->UVRect = m_Sheets[sheet]->GetFrameRect(m_Frames[ix]);
+		out->Color = m_Colors[ix];
+	}
+}
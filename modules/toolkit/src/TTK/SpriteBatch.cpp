@@ -0,0 +1,185 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this file in your GDW games.
+//
+// This file implements the TTK sprite batch
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#include "TTK/SpriteBatch.h"
+
+#include <algorithm>
+#include <cstring>
+#include "Logging.h"
+#include "TTK/GLState.h"
+#include "TTK/VertexLayout.h"
+
+TTK::SpriteBatch* TTK::SpriteBatch::m_Instance = nullptr;
+
+TTK::SpriteBatch::SpriteBatch() {
+	LOG_INFO("Initializing sprite batch");
+
+	m_LastBatch = 0;
+
+	// Every sprite shares the same quad, drawn as a triangle strip so that we don't need an index buffer
+	const glm::vec2 corners[4] = {
+		{ -1.0f,  1.0f },
+		{  1.0f,  1.0f },
+		{ -1.0f, -1.0f },
+		{  1.0f, -1.0f }
+	};
+	glCreateBuffers(1, &m_QuadVBO);
+	glNamedBufferStorage(m_QuadVBO, sizeof(corners), corners, 0);
+
+	// We set up our VAO with DSA, so that we don't disturb the currently bound VAO
+	glCreateVertexArrays(1, &m_VAO);
+	VertexLayout(sizeof(glm::vec2))
+		.Float(0, 2)
+		.Apply(m_VAO, 0);
+	glVertexArrayVertexBuffer(m_VAO, 0, m_QuadVBO, 0, sizeof(glm::vec2));
+
+	// The transform takes up locations 1-4, one for each column
+	VertexLayout(sizeof(SpriteInstance), 1)
+		.Float(0, 4, offsetof(SpriteInstance, Transform))
+		.Float(1, 4, offsetof(SpriteInstance, Transform) + sizeof(glm::vec4))
+		.Float(2, 4, offsetof(SpriteInstance, Transform) + sizeof(glm::vec4) * 2)
+		.Float(3, 4, offsetof(SpriteInstance, Transform) + sizeof(glm::vec4) * 3)
+		.Float(4, 4, offsetof(SpriteInstance, UVRect))
+		.RGBA8(5, offsetof(SpriteInstance, Color))
+		.Apply(m_VAO, 1, 1);
+
+	m_Stream = new StreamingBuffer(sizeof(SpriteInstance), InitialInstances);
+	m_BoundVBO = m_Stream->GetHandle();
+	glVertexArrayVertexBuffer(m_VAO, 1, m_BoundVBO, 0, sizeof(SpriteInstance));
+
+	const char* vsSource = R"LIT(#version 440
+            layout (location = 0) in vec2 vertexCorner;
+            layout (location = 1) in mat4 instanceTransform;
+            layout (location = 5) in vec4 instanceUVRect;
+            layout (location = 6) in vec4 instanceColor;
+            layout (location = 0) out vec2 fragmentTexture;
+            layout (location = 1) out vec4 fragmentColor;
+            void main() {
+                gl_Position = instanceTransform * vec4(vertexCorner, 0, 1);
+                // The top of the quad shows the minimum V coordinate
+                vec2 t = vec2(vertexCorner.x * 0.5 + 0.5, 0.5 - vertexCorner.y * 0.5);
+                fragmentTexture = mix(instanceUVRect.xy, instanceUVRect.zw, t);
+                fragmentColor = instanceColor;
+            })LIT";
+
+	const char* fsSource = R"LIT(#version 440
+            layout(binding = 0) uniform sampler2D xSampler;
+            layout (location = 0) in vec2 fragUv;
+            layout (location = 1) in vec4 fragColor;
+            out vec4 frag_color;
+            void main() {
+                frag_color = texture(xSampler, fragUv) * fragColor;
+            })LIT";
+
+	m_ShaderHandle = glCreateProgram();
+
+	GLuint programs[2];
+	programs[0] = glCreateShader(GL_VERTEX_SHADER);
+	glShaderSource(programs[0], 1, &vsSource, NULL);
+	glCompileShader(programs[0]);
+	programs[1] = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(programs[1], 1, &fsSource, NULL);
+	glCompileShader(programs[1]);
+
+	// Attach our two shaders
+	glAttachShader(m_ShaderHandle, programs[0]);
+	glAttachShader(m_ShaderHandle, programs[1]);
+
+	// Perform linking
+	glLinkProgram(m_ShaderHandle);
+
+	// Remove shader parts to save space
+	glDetachShader(m_ShaderHandle, programs[0]);
+	glDeleteShader(programs[0]);
+	glDetachShader(m_ShaderHandle, programs[1]);
+	glDeleteShader(programs[1]);
+
+	LOG_INFO("Done initializing sprite batch");
+}
+
+TTK::SpriteBatch::~SpriteBatch() {
+	delete m_Stream;
+	glDeleteBuffers(1, &m_QuadVBO);
+	glDeleteProgram(m_ShaderHandle);
+	GLState::DeleteVertexArrays(1, &m_VAO);
+}
+
+void TTK::SpriteBatch::Submit(GLuint texture, const glm::mat4& transform, const glm::vec4& uvRect, const glm::vec4& color) {
+	__GetBatch(texture).Instances.push_back({ transform, uvRect, PackRGBA8(color) });
+}
+
+void TTK::SpriteBatch::Submit(const TextureAtlas& atlas, TextureAtlas::Handle region, const glm::mat4& transform, const glm::vec4& color) {
+	LOG_ASSERT(atlas.GetStorage() == AtlasStorage::Pages, "Sprites can only be drawn from atlases that are stored as pages");
+	const AtlasRegion& info = atlas.GetRegion(region);
+	Submit(atlas.GetPageTexture(info.Layer), transform, info.UVRect, color);
+}
+
+TTK::SpriteBatch::SpriteInstance* TTK::SpriteBatch::Reserve(GLuint texture, size_t count) {
+	std::vector<SpriteInstance>& instances = __GetBatch(texture).Instances;
+	size_t first = instances.size();
+	instances.resize(first + count);
+	return instances.data() + first;
+}
+
+TTK::SpriteBatch::Batch& TTK::SpriteBatch::__GetBatch(GLuint texture) {
+	// We will only ever have a handful of textures per frame, so a linear search is plenty
+	if (m_LastBatch >= m_Batches.size() || m_Batches[m_LastBatch].Texture != texture) {
+		m_LastBatch = m_Batches.size();
+		for (size_t ix = 0; ix < m_Batches.size(); ix++) {
+			if (m_Batches[ix].Texture == texture) {
+				m_LastBatch = ix;
+				break;
+			}
+		}
+		if (m_LastBatch == m_Batches.size())
+			m_Batches.push_back({ texture, std::vector<SpriteInstance>() });
+	}
+	return m_Batches[m_LastBatch];
+}
+
+void TTK::SpriteBatch::Flush() {
+	// Batches are kept between frames to reuse their storage, but we drop any for textures that went a frame unused
+	m_Batches.erase(std::remove_if(m_Batches.begin(), m_Batches.end(), [](const Batch& batch) { return batch.Instances.empty(); }), m_Batches.end());
+	m_LastBatch = 0;
+
+	size_t total = 0;
+	for (const Batch& batch : m_Batches)
+		total += batch.Instances.size();
+	if (total == 0)
+		return;
+
+	// We copy all of our batches into the stream at once, so that we only ever wait on one region per frame
+	SpriteInstance* data = m_Stream->Reserve<SpriteInstance>(total);
+	if (m_BoundVBO != m_Stream->GetHandle()) {
+		m_BoundVBO = m_Stream->GetHandle();
+		glVertexArrayVertexBuffer(m_VAO, 1, m_BoundVBO, 0, sizeof(SpriteInstance));
+	}
+
+	// Sprites are usually alpha blended, we restore the previous blend state when we're done
+	bool blendState = GLState::IsBlendEnabled();
+	GLState::SetBlendEnabled(true);
+	GLState::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
+	GLState::UseProgram(m_ShaderHandle);
+	GLState::BindVertexArray(m_VAO);
+
+	size_t baseInstance = m_Stream->FirstElement();
+	for (Batch& batch : m_Batches) {
+		memcpy(data, batch.Instances.data(), batch.Instances.size() * sizeof(SpriteInstance));
+		GLState::BindTexture(0, batch.Texture);
+		glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(batch.Instances.size()), static_cast<GLuint>(baseInstance));
+
+		data += batch.Instances.size();
+		baseInstance += batch.Instances.size();
+		batch.Instances.clear();
+	}
+	m_Stream->EndFrame();
+
+	GLState::SetBlendEnabled(blendState);
+}
@@ -0,0 +1,115 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this file in your GDW games.
+//
+// This file implements the TTK persistently mapped streaming buffer
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#include "TTK/StreamingBuffer.h"
+
+#include <cstring>
+#include "Logging.h"
+
+// The flags we use for both our storage and our mapping, coherent means we don't need to flush ranges manually
+static const GLbitfield STREAM_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+TTK::StreamingBuffer::StreamingBuffer(size_t elemSize, size_t initialCapacity) :
+	m_Handle(0),
+	m_Mapped(nullptr),
+	m_ElemSize(elemSize),
+	m_Capacity(0),
+	m_Count(0),
+	m_Region(0),
+	m_Fences()
+{
+	__Allocate(initialCapacity > 0 ? initialCapacity : 1);
+}
+
+TTK::StreamingBuffer::~StreamingBuffer() {
+	for (GLsync& fence : m_Fences) {
+		if (fence != nullptr)
+			glDeleteSync(fence);
+	}
+	glUnmapNamedBuffer(m_Handle);
+	glDeleteBuffers(1, &m_Handle);
+}
+
+void* TTK::StreamingBuffer::Reserve(size_t count) {
+	// If this is the first write this frame, make sure the GPU is done with the region
+	if (m_Count == 0)
+		__WaitForRegion();
+
+	if (m_Count + count > m_Capacity)
+		__Grow(m_Count + count);
+
+	void* result = m_Mapped + (FirstElement() + m_Count) * m_ElemSize;
+	m_Count += count;
+	return result;
+}
+
+void TTK::StreamingBuffer::EndFrame() {
+	// Fence the region we just used, this will get signaled once all draws that were submitted before it are done
+	if (m_Fences[m_Region] != nullptr)
+		glDeleteSync(m_Fences[m_Region]);
+	m_Fences[m_Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+	m_Region = (m_Region + 1) % FrameCount;
+	m_Count = 0;
+}
+
+void TTK::StreamingBuffer::__Allocate(size_t capacity) {
+	m_Capacity = capacity;
+	glCreateBuffers(1, &m_Handle);
+	glNamedBufferStorage(m_Handle, m_Capacity * m_ElemSize * FrameCount, nullptr, STREAM_FLAGS);
+	m_Mapped = static_cast<uint8_t*>(glMapNamedBufferRange(m_Handle, 0, m_Capacity * m_ElemSize * FrameCount, STREAM_FLAGS));
+	LOG_ASSERT(m_Mapped != nullptr, "Failed to persistently map streaming buffer!");
+}
+
+void TTK::StreamingBuffer::__Grow(size_t required) {
+	size_t capacity = m_Capacity * 2;
+	while (capacity < required)
+		capacity *= 2;
+
+	LOG_INFO("Growing streaming buffer from {} to {} elements per frame", m_Capacity, capacity);
+
+	GLuint   oldHandle = m_Handle;
+	uint8_t* oldData = m_Mapped + FirstByte();
+
+	// Our new storage will have it's regions in different locations, so we carry over what's been written this frame
+	__Allocate(capacity);
+	memcpy(m_Mapped + FirstByte(), oldData, m_Count * m_ElemSize);
+
+	// The fences guarded the old storage, which the GL will keep alive until any pending draws are done with it
+	for (GLsync& fence : m_Fences) {
+		if (fence != nullptr) {
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+	}
+	glUnmapNamedBuffer(oldHandle);
+	glDeleteBuffers(1, &oldHandle);
+}
+
+void TTK::StreamingBuffer::__WaitForRegion() {
+	GLsync& fence = m_Fences[m_Region];
+	if (fence == nullptr)
+		return;
+
+	// We only flush the command queue on the first wait, after that we just keep polling
+	GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+	while (true) {
+		GLenum result = glClientWaitSync(fence, flags, 1000000);
+		if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+			break;
+		if (result == GL_WAIT_FAILED) {
+			LOG_ERROR("Failed to wait on streaming buffer fence!");
+			break;
+		}
+		flags = 0;
+	}
+	glDeleteSync(fence);
+	fence = nullptr;
+}
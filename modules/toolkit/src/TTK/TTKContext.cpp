@@ -12,22 +12,104 @@
 
 #include "TTK/TTKContext.h"
 #include <GLM/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
 #include <string>
 #include "Logging.h"
 #include "TTK/MeshHelper.h"
+#include "TTK/DebugMesh.h"
+#include "TTK/GLState.h"
+#include "TTK/SpriteBatch.h"
 
 TTK::Context* TTK::Context::m_Instance = nullptr;
 
+namespace TTK::Impl {
+	/*
+	 * Stores the primitives recorded by a single worker thread. Each recorder is double buffered, the owning
+	 * thread appends to the write slot without locking, and the render thread flips the slot when it flushes.
+	 * Writing is raised for the duration of each append, so that the render thread can wait for any append that
+	 * may have started before the flip to finish
+	 */
+	struct DebugRecorder {
+		std::vector<Context::SimpleVert> Lines[2];
+		std::vector<Context::SimpleVert> Tris[2];
+		std::vector<Context::PointVert>  Points[2];
+		std::atomic<int>                 WriteSlot{ 0 };
+		std::atomic<bool>                Writing{ false };
+		// Raised when the owning thread exits, so that the render thread can release the recorder
+		std::atomic<bool>                Retired{ false };
+
+		int BeginWrite() {
+			Writing.store(true);
+			return WriteSlot.load();
+		}
+		void EndWrite() {
+			Writing.store(false, std::memory_order_release);
+		}
+	};
+}
+
+namespace {
+	// Each thread caches it's recorder, the generation lets us detect when the context has been re-created.
+	// The recorder is shared with the context, so that it stays valid for whichever of the two goes away last
+	struct RecorderCache {
+		uint32_t                                   Generation = 0;
+		std::shared_ptr<TTK::Impl::DebugRecorder> Recorder;
+
+		~RecorderCache() {
+			if (Recorder != nullptr)
+				Recorder->Retired.store(true, std::memory_order_release);
+		}
+	};
+	thread_local RecorderCache t_RecorderCache;
+	std::atomic<uint32_t>      g_ContextGeneration{ 0 };
+}
+
+// Tests a model space bounding sphere against a frustum, after transforming it by a model matrix
+static bool __TestTransformedSphere(const TTK::Frustum& frustum, const glm::mat4& transform, const glm::vec3& center, float radius) {
+	glm::vec3 worldCenter = glm::vec3(transform * glm::vec4(center, 1.0f));
+	// Non-uniform scales stretch the sphere, so we bound it with the largest axis
+	float scale = glm::sqrt(glm::max(glm::max(
+		glm::dot(glm::vec3(transform[0]), glm::vec3(transform[0])),
+		glm::dot(glm::vec3(transform[1]), glm::vec3(transform[1]))),
+		glm::dot(glm::vec3(transform[2]), glm::vec3(transform[2]))));
+	return frustum.TestSphere(worldCenter, radius * scale);
+}
+
+// Removes any primitives that are entirely outside of a frustum from a list of vertices, keeping the order intact
+template <typename VertType>
+static void __CullPrimitives(const TTK::Frustum& frustum, std::vector<VertType>& verts, size_t vertsPerPrim) {
+	size_t write = 0;
+	for (size_t read = 0; read + vertsPerPrim <= verts.size(); read += vertsPerPrim) {
+		glm::vec3 min = verts[read].Position, max = verts[read].Position;
+		for (size_t ix = 1; ix < vertsPerPrim; ix++) {
+			min = glm::min(min, verts[read + ix].Position);
+			max = glm::max(max, verts[read + ix].Position);
+		}
+		if (frustum.TestAABB(min, max)) {
+			if (write != read)
+				std::copy(verts.begin() + read, verts.begin() + read + vertsPerPrim, verts.begin() + write);
+			write += vertsPerPrim;
+		}
+	}
+	verts.resize(write);
+}
+
 TTK::Context::~Context() {
 	delete m_MeshHelper;
 	delete m_DefaultFont;
-	glDeleteBuffers(1, &m_Tris.VBO);
-	glDeleteBuffers(1, &m_Lines.VBO);
-	glDeleteBuffers(1, &m_Points.VBO);
-	glDeleteVertexArrays(1, &m_Tris.VAO);
-	glDeleteVertexArrays(1, &m_Lines.VAO);
-	glDeleteVertexArrays(1, &m_Points.VAO);
+	delete m_Tris.Stream;
+	delete m_Lines.Stream;
+	delete m_Points.Stream;
+	for (StreamingBuffer* instances : m_MeshInstances)
+		delete instances;
+	GLState::DeleteVertexArrays(1, &m_Tris.VAO);
+	GLState::DeleteVertexArrays(1, &m_Lines.VAO);
+	GLState::DeleteVertexArrays(1, &m_Points.VAO);
 	glDeleteProgram(m_ShaderHandle);
+	glDeleteProgram(m_PointShaderHandle);
 }
 
 glm::mat4 TTK::Context::GetOrthoProjection() const {
@@ -53,43 +135,101 @@ void TTK::Context::SetViewport(int x, int y, int w, int h)
 }
 
 void TTK::Context::RenderText(const char* text, const glm::vec2& position, const glm::vec4& color, float scale) {
-	TTK::FontRenderer::Instance().Render(*m_DefaultFont, text, position, color, scale);
+	TTK::FontRenderer::Instance().Render(*GetDefaultFont(), text, position, color, scale);
 }
 
-void TTK::Context::DrawTeapot(const glm::mat4& mat, const glm::vec4& color) const {
-	m_MeshHelper->RenderTeapot(mat, color);
+TTK::TrueTypeTextureFont* TTK::Context::GetDefaultFont() {
+	if (m_DefaultFont == nullptr) {
+		const char* path = "fonts/SourceCodePro-Regular.ttf";
+		if (!std::filesystem::exists(path)) {
+			LOG_WARN("Could not find the bundled TTK font, falling back to Consolas");
+			path = "C:\\\\Windows\\Fonts\\consola.ttf";
+		}
+		m_DefaultFont = new TrueTypeTextureFont(path, 32, FontAtlasMode::SDF);
+	}
+	return m_DefaultFont;
+}
+
+void TTK::Context::DrawTeapot(const glm::mat4& mat, const glm::vec4& color) {
+	__QueueMesh(Impl::MeshShape::Teapot, mat, color);
+}
+
+void TTK::Context::DrawSphere(const glm::mat4& mat, const glm::vec4& color) {
+	__QueueMesh(Impl::MeshShape::Sphere, mat, color);
+}
+
+void TTK::Context::DrawCube(const glm::mat4& mat, const glm::vec4& color) {
+	__QueueMesh(Impl::MeshShape::Cube, mat, color);
 }
 
-void TTK::Context::DrawSphere(const glm::mat4& mat, const glm::vec4& color) const {
-	m_MeshHelper->RenderSphere(mat, color);
+void TTK::Context::DrawCylinder(const glm::mat4& mat, const glm::vec4& color) {
+	__QueueMesh(Impl::MeshShape::Cylinder, mat, color);
 }
 
-void TTK::Context::DrawCube(const glm::mat4& mat, const glm::vec4& color) const {
-	m_MeshHelper->RenderCube(mat, color);
+void TTK::Context::DrawCapsule(const glm::mat4& mat, const glm::vec4& color) {
+	__QueueMesh(Impl::MeshShape::Capsule, mat, color);
+}
+
+void TTK::Context::SetPrimitiveTessellation(int slices, int stacks) {
+	m_MeshHelper->SetTessellation(slices, stacks);
+}
+
+void TTK::Context::__QueueMesh(Impl::MeshShape shape, const glm::mat4& mat, const glm::vec4& color) {
+	if (m_CullingEnabled) {
+		glm::vec3 center;
+		float radius;
+		m_MeshHelper->GetBoundingSphere(shape, center, radius);
+		if (!__TestTransformedSphere(m_Frustum, mat, center, radius))
+			return;
+	}
+
+	MeshInstance* instance = m_MeshInstances[static_cast<size_t>(shape)]->Reserve<MeshInstance>(1);
+	instance->Transform = mat;
+	instance->Color = PackRGBA8(color);
 }
 
 void TTK::Context::AddLine(const glm::vec3& a, const glm::vec3& b, const glm::vec4& color) {
-	m_LineVerts[m_Lines.Count + 0].Position = a;
-	m_LineVerts[m_Lines.Count + 0].Color = color;
-	m_LineVerts[m_Lines.Count + 1].Position = b;
-	m_LineVerts[m_Lines.Count + 1].Color = color;
-	m_Lines.Count += 2;
-	if (m_Lines.Count == MaxLineVerts) {
-		__Flush(m_Lines);
+	uint32_t packed = PackRGBA8(color);
+	if (Impl::DebugRecorder* recorder = __GetRecorder()) {
+		int slot = recorder->BeginWrite();
+		recorder->Lines[slot].push_back({ a, packed });
+		recorder->Lines[slot].push_back({ b, packed });
+		recorder->EndWrite();
+		return;
 	}
+
+	if (m_CullingEnabled && !m_Frustum.TestAABB(glm::min(a, b), glm::max(a, b)))
+		return;
+
+	// Note that we write directly into mapped GPU memory here
+	SimpleVert* verts = m_Lines.Stream->Reserve<SimpleVert>(2);
+	verts[0].Position = a;
+	verts[0].Color = packed;
+	verts[1].Position = b;
+	verts[1].Color = packed;
 }
 
 void TTK::Context::AddTri(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c, const glm::vec4& color) {
-	m_TriVerts[m_Tris.Count + 0].Position = a;
-	m_TriVerts[m_Tris.Count + 0].Color = color;
-	m_TriVerts[m_Tris.Count + 1].Position = b;
-	m_TriVerts[m_Tris.Count + 1].Color = color;
-	m_TriVerts[m_Tris.Count + 2].Position = c;
-	m_TriVerts[m_Tris.Count + 2].Color = color;
-	m_Tris.Count += 3;
-	if (m_Tris.Count == MaxTriVerts) {
-		__Flush(m_Tris);
+	uint32_t packed = PackRGBA8(color);
+	if (Impl::DebugRecorder* recorder = __GetRecorder()) {
+		int slot = recorder->BeginWrite();
+		recorder->Tris[slot].push_back({ a, packed });
+		recorder->Tris[slot].push_back({ b, packed });
+		recorder->Tris[slot].push_back({ c, packed });
+		recorder->EndWrite();
+		return;
 	}
+
+	if (m_CullingEnabled && !m_Frustum.TestAABB(glm::min(glm::min(a, b), c), glm::max(glm::max(a, b), c)))
+		return;
+
+	SimpleVert* verts = m_Tris.Stream->Reserve<SimpleVert>(3);
+	verts[0].Position = a;
+	verts[0].Color = packed;
+	verts[1].Position = b;
+	verts[1].Color = packed;
+	verts[2].Position = c;
+	verts[2].Color = packed;
 }
 
 void TTK::Context::AddQuad(const glm::vec3& min, const glm::vec3& max, const glm::vec4& color) {
@@ -101,25 +241,148 @@ void TTK::Context::AddQuad(const glm::vec3& min, const glm::vec3& max, const glm
 
 void TTK::Context::AddPoint(const glm::vec3& pos, float size, const glm::vec4& color)
 {
-	m_PointVerts[m_Points.Count].Position = pos;
-	m_PointVerts[m_Points.Count].Color = color;
-	m_PointVerts[m_Points.Count].Size = size;
-	m_Points.Count += 1;
-	if (m_Points.Count == MaxPointVerts) {
-		__Flush(m_Points);
+	if (Impl::DebugRecorder* recorder = __GetRecorder()) {
+		int slot = recorder->BeginWrite();
+		recorder->Points[slot].push_back({ pos, PackRGBA8(color), size });
+		recorder->EndWrite();
+		return;
+	}
+
+	if (m_CullingEnabled && !m_Frustum.TestAABB(pos, pos))
+		return;
+
+	PointVert* vert = m_Points.Stream->Reserve<PointVert>(1);
+	vert->Position = pos;
+	vert->Color = PackRGBA8(color);
+	vert->Size = size;
+}
+
+void TTK::Context::DrawDebugMesh(const std::shared_ptr<DebugMesh>& mesh, const glm::mat4& transform) {
+	if (mesh == nullptr || !mesh->IsBaked()) {
+		LOG_WARN_ONCE("Attempted to draw a debug mesh that has not been baked");
+		return;
+	}
+	if (m_CullingEnabled && !__TestTransformedSphere(m_Frustum, transform, mesh->m_BoundsCenter, mesh->m_BoundsRadius))
+		return;
+	m_DebugMeshDraws.push_back({ mesh, transform });
+}
+
+void TTK::Context::__FlushDebugMeshes() {
+	for (const DebugMeshDraw& draw : m_DebugMeshDraws) {
+		const DebugMesh& mesh = *draw.Mesh;
+		glm::mat4 transform = m_ViewProjection * draw.Transform;
+
+		if (mesh.m_TriCount > 0 || mesh.m_LineCount > 0) {
+			GLState::UseProgram(m_ShaderHandle);
+			glUniformMatrix4fv(0, 1, false, &transform[0][0]);
+			GLState::BindVertexArray(mesh.m_SimpleVAO);
+			if (mesh.m_TriCount > 0)
+				glDrawArrays(GL_TRIANGLES, 0, mesh.m_TriCount);
+			if (mesh.m_LineCount > 0)
+				glDrawArrays(GL_LINES, mesh.m_TriCount, mesh.m_LineCount);
+		}
+		if (mesh.m_PointCount > 0) {
+			GLState::UseProgram(m_PointShaderHandle);
+			glUniformMatrix4fv(0, 1, false, &transform[0][0]);
+			GLState::BindVertexArray(mesh.m_PointVAO);
+			glDrawArrays(GL_POINTS, 0, mesh.m_PointCount);
+		}
+	}
+	m_DebugMeshDraws.clear();
+}
+
+TTK::Impl::DebugRecorder* TTK::Context::__GetRecorder() {
+	RecorderCache& cache = t_RecorderCache;
+	if (cache.Generation != m_Generation) {
+		cache.Generation = m_Generation;
+		cache.Recorder = nullptr;
+		// The render thread writes directly into our streams, so it does not get a recorder
+		if (std::this_thread::get_id() != m_RenderThread) {
+			std::lock_guard<std::mutex> lock(m_RecorderMutex);
+			m_Recorders.push_back(std::make_shared<Impl::DebugRecorder>());
+			cache.Recorder = m_Recorders.back();
+		}
+	}
+	return cache.Recorder.get();
+}
+
+void TTK::Context::__MergeRecorders() {
+	std::lock_guard<std::mutex> lock(m_RecorderMutex);
+	for (size_t ix = 0; ix < m_Recorders.size(); ) {
+		Impl::DebugRecorder* recorder = m_Recorders[ix].get();
+		// If the thread has exited, this is the last data it will ever record
+		bool retired = recorder->Retired.load(std::memory_order_acquire);
+
+		// Flip the slot so new writes go to the other buffers, then wait for any in-flight write to the old slot
+		int slot = recorder->WriteSlot.load(std::memory_order_relaxed);
+		recorder->WriteSlot.store(1 - slot);
+		while (recorder->Writing.load())
+			std::this_thread::yield();
+
+		auto& lines = recorder->Lines[slot];
+		auto& tris = recorder->Tris[slot];
+		auto& points = recorder->Points[slot];
+
+		// We cull these here rather than when they are recorded, since the view may be changing on the render thread
+		if (m_CullingEnabled) {
+			__CullPrimitives(m_Frustum, lines, 2);
+			__CullPrimitives(m_Frustum, tris, 3);
+			__CullPrimitives(m_Frustum, points, 1);
+		}
+
+		if (!lines.empty())
+			memcpy(m_Lines.Stream->Reserve(lines.size()), lines.data(), lines.size() * sizeof(SimpleVert));
+		if (!tris.empty())
+			memcpy(m_Tris.Stream->Reserve(tris.size()), tris.data(), tris.size() * sizeof(SimpleVert));
+		if (!points.empty())
+			memcpy(m_Points.Stream->Reserve(points.size()), points.data(), points.size() * sizeof(PointVert));
+
+		lines.clear();
+		tris.clear();
+		points.clear();
+
+		// Release recorders from threads that have exited, so that thread pool churn doesn't leave us with
+		// an ever growing list to walk every frame
+		if (retired) {
+			m_Recorders[ix] = std::move(m_Recorders.back());
+			m_Recorders.pop_back();
+		} else
+			ix++;
 	}
 }
 
 void TTK::Context::Flush() {
+	__MergeRecorders();
+
+	// Draw all of our queued meshes, one instanced draw per shape
+	for (size_t ix = 0; ix < static_cast<size_t>(Impl::MeshShape::Count); ix++) {
+		StreamingBuffer& instances = *m_MeshInstances[ix];
+		if (instances.Count() > 0) {
+			m_MeshHelper->RenderInstanced(static_cast<Impl::MeshShape>(ix), m_ViewProjection, instances);
+			instances.EndFrame();
+		}
+	}
+	__FlushDebugMeshes();
 	__Flush(m_Tris);
 	__Flush(m_Lines);
 	__Flush(m_Points);
+
+	// Sprites and text are drawn last, with text on top of everything
+	if (SpriteBatch::IsCreated())
+		SpriteBatch::Instance().Flush();
+	if (FontRenderer::IsCreated())
+		FontRenderer::Instance().Flush();
 }
 
 TTK::Context::Context() {
+	m_RenderThread = std::this_thread::get_id();
+	m_Generation = ++g_ContextGeneration;
 	m_Projection = glm::ortho(0.0f, 800.0f, 0.0f, 600.0f);
 	m_ViewMatrix = glm::mat4(1.0f);
-	m_DefaultFont = new TrueTypeTextureFont("C:\\\\Windows\\Fonts\\consola.ttf", 32);
+	m_CullingEnabled = false;
+	__UpdateViewProjection();
+	// The default font is created the first time that text is drawn, so apps that never draw text don't pay for it
+	m_DefaultFont = nullptr;
 	
 	const char* vsSource = R"LIT(#version 430
             layout (location = 0) uniform mat4 xTransform;
@@ -159,61 +422,47 @@ TTK::Context::Context() {
 	m_PointShaderHandle = __CompileShader(vsSourcePoint, fsSource);
 
 
-	m_Tris = __InitBuff(GL_TRIANGLES, m_ShaderHandle, m_TriVerts, sizeof(SimpleVert), MaxTriVerts);
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(0, 3, GL_FLOAT, false, sizeof(SimpleVert), (void*)offsetof(SimpleVert, Position));
-	glVertexAttribPointer(1, 4, GL_FLOAT, false, sizeof(SimpleVert), (void*)offsetof(SimpleVert, Color));
-
-	m_Lines = __InitBuff(GL_LINES, m_ShaderHandle, m_LineVerts, sizeof(SimpleVert), MaxLineVerts);
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(0, 3, GL_FLOAT, false, sizeof(SimpleVert), (void*)offsetof(SimpleVert, Position));
-	glVertexAttribPointer(1, 4, GL_FLOAT, false, sizeof(SimpleVert), (void*)offsetof(SimpleVert, Color));
-
-	m_Points = __InitBuff(GL_POINTS, m_PointShaderHandle, m_PointVerts, sizeof(PointVert), MaxLineVerts);
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glEnableVertexAttribArray(2);
-	glVertexAttribPointer(0, 3, GL_FLOAT, false, sizeof(PointVert), (void*)offsetof(PointVert, Position));
-	glVertexAttribPointer(1, 4, GL_FLOAT, false, sizeof(PointVert), (void*)offsetof(PointVert, Color));
-	glVertexAttribPointer(2, 1, GL_FLOAT, false, sizeof(PointVert), (void*)offsetof(PointVert, Size));
-
-	glBindVertexArray(0);
+	// We use separate attribute formats so that we can swap out the buffer when our streams grow
+	m_Tris = __InitBuff(GL_TRIANGLES, m_ShaderHandle, SimpleVert::GetLayout(), InitialTriVerts);
+	m_Lines = __InitBuff(GL_LINES, m_ShaderHandle, SimpleVert::GetLayout(), InitialLineVerts);
+	m_Points = __InitBuff(GL_POINTS, m_PointShaderHandle, PointVert::GetLayout(), InitialPointVerts);
 
 	// Make sure that the mesh helper has a context
 	m_MeshHelper = new Impl::MeshHelper();
+	for (StreamingBuffer*& instances : m_MeshInstances)
+		instances = new StreamingBuffer(sizeof(MeshInstance), InitialMeshInstances);
 
 	// Allow our shaders to specify a point size
 	glEnable(GL_PROGRAM_POINT_SIZE);
 }
 
-TTK::Context::GLBuff TTK::Context::__InitBuff(GLenum mode, GLuint shader, void* dataSource, size_t elemSize, size_t maxElems)
+TTK::Context::GLBuff TTK::Context::__InitBuff(GLenum mode, GLuint shader, const VertexLayout& layout, size_t initialElems)
 {
 	GLBuff result;
 	result.Mode = mode;
-	result.Count = 0;
-	result.Data = dataSource;
-	result.ElemSize = elemSize;
 	result.Shader = shader;
+	result.Stream = new StreamingBuffer(layout.GetStride(), initialElems);
+	result.BoundVBO = result.Stream->GetHandle();
 
 	glCreateVertexArrays(1, &result.VAO);
-	glBindVertexArray(result.VAO);
-	glCreateBuffers(1, &result.VBO);
-	glBindBuffer(GL_ARRAY_BUFFER, result.VBO);
-	glNamedBufferData(result.VBO, elemSize * maxElems, nullptr, GL_STREAM_DRAW);
+	layout.Apply(result.VAO, 0);
+	glVertexArrayVertexBuffer(result.VAO, 0, result.BoundVBO, 0, layout.GetStride());
 
 	return result;
 }
 
 void TTK::Context::__Flush(GLBuff& buff) {
-	if (buff.Count > 0) {
-		glUseProgram(buff.Shader);
+	if (buff.Stream->Count() > 0) {
+		// The stream may have grown since our last draw, in which case we need to point our VAO at the new storage
+		if (buff.BoundVBO != buff.Stream->GetHandle()) {
+			buff.BoundVBO = buff.Stream->GetHandle();
+			glVertexArrayVertexBuffer(buff.VAO, 0, buff.BoundVBO, 0, static_cast<GLsizei>(buff.Stream->ElementSize()));
+		}
+		GLState::UseProgram(buff.Shader);
 		glUniformMatrix4fv(0, 1, false, &m_ViewProjection[0][0]);
-		glNamedBufferSubData(buff.VBO, 0, buff.Count * buff.ElemSize, buff.Data);
-		glBindVertexArray(buff.VAO);
-		glDrawArrays(buff.Mode, 0, static_cast<GLsizei>(buff.Count));
-		buff.Count = 0;
+		GLState::BindVertexArray(buff.VAO);
+		glDrawArrays(buff.Mode, static_cast<GLint>(buff.Stream->FirstElement()), static_cast<GLsizei>(buff.Stream->Count()));
+		buff.Stream->EndFrame();
 	}
 }
 
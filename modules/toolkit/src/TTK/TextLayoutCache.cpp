@@ -0,0 +1,54 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this file in your GDW games.
+//
+// This file implements the TTK text layout cache
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#include "TTK/TextLayoutCache.h"
+
+#include <cstring>
+
+TTK::TextLayoutCache::TextLayoutCache(size_t capacity) :
+	m_Entries(),
+	m_Lookup(),
+	m_Capacity(capacity > 0 ? capacity : 1)
+{ }
+
+void TTK::TextLayoutCache::Clear() {
+	m_Entries.clear();
+	m_Lookup.clear();
+}
+
+void TTK::TextLayoutCache::SetCapacity(size_t capacity) {
+	m_Capacity = capacity > 0 ? capacity : 1;
+	while (m_Entries.size() > m_Capacity)
+		__EvictOldest();
+}
+
+void TTK::TextLayoutCache::__EvictOldest() {
+	m_Lookup.erase(m_Entries.back().Key);
+	m_Entries.pop_back();
+}
+
+uint64_t TTK::TextLayoutCache::__Hash(const char* text, size_t& length, float scale) {
+	// FNV-1a over the text, then the bits of the scale, we get the length for free along the way
+	uint64_t hash = 14695981039346656037ull;
+	const char* c = text;
+	for (; *c != '\0'; c++) {
+		hash ^= static_cast<uint8_t>(*c);
+		hash *= 1099511628211ull;
+	}
+	length = static_cast<size_t>(c - text);
+
+	uint32_t scaleBits;
+	memcpy(&scaleBits, &scale, sizeof(float));
+	for (int ix = 0; ix < 4; ix++) {
+		hash ^= (scaleBits >> (ix * 8)) & 0xFF;
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
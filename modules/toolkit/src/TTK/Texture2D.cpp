@@ -3,15 +3,25 @@
 
 #include <iostream>
 #include "Logging.h"
+#include "TTK/GLState.h"
+#include "TTK/AsyncTextureLoader.h"
+#include "TTK/ResourceRegistry.h"
+#include "TTK/StreamingBuffer.h"
+#include <cstring>
 
 namespace TTK {
 	Texture2D::Texture2D() :
-		m_EdgeBehaviour(GL_CLAMP_TO_EDGE),
-		m_Filtering(GL_LINEAR),
-		m_Target(GL_TEXTURE_2D),
 		m_TexWidth(0),
 		m_TexHeight(0),
-		m_TexID(0)
+		m_TexID(0),
+		m_Filtering(GL_LINEAR),
+		m_EdgeBehaviour(GL_CLAMP_TO_EDGE),
+		m_InternalFormat(GL_RGBA8),
+		m_TextureFormat(GL_RGBA),
+		m_DataType(GL_UNSIGNED_BYTE),
+		m_Target(GL_TEXTURE_2D),
+		m_LoadHandle(0),
+		m_IsPlaceholder(false)
 	{ }
 
 	Texture2D::Texture2D(int _id, int _width, int _height, GLenum target) {
@@ -19,21 +29,43 @@ namespace TTK {
 		m_TexWidth = _width;
 		m_TexHeight = _height;
 		m_Target = target;
+		m_Filtering = GL_LINEAR;
+		m_EdgeBehaviour = GL_CLAMP_TO_EDGE;
+		m_InternalFormat = GL_RGBA8;
+		m_TextureFormat = GL_RGBA;
+		m_DataType = GL_UNSIGNED_BYTE;
+		m_LoadHandle = 0;
+		m_IsPlaceholder = false;
 	}
 
 	Texture2D::~Texture2D() {
-		glDeleteTextures(1, &m_TexID);
+		__ReleaseTexture();
+	}
+
+	void Texture2D::__ReleaseTexture() {
+		// A load that is still in flight would otherwise call back into this texture once it's gone
+		if (m_LoadHandle != 0 && AsyncTextureLoader::IsCreated())
+			AsyncTextureLoader::Instance().Cancel(m_LoadHandle);
+		m_LoadHandle = 0;
+
+		// The placeholder is shared between every loading texture, so we only forget about it. We remember that we
+		// hold it rather than asking the loader, since the loader (and it's placeholder) may already be gone
+		if (!m_IsPlaceholder)
+			GLState::DeleteTextures(1, &m_TexID);
+		m_TexID = 0;
+		m_IsPlaceholder = false;
+
+		// Our staging ring is sized for the old texture
+		m_Stream.reset();
 	}
 
 	void Texture2D::Bind(GLenum textureUnit /* = GL_TEXTURE0 */) {
-		glActiveTexture(textureUnit);
-		glBindTexture(m_Target, m_TexID);
+		GLState::BindTexture(textureUnit - GL_TEXTURE0, m_TexID);
 	}
 
 	void Texture2D::Unbind(GLenum textureUnit /* = GL_TEXTURE0 */)
 	{
-		glActiveTexture(textureUnit);
-		glBindTexture(m_Target, 0);
+		GLState::BindTexture(textureUnit - GL_TEXTURE0, 0);
 	}
 
 	void Texture2D::LoadTextureFromFile(const std::string& filePath)
@@ -80,7 +112,61 @@ namespace TTK {
 		stbi_image_free(imageData);
 	}
 
+	Texture2D::Ptr Texture2D::LoadShared(const std::string& filePath)
+	{
+		return ResourceRegistry<Texture2D>::Instance().LoadCustom(filePath, "", [](const std::string& file) {
+			Ptr result = std::make_shared<Texture2D>();
+			result->LoadTextureFromFile(file);
+			return result;
+		});
+	}
+
+	std::shared_future<bool> Texture2D::LoadTextureFromFileAsync(const std::string& filePath, const std::function<void(Texture2D&, bool)>& onLoaded)
+	{
+		__ReleaseTexture();
+
+		AsyncTextureLoader& loader = AsyncTextureLoader::Instance();
+		m_TexID = loader.GetPlaceholder();
+		m_IsPlaceholder = true;
+		m_TexWidth = 1;
+		m_TexHeight = 1;
+		m_Filtering = GL_LINEAR;
+		m_EdgeBehaviour = GL_CLAMP_TO_EDGE;
+		m_InternalFormat = GL_RGBA8;
+		m_TextureFormat = GL_RGBA;
+		m_DataType = GL_UNSIGNED_BYTE;
+		m_Target = GL_TEXTURE_2D;
+
+		AsyncTextureLoader::Ticket ticket = loader.Load(filePath, [this, onLoaded](const AsyncTextureLoader::LoadedTexture& result) {
+			m_LoadHandle = 0;
+			// On failure we keep showing the placeholder, the loader has already logged the error
+			if (result.Success) {
+				m_TexID = result.Texture;
+				m_IsPlaceholder = false;
+				m_TexWidth = result.Width;
+				m_TexHeight = result.Height;
+			}
+			if (onLoaded)
+				onLoaded(*this, result.Success);
+		}, false, m_Filtering, m_EdgeBehaviour);
+		m_LoadHandle = ticket.Id;
+
+		return ticket.Resident;
+	}
+
 	void Texture2D::CreateTexture(int w, int h, GLenum target, GLenum filtering, GLenum edgeBehaviour, GLenum internalFormat, GLenum textureFormat, GLenum dataType, void* data) {
+		// Immutable storage needs a sized format, so we pick the 8 bit version of any unsized formats
+		switch (internalFormat) {
+		case GL_RED:             internalFormat = GL_R8; break;
+		case GL_RG:              internalFormat = GL_RG8; break;
+		case GL_RGB:             internalFormat = GL_RGB8; break;
+		case GL_RGBA:            internalFormat = GL_RGBA8; break;
+		case GL_DEPTH_COMPONENT: internalFormat = GL_DEPTH_COMPONENT24; break;
+		default: break;
+		}
+
+		__ReleaseTexture();
+
 		m_TexWidth = w;
 		m_TexHeight = h;
 		m_Filtering = filtering;
@@ -90,45 +176,73 @@ namespace TTK {
 		m_DataType = dataType;
 		m_Target = target;
 
-		GLenum error = 0;
-
-		// Not necessary to enable GL_TEXTURE_* in modern context.
-	//	glEnable(m_pTarget);
-	//	error = glGetError();
-
-		if (m_TexID)
-			glDeleteTextures(1, &m_TexID);
+		// We use DSA so that we never disturb whatever is bound, and immutable storage so the driver never has
+		// to check that our mip chain is complete, or re-validate the texture when we upload to it
+		glCreateTextures(m_Target, 1, &m_TexID);
+		glTextureParameteri(m_TexID, GL_TEXTURE_MIN_FILTER, filtering);
+		glTextureParameteri(m_TexID, GL_TEXTURE_MAG_FILTER, filtering);
+		glTextureParameteri(m_TexID, GL_TEXTURE_WRAP_S, edgeBehaviour);
+		glTextureParameteri(m_TexID, GL_TEXTURE_WRAP_T, edgeBehaviour);
 
-		glGenTextures(1, &m_TexID);
-		glBindTexture(target, m_TexID);
-		error = glGetError();
+		glTextureStorage2D(m_TexID, 1, internalFormat, w, h);
+		if (data != nullptr)
+			glTextureSubImage2D(m_TexID, 0, 0, 0, w, h, textureFormat, dataType, data);
 
-		glTexParameteri(m_Target, GL_TEXTURE_MIN_FILTER, filtering);
-		glTexParameteri(m_Target, GL_TEXTURE_MAG_FILTER, filtering);
-		glTexParameteri(m_Target, GL_TEXTURE_WRAP_S, edgeBehaviour);
-		glTexParameteri(m_Target, GL_TEXTURE_WRAP_T, edgeBehaviour);
-		error = glGetError();
+		if (glGetError() != GL_NO_ERROR)
+			LOG_ERROR("An error has occured while creating a texture. Continuing...");
+	}
 
-		glTexImage2D(m_Target, 0, internalFormat, w, h, 0, textureFormat, dataType, data);
-		error = glGetError();
+	void Texture2D::UpdateTexture(void* newDataPtr /*= nullptr*/)
+	{
+		if (newDataPtr == nullptr || m_IsPlaceholder)
+			return;
 
-		if (error != 0)
-			LOG_ERROR("An error has occured while creating a texture. Continuing...");
+		glTextureSubImage2D(m_TexID, 0, 0, 0, m_TexWidth, m_TexHeight, m_TextureFormat, m_DataType, newDataPtr);
+	}
 
-		glBindTexture(m_Target, 0);
+	// Gets the size of a single pixel with the given format and data type, in bytes
+	static size_t __GetPixelSize(GLenum format, GLenum dataType) {
+		size_t components;
+		switch (format) {
+		case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: components = 1; break;
+		case GL_RG: case GL_RG_INTEGER: components = 2; break;
+		case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: components = 3; break;
+		default: components = 4; break;
+		}
 
+		switch (dataType) {
+		case GL_UNSIGNED_BYTE: case GL_BYTE: return components;
+		case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: return components * 2;
+		// Packed types such as GL_UNSIGNED_INT_8_8_8_8 hold an entire pixel in 4 bytes
+		case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV: case GL_UNSIGNED_INT_2_10_10_10_REV: return 4;
+		default: return components * 4;
+		}
 	}
 
-	void Texture2D::UpdateTexture(void* newDataPtr /*= nullptr*/)
+	void Texture2D::StreamSubImage(int x, int y, int width, int height, const void* data)
 	{
-		if (newDataPtr == nullptr)
+		LOG_ASSERT(x >= 0 && y >= 0 && x + width <= (int)m_TexWidth && y + height <= (int)m_TexHeight, "Streamed region is outside of the texture!");
+		// Textures that are still loading point at the shared placeholder, which we must not write to
+		if (data == nullptr || width <= 0 || height <= 0 || m_IsPlaceholder)
 			return;
 
-		glBindTexture(m_Target, m_TexID);
+		const size_t bytes = __GetPixelSize(m_TextureFormat, m_DataType) * width * height;
+
+		// Each region of the ring holds one full texture's worth of data, so a whole-texture update every frame
+		// cycles through the regions, and smaller updates share a region until it fills up
+		if (m_Stream == nullptr)
+			m_Stream = std::make_unique<StreamingBuffer>(1, __GetPixelSize(m_TextureFormat, m_DataType) * m_TexWidth * m_TexHeight);
+		else if (m_Stream->Count() > 0 && m_Stream->Count() + bytes > m_Stream->Capacity())
+			m_Stream->EndFrame(); // Fences everything that read from the region so far
 
-		if (newDataPtr != nullptr)
-			glTexSubImage2D(m_Target, 0, 0, 0, m_TexWidth, m_TexHeight, m_TextureFormat, m_DataType, newDataPtr);
+		const size_t offset = m_Stream->FirstByte() + m_Stream->Count();
+		memcpy(m_Stream->Reserve(bytes), data, bytes);
 
-		glBindTexture(m_Target, 0);
+		// With an unpack buffer bound, the data pointer is an offset into the buffer. Our rows are tightly packed
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_Stream->GetHandle());
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glTextureSubImage2D(m_TexID, 0, x, y, width, height, m_TextureFormat, m_DataType, (const void*)offset);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 	}
 }
@@ -0,0 +1,301 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this file in your GDW games.
+//
+// This file implements the TTK texture atlas packer
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#include "TTK/TextureAtlas.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include "stb_image.h"
+#include "stb_image_write.h"
+#include "stb_rect_pack.h"
+#include "Logging.h"
+#include "TTK/GLState.h"
+
+// The first line of every atlas manifest, bump the version if the format changes
+static const char* ManifestHeader = "TTKAtlas";
+static const int   ManifestVersion = 1;
+
+// Copies an image into a page, extending it's edge pixels out into the padding around it
+static void __BlitPadded(uint8_t* page, int pageSize, const uint8_t* pixels, int width, int height, int x, int y, int padding) {
+	for (int row = -padding; row < height + padding; row++) {
+		const uint8_t* source = pixels + static_cast<size_t>(glm::clamp(row, 0, height - 1)) * width * 4;
+		uint8_t* dest = page + (static_cast<size_t>(y + padding + row) * pageSize + x) * 4;
+		for (int col = 0; col < padding; col++)
+			memcpy(dest + col * 4, source, 4);
+		memcpy(dest + padding * 4, source, static_cast<size_t>(width) * 4);
+		for (int col = 0; col < padding; col++)
+			memcpy(dest + (padding + width + col) * 4, source + (width - 1) * 4, 4);
+	}
+}
+
+TTK::TextureAtlas::TextureAtlas(int pageSize, int padding) :
+	m_PageSize(pageSize),
+	m_Padding(padding),
+	m_PageCount(0),
+	m_BuildCount(0),
+	m_Storage(AtlasStorage::Pages),
+	m_ArrayTexture(0)
+{ }
+
+TTK::TextureAtlas::~TextureAtlas() {
+	__ReleaseTextures();
+}
+
+TTK::TextureAtlas::Handle TTK::TextureAtlas::Add(const std::string& name, const std::string& fileName) {
+	int width, height, numChannels;
+	uint8_t* pixels = stbi_load(fileName.c_str(), &width, &height, &numChannels, 4);
+	if (pixels == nullptr) {
+		LOG_ERROR("Failed to load atlas image \"{}\": {}", fileName, stbi_failure_reason());
+		return InvalidHandle;
+	}
+	Handle result = Add(name, pixels, width, height);
+	stbi_image_free(pixels);
+	return result;
+}
+
+TTK::TextureAtlas::Handle TTK::TextureAtlas::Add(const std::string& name, const uint8_t* rgba, int width, int height) {
+	Handle handle = __AddRegion(name);
+	Image& image = m_Images[handle];
+	image.Width = width;
+	image.Height = height;
+	image.Pixels.assign(rgba, rgba + static_cast<size_t>(width) * height * 4);
+	m_Regions[handle].Size = glm::ivec2(width, height);
+	return handle;
+}
+
+TTK::TextureAtlas::Handle TTK::TextureAtlas::Find(const std::string& name) const {
+	auto it = m_Lookup.find(name);
+	return it != m_Lookup.end() ? it->second : InvalidHandle;
+}
+
+TTK::TextureAtlas::Handle TTK::TextureAtlas::__AddRegion(const std::string& name) {
+	// Adding an image with the same name replaces the old one, so that handles stay stable
+	Handle handle = Find(name);
+	if (handle == InvalidHandle) {
+		handle = static_cast<Handle>(m_Regions.size());
+		m_Regions.push_back({ glm::vec4(0.0f), 0, glm::ivec2(0) });
+		m_Names.push_back(name);
+		m_Images.push_back(Image());
+		m_Lookup[name] = handle;
+	}
+	return handle;
+}
+
+bool TTK::TextureAtlas::Build(AtlasStorage storage) {
+	bool success = true;
+
+	// Repacking moves every region, so we can't go ahead if any of them are missing their source images
+	for (Handle handle = 0; handle < m_Images.size(); handle++) {
+		if (m_Images[handle].Pixels.empty()) {
+			LOG_ERROR("Atlas region \"{}\" has no image data, the atlas can not be rebuilt", m_Names[handle]);
+			return false;
+		}
+	}
+
+	std::vector<stbrp_rect> pending;
+	for (Handle handle = 0; handle < m_Images.size(); handle++) {
+		const Image& image = m_Images[handle];
+		stbrp_rect rect = stbrp_rect();
+		rect.id = static_cast<int>(handle);
+		rect.w = image.Width + m_Padding * 2;
+		rect.h = image.Height + m_Padding * 2;
+		if (rect.w > m_PageSize || rect.h > m_PageSize) {
+			LOG_ERROR("Atlas image \"{}\" ({}x{}) is larger than a page, skipping", m_Names[handle], image.Width, image.Height);
+			success = false;
+			continue;
+		}
+		pending.push_back(rect);
+	}
+
+	// Pack as much as we can into each page, then start a new page with whatever didn't fit
+	m_Pages.clear();
+	std::vector<stbrp_node> nodes(m_PageSize);
+	while (!pending.empty()) {
+		stbrp_context context;
+		stbrp_init_target(&context, m_PageSize, m_PageSize, nodes.data(), static_cast<int>(nodes.size()));
+		stbrp_pack_rects(&context, pending.data(), static_cast<int>(pending.size()));
+
+		uint32_t pageIndex = static_cast<uint32_t>(m_Pages.size());
+		m_Pages.emplace_back(static_cast<size_t>(m_PageSize) * m_PageSize * 4, static_cast<uint8_t>(0));
+		std::vector<uint8_t>& page = m_Pages.back();
+
+		std::vector<stbrp_rect> leftover;
+		for (const stbrp_rect& rect : pending) {
+			if (!rect.was_packed) {
+				leftover.push_back(rect);
+				continue;
+			}
+			const Image& image = m_Images[rect.id];
+			__BlitPadded(page.data(), m_PageSize, image.Pixels.data(), image.Width, image.Height, rect.x, rect.y, m_Padding);
+
+			glm::vec2 min = glm::vec2(rect.x + m_Padding, rect.y + m_Padding);
+			AtlasRegion& region = m_Regions[rect.id];
+			region.Layer = pageIndex;
+			region.UVRect = glm::vec4(min, min + glm::vec2(image.Width, image.Height)) / static_cast<float>(m_PageSize);
+		}
+		pending = std::move(leftover);
+	}
+	m_PageCount = static_cast<uint32_t>(m_Pages.size());
+	m_BuildCount++;
+
+	__Upload(storage);
+	return success;
+}
+
+bool TTK::TextureAtlas::Save(const std::string& basePath) const {
+	if (m_Pages.empty()) {
+		LOG_ERROR("Cannot save an atlas that has not been built");
+		return false;
+	}
+
+	std::ofstream manifest(basePath + ".atlas");
+	if (!manifest.is_open()) {
+		LOG_ERROR("Failed to open atlas manifest \"{}.atlas\" for writing", basePath);
+		return false;
+	}
+
+	// Pages are stored relative to the manifest, so that the atlas can be moved around as a whole
+	std::string baseName = std::filesystem::path(basePath).filename().string();
+	manifest << ManifestHeader << " " << ManifestVersion << "\n";
+	manifest << m_PageSize << " " << m_PageCount << " " << m_Regions.size() << "\n";
+	for (uint32_t page = 0; page < m_PageCount; page++) {
+		std::string pageName = baseName + "_" + std::to_string(page) + ".png";
+		if (!stbi_write_png((basePath + "_" + std::to_string(page) + ".png").c_str(), m_PageSize, m_PageSize, 4, m_Pages[page].data(), m_PageSize * 4)) {
+			LOG_ERROR("Failed to write atlas page \"{}\"", pageName);
+			return false;
+		}
+		manifest << std::quoted(pageName) << "\n";
+	}
+	for (size_t ix = 0; ix < m_Regions.size(); ix++) {
+		const AtlasRegion& region = m_Regions[ix];
+		glm::ivec2 pos = glm::ivec2(glm::round(glm::vec2(region.UVRect) * static_cast<float>(m_PageSize)));
+		manifest << std::quoted(m_Names[ix]) << " " << region.Layer << " " << pos.x << " " << pos.y << " " << region.Size.x << " " << region.Size.y << "\n";
+	}
+	return true;
+}
+
+TTK::TextureAtlas::Ptr TTK::TextureAtlas::Load(const std::string& manifestPath, AtlasStorage storage) {
+	std::ifstream manifest(manifestPath);
+	if (!manifest.is_open()) {
+		LOG_ERROR("Failed to open atlas manifest \"{}\"", manifestPath);
+		return nullptr;
+	}
+
+	std::string header;
+	int version = 0, pageSize = 0;
+	uint32_t pageCount = 0;
+	size_t regionCount = 0;
+	manifest >> header >> version >> pageSize >> pageCount >> regionCount;
+	if (!manifest || header != ManifestHeader || version != ManifestVersion || pageSize <= 0) {
+		LOG_ERROR("\"{}\" is not a valid atlas manifest", manifestPath);
+		return nullptr;
+	}
+
+	Ptr result = std::make_shared<TextureAtlas>(pageSize);
+	std::filesystem::path directory = std::filesystem::path(manifestPath).parent_path();
+	for (uint32_t page = 0; page < pageCount; page++) {
+		std::string pageName;
+		manifest >> std::quoted(pageName);
+		std::string pagePath = (directory / pageName).string();
+
+		int width, height, numChannels;
+		uint8_t* pixels = stbi_load(pagePath.c_str(), &width, &height, &numChannels, 4);
+		if (pixels == nullptr || width != pageSize || height != pageSize) {
+			LOG_ERROR("Failed to load atlas page \"{}\"", pagePath);
+			stbi_image_free(pixels);
+			return nullptr;
+		}
+		result->m_Pages.emplace_back(pixels, pixels + static_cast<size_t>(pageSize) * pageSize * 4);
+		stbi_image_free(pixels);
+	}
+
+	for (size_t ix = 0; ix < regionCount; ix++) {
+		std::string name;
+		AtlasRegion region;
+		glm::ivec2 pos;
+		manifest >> std::quoted(name) >> region.Layer >> pos.x >> pos.y >> region.Size.x >> region.Size.y;
+		if (!manifest || region.Layer >= pageCount) {
+			LOG_ERROR("Atlas manifest \"{}\" is truncated or corrupt", manifestPath);
+			return nullptr;
+		}
+		if (pos.x < 0 || pos.y < 0 || region.Size.x <= 0 || region.Size.y <= 0 ||
+			pos.x + region.Size.x > pageSize || pos.y + region.Size.y > pageSize) {
+			LOG_ERROR("Atlas region \"{}\" in \"{}\" is outside of it's page", name, manifestPath);
+			return nullptr;
+		}
+		region.UVRect = glm::vec4(glm::vec2(pos), glm::vec2(pos + region.Size)) / static_cast<float>(pageSize);
+		Handle handle = result->__AddRegion(name);
+		result->m_Regions[handle] = region;
+
+		// Cut the region's image back out of it's page, so that more images can be added and the atlas rebuilt
+		Image& image = result->m_Images[handle];
+		image.Width = region.Size.x;
+		image.Height = region.Size.y;
+		image.Pixels.resize(static_cast<size_t>(image.Width) * image.Height * 4);
+		const std::vector<uint8_t>& page = result->m_Pages[region.Layer];
+		for (int row = 0; row < image.Height; row++) {
+			memcpy(image.Pixels.data() + static_cast<size_t>(row) * image.Width * 4,
+				page.data() + (static_cast<size_t>(pos.y + row) * pageSize + pos.x) * 4, static_cast<size_t>(image.Width) * 4);
+		}
+	}
+
+	result->m_PageCount = pageCount;
+	result->__Upload(storage);
+	return result;
+}
+
+void TTK::TextureAtlas::__Upload(AtlasStorage storage) {
+	__ReleaseTextures();
+	m_Storage = storage;
+	if (m_Pages.empty())
+		return;
+
+	// Each mip halves the padding around every image, so we stop once it's down to a single pixel, any further and
+	// neighbouring images would bleed into each other
+	GLsizei levels = 1;
+	while ((m_Padding >> levels) > 0 && (m_PageSize >> levels) > 0)
+		levels++;
+
+	if (storage == AtlasStorage::Pages) {
+		m_PageTextures.resize(m_Pages.size());
+		glCreateTextures(GL_TEXTURE_2D, static_cast<GLsizei>(m_PageTextures.size()), m_PageTextures.data());
+		for (size_t page = 0; page < m_Pages.size(); page++) {
+			GLuint texture = m_PageTextures[page];
+			glTextureStorage2D(texture, levels, GL_RGBA8, m_PageSize, m_PageSize);
+			glTextureSubImage2D(texture, 0, 0, 0, m_PageSize, m_PageSize, GL_RGBA, GL_UNSIGNED_BYTE, m_Pages[page].data());
+			glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+			glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+			glGenerateTextureMipmap(texture);
+		}
+	} else {
+		glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_ArrayTexture);
+		glTextureStorage3D(m_ArrayTexture, levels, GL_RGBA8, m_PageSize, m_PageSize, static_cast<GLsizei>(m_Pages.size()));
+		for (size_t page = 0; page < m_Pages.size(); page++)
+			glTextureSubImage3D(m_ArrayTexture, 0, 0, 0, static_cast<GLint>(page), m_PageSize, m_PageSize, 1, GL_RGBA, GL_UNSIGNED_BYTE, m_Pages[page].data());
+		glTextureParameteri(m_ArrayTexture, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTextureParameteri(m_ArrayTexture, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTextureParameteri(m_ArrayTexture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTextureParameteri(m_ArrayTexture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glGenerateTextureMipmap(m_ArrayTexture);
+	}
+}
+
+void TTK::TextureAtlas::__ReleaseTextures() {
+	if (!m_PageTextures.empty())
+		GLState::DeleteTextures(static_cast<GLsizei>(m_PageTextures.size()), m_PageTextures.data());
+	m_PageTextures.clear();
+	if (m_ArrayTexture != 0)
+		GLState::DeleteTextures(1, &m_ArrayTexture);
+	m_ArrayTexture = 0;
+}
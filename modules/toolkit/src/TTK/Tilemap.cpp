@@ -0,0 +1,227 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// This file is a part of the Tutorial Tool Kit (TTK) library.
+// You may not use this file in your GDW games.
+//
+// This file implements the TTK chunked tilemap
+//
+// Shawn Matthews 2019
+//
+//////////////////////////////////////////////////////////////////////////
+#include "TTK/Tilemap.h"
+
+#include "Logging.h"
+#include "TTK/GLState.h"
+#include "TTK/VertexLayout.h"
+
+TTK::Tilemap::Tilemap(uint32_t width, uint32_t height, const glm::vec2& tileSize, const TextureAtlas::Ptr& atlas) :
+	m_Width(width),
+	m_Height(height),
+	m_ChunksX((width + ChunkSize - 1) / ChunkSize),
+	m_ChunksY((height + ChunkSize - 1) / ChunkSize),
+	m_TileSize(tileSize),
+	m_Origin(0.0f),
+	m_Atlas(atlas),
+	m_AtlasBuild(atlas != nullptr ? atlas->GetBuildCount() : 0)
+{
+	LOG_ASSERT(atlas != nullptr && atlas->GetStorage() == AtlasStorage::Array, "Tilemaps require an atlas that is stored as an array texture");
+
+	// Chunks don't allocate any GPU memory until they have tiles in them
+	m_Chunks.resize(static_cast<size_t>(m_ChunksX) * m_ChunksY);
+	for (Chunk& chunk : m_Chunks) {
+		chunk.Tiles.assign(ChunkSize * ChunkSize, TextureAtlas::InvalidHandle);
+		chunk.VBO = 0;
+		chunk.QuadCount = 0;
+		chunk.QuadCapacity = 0;
+		chunk.Dirty = false;
+	}
+
+	// Every chunk uses the same quad pattern, so a single index buffer covers them all
+	std::vector<GLuint> indices(ChunkSize * ChunkSize * 6);
+	for (GLuint quad = 0; quad < ChunkSize * ChunkSize; quad++) {
+		GLuint base = quad * 4;
+		indices[quad * 6 + 0] = base + 0;
+		indices[quad * 6 + 1] = base + 1;
+		indices[quad * 6 + 2] = base + 2;
+		indices[quad * 6 + 3] = base + 0;
+		indices[quad * 6 + 4] = base + 2;
+		indices[quad * 6 + 5] = base + 3;
+	}
+	glCreateBuffers(1, &m_EBO);
+	glNamedBufferStorage(m_EBO, indices.size() * sizeof(GLuint), indices.data(), 0);
+
+	// We set up our VAO with DSA, so that we don't disturb the currently bound VAO
+	glCreateVertexArrays(1, &m_VAO);
+	VertexLayout(sizeof(TileVert))
+		.Float(0, 2, offsetof(TileVert, Position))
+		.Float(1, 2, offsetof(TileVert, UV))
+		.Add(2, 1, GL_UNSIGNED_SHORT, false, offsetof(TileVert, Layer))
+		.Apply(m_VAO, 0);
+	glVertexArrayElementBuffer(m_VAO, m_EBO);
+}
+
+TTK::Tilemap::~Tilemap() {
+	for (Chunk& chunk : m_Chunks) {
+		if (chunk.VBO != 0)
+			glDeleteBuffers(1, &chunk.VBO);
+	}
+	glDeleteBuffers(1, &m_EBO);
+	GLState::DeleteVertexArrays(1, &m_VAO);
+}
+
+void TTK::Tilemap::SetTile(uint32_t x, uint32_t y, TextureAtlas::Handle region) {
+	if (x >= m_Width || y >= m_Height) {
+		LOG_WARN("Tile ({}, {}) is outside of the tilemap", x, y);
+		return;
+	}
+	Chunk& chunk = m_Chunks[(y / ChunkSize) * m_ChunksX + (x / ChunkSize)];
+	TextureAtlas::Handle& tile = chunk.Tiles[(y % ChunkSize) * ChunkSize + (x % ChunkSize)];
+	if (tile != region) {
+		tile = region;
+		chunk.Dirty = true;
+	}
+}
+
+void TTK::Tilemap::MarkAllDirty() {
+	for (Chunk& chunk : m_Chunks)
+		chunk.Dirty = true;
+}
+
+TTK::TextureAtlas::Handle TTK::Tilemap::GetTile(uint32_t x, uint32_t y) const {
+	if (x >= m_Width || y >= m_Height)
+		return TextureAtlas::InvalidHandle;
+	const Chunk& chunk = m_Chunks[(y / ChunkSize) * m_ChunksX + (x / ChunkSize)];
+	return chunk.Tiles[(y % ChunkSize) * ChunkSize + (x % ChunkSize)];
+}
+
+void TTK::Tilemap::Draw(const glm::mat4& viewProjection, const glm::vec2& viewMin, const glm::vec2& viewMax) {
+	// If the atlas has been rebuilt, the UVs baked into our chunks may be stale
+	if (m_AtlasBuild != m_Atlas->GetBuildCount()) {
+		m_AtlasBuild = m_Atlas->GetBuildCount();
+		MarkAllDirty();
+	}
+
+	// Work out which chunks overlap the view, so that we never have to visit the chunks outside of it
+	glm::vec2 chunkSize = m_TileSize * static_cast<float>(ChunkSize);
+	glm::ivec2 first = glm::ivec2(glm::floor((viewMin - m_Origin) / chunkSize));
+	glm::ivec2 last = glm::ivec2(glm::floor((viewMax - m_Origin) / chunkSize));
+	first = glm::max(first, glm::ivec2(0));
+	last = glm::min(last, glm::ivec2(m_ChunksX, m_ChunksY) - 1);
+	if (first.x > last.x || first.y > last.y)
+		return;
+
+	GLuint shader = __GetShader();
+	GLState::UseProgram(shader);
+	glProgramUniformMatrix4fv(shader, 0, 1, false, &viewProjection[0][0]);
+	glProgramUniform2fv(shader, 1, 1, &m_Origin.x);
+	GLState::BindTexture(0, m_Atlas->GetArrayTexture());
+	GLState::BindVertexArray(m_VAO);
+
+	for (int y = first.y; y <= last.y; y++) {
+		for (int x = first.x; x <= last.x; x++) {
+			Chunk& chunk = m_Chunks[y * m_ChunksX + x];
+			if (chunk.Dirty)
+				__RebuildChunk(x, y);
+			if (chunk.QuadCount == 0)
+				continue;
+			glVertexArrayVertexBuffer(m_VAO, 0, chunk.VBO, 0, sizeof(TileVert));
+			glDrawElements(GL_TRIANGLES, chunk.QuadCount * 6, GL_UNSIGNED_INT, nullptr);
+		}
+	}
+}
+
+void TTK::Tilemap::__RebuildChunk(uint32_t chunkX, uint32_t chunkY) {
+	Chunk& chunk = m_Chunks[chunkY * m_ChunksX + chunkX];
+	chunk.Dirty = false;
+
+	// Vertices are stored relative to the map's origin, so that moving the map doesn't require a rebuild
+	std::vector<TileVert> verts;
+	verts.reserve(ChunkSize * ChunkSize * 4);
+	for (uint32_t y = 0; y < ChunkSize; y++) {
+		for (uint32_t x = 0; x < ChunkSize; x++) {
+			TextureAtlas::Handle region = chunk.Tiles[y * ChunkSize + x];
+			if (region == TextureAtlas::InvalidHandle || region >= m_Atlas->GetRegionCount())
+				continue;
+			const AtlasRegion& info = m_Atlas->GetRegion(region);
+			glm::vec2 min = glm::vec2(chunkX * ChunkSize + x, chunkY * ChunkSize + y) * m_TileSize;
+			glm::vec2 max = min + m_TileSize;
+			uint16_t layer = static_cast<uint16_t>(info.Layer);
+			// Images are stored top down, so the top of the tile shows the minimum V coordinate
+			verts.push_back({ { max.x, min.y }, { info.UVRect.z, info.UVRect.w }, layer, 0 });
+			verts.push_back({ { max.x, max.y }, { info.UVRect.z, info.UVRect.y }, layer, 0 });
+			verts.push_back({ { min.x, max.y }, { info.UVRect.x, info.UVRect.y }, layer, 0 });
+			verts.push_back({ { min.x, min.y }, { info.UVRect.x, info.UVRect.w }, layer, 0 });
+		}
+	}
+
+	chunk.QuadCount = static_cast<GLsizei>(verts.size() / 4);
+	if (chunk.QuadCount == 0)
+		return;
+
+	// Chunks only ever grow their buffers, most edits won't change the number of tiles by much
+	if (chunk.QuadCount > chunk.QuadCapacity) {
+		if (chunk.VBO != 0)
+			glDeleteBuffers(1, &chunk.VBO);
+		glCreateBuffers(1, &chunk.VBO);
+		glNamedBufferStorage(chunk.VBO, verts.size() * sizeof(TileVert), verts.data(), GL_DYNAMIC_STORAGE_BIT);
+		chunk.QuadCapacity = chunk.QuadCount;
+	} else {
+		glNamedBufferSubData(chunk.VBO, 0, verts.size() * sizeof(TileVert), verts.data());
+	}
+}
+
+void TTK::Tilemap::DestroyContext() {
+	if (m_Shader != 0)
+		glDeleteProgram(m_Shader);
+	m_Shader = 0;
+}
+
+GLuint TTK::Tilemap::__GetShader() {
+	if (m_Shader != 0)
+		return m_Shader;
+
+	const char* vsSource = R"LIT(#version 440
+            layout (location = 0) in vec2 vertexPosition;
+            layout (location = 1) in vec2 vertexTexture;
+            layout (location = 2) in float vertexLayer;
+            layout (location = 0) out vec3 fragmentTexture;
+            layout (location = 0) uniform mat4 xTransform;
+            layout (location = 1) uniform vec2 xOrigin;
+            void main() {
+                gl_Position = xTransform * vec4(vertexPosition + xOrigin, 0, 1);
+                fragmentTexture = vec3(vertexTexture, vertexLayer);
+            })LIT";
+
+	const char* fsSource = R"LIT(#version 440
+            layout(binding = 0) uniform sampler2DArray xSampler;
+            layout (location = 0) in vec3 fragUv;
+            out vec4 frag_color;
+            void main() {
+                frag_color = texture(xSampler, fragUv);
+            })LIT";
+
+	m_Shader = glCreateProgram();
+
+	GLuint programs[2];
+	programs[0] = glCreateShader(GL_VERTEX_SHADER);
+	glShaderSource(programs[0], 1, &vsSource, NULL);
+	glCompileShader(programs[0]);
+	programs[1] = glCreateShader(GL_FRAGMENT_SHADER);
+	glShaderSource(programs[1], 1, &fsSource, NULL);
+	glCompileShader(programs[1]);
+
+	// Attach our two shaders
+	glAttachShader(m_Shader, programs[0]);
+	glAttachShader(m_Shader, programs[1]);
+
+	// Perform linking
+	glLinkProgram(m_Shader);
+
+	// Remove shader parts to save space
+	glDetachShader(m_Shader, programs[0]);
+	glDeleteShader(programs[0]);
+	glDetachShader(m_Shader, programs[1]);
+	glDeleteShader(programs[1]);
+
+	return m_Shader;
+}
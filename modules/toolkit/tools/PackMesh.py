@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+##########################################################################
+#
+# This tool is a part of the Tutorial Tool Kit (TTK) library.
+#
+# Converts a triangle mesh into the compact, indexed format used by the
+# TTK primitive geometry module. Positions are de-duplicated, quantized to
+# normalized 16 bit integers relative to the mesh bounds, and written to a
+# C++ header along with 16 bit triangle indices.
+#
+# Usage: PackMesh.py <input.obj | legacy_blob.h> <Name> <output.h>
+#
+# Inputs can either be Wavefront OBJ files, or the legacy TTK float blob
+# headers (6 floats per vertex, position followed by normal, one triangle
+# per 3 vertices)
+#
+##########################################################################
+import re
+import sys
+
+
+def load_obj(path):
+    positions, triangles = [], []
+    with open(path) as f:
+        for line in f:
+            parts = line.split()
+            if not parts:
+                continue
+            if parts[0] == 'v':
+                positions.append(tuple(float(x) for x in parts[1:4]))
+            elif parts[0] == 'f':
+                face = [int(p.split('/')[0]) for p in parts[1:]]
+                face = [ix - 1 if ix > 0 else len(positions) + ix for ix in face]
+                # Triangulate polygons as a fan
+                for ix in range(1, len(face) - 1):
+                    triangles.append((positions[face[0]], positions[face[ix]], positions[face[ix + 1]]))
+    return [p for tri in triangles for p in tri]
+
+
+def load_blob(path):
+    nums = [float(x) for x in re.findall(r'(-?\d+\.\d+)f', open(path).read())]
+    return [tuple(nums[ix:ix + 3]) for ix in range(0, len(nums), 6)]
+
+
+def pack(soup):
+    lo = [min(p[ax] for p in soup) for ax in range(3)]
+    hi = [max(p[ax] for p in soup) for ax in range(3)]
+    offset = [(lo[ax] + hi[ax]) / 2 for ax in range(3)]
+    scale = [(hi[ax] - lo[ax]) / 2 or 1.0 for ax in range(3)]
+
+    lookup, vertices, indices = {}, [], []
+    for p in soup:
+        q = tuple(max(-32767, min(32767, round((p[ax] - offset[ax]) / scale[ax] * 32767))) for ax in range(3))
+        if q not in lookup:
+            lookup[q] = len(vertices)
+            vertices.append(q)
+        indices.append(lookup[q])
+
+    if len(vertices) > 0xFFFF:
+        raise ValueError('Mesh has too many unique vertices for 16 bit indices')
+    return vertices, indices, offset, scale
+
+
+def write_header(path, name, source, vertices, indices, offset, scale):
+    def rows(values, per_row):
+        return ',\n'.join(', '.join(str(v) for v in values[ix:ix + per_row]) for ix in range(0, len(values), per_row))
+
+    flat = [c for v in vertices for c in (*v, 0)]
+    with open(path, 'w', newline='\n') as f:
+        f.write('#pragma once\n')
+        f.write('/*\n')
+        f.write(' * This file was generated by modules/toolkit/tools/PackMesh.py from {}, do not edit it by hand.\n'.format(source))
+        f.write(' * Positions are normalized 16 bit integers (x, y, z, padding) relative to the mesh bounds,\n')
+        f.write(' * use the offset and scale to get back to model space.\n')
+        f.write(' * {} unique vertices, {} triangles\n'.format(len(vertices), len(indices) // 3))
+        f.write(' */\n')
+        f.write('#include <cstdint>\n\n')
+        f.write('const float {}Offset[] = {{ {:.5f}f, {:.5f}f, {:.5f}f }};\n'.format(name, *offset))
+        f.write('const float {}Scale[] = {{ {:.5f}f, {:.5f}f, {:.5f}f }};\n\n'.format(name, *scale))
+        f.write('const int16_t {}Vertices[] = {{\n{}\n}};\n\n'.format(name, rows(flat, 16)))
+        f.write('const uint16_t {}Indices[] = {{\n{}\n}};\n'.format(name, rows(indices, 24)))
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 4:
+        print('Usage: PackMesh.py <input.obj | legacy_blob.h> <Name> <output.h>')
+        sys.exit(1)
+    source, name, output = sys.argv[1:]
+    soup = load_obj(source) if source.lower().endswith('.obj') else load_blob(source)
+    vertices, indices, offset, scale = pack(soup)
+    write_header(output, name, source.replace('\\', '/').split('/')[-1], vertices, indices, offset, scale)
+    print('Packed {} vertices ({} unique) into {}'.format(len(soup), len(vertices), output))